@@ -71,6 +71,12 @@ App::App(Snapshot * snapshot) :
   m_tabViewController(&m_inputViewController, snapshot, &m_listStackViewController, &m_graphStackViewController, &m_valuesStackViewController),
   m_inputViewController(&m_modalViewController, &m_tabViewController, this, this, this)
 {
+  snapshot->functionStore()->setCaches(m_functionCaches, Shared::ContinuousFunctionCache::k_numberOfAvailableCaches);
+}
+
+App::~App() {
+  // The caches are destroyed with the App, but the store outlives it
+  functionStore()->setCaches(nullptr, 0);
 }
 
 CodePoint App::XNT() {
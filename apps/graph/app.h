@@ -42,6 +42,7 @@ public:
   static App * app() {
     return static_cast<App *>(Container::activeApp());
   }
+  ~App();
   Snapshot * snapshot() const {
     return static_cast<Snapshot *>(::App::snapshot());
   }
@@ -75,6 +76,7 @@ private:
   StackViewController m_valuesStackViewController;
   TabViewController m_tabViewController;
   InputViewController m_inputViewController;
+  Shared::ContinuousFunctionCache m_functionCaches[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
 };
 
 }
@@ -2,6 +2,7 @@
 extern "C" {
 #include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
 }
 #include <ion.h>
 
@@ -23,6 +24,62 @@ Ion::Storage::Record::ErrorStatus ContinuousFunctionStore::addEmptyModel() {
   return error;
 }
 
+void ContinuousFunctionStore::setCaches(ContinuousFunctionCache * caches, int numberOfCaches) {
+  assert(numberOfCaches <= ContinuousFunctionCache::k_numberOfAvailableCaches);
+  // The functions may still point to the previous caches
+  for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
+    m_functions[i].setCache(nullptr);
+  }
+  m_caches = caches;
+  m_numberOfCaches = numberOfCaches;
+  for (int i = 0; i < numberOfCaches; i++) {
+    m_cacheRecords[i] = Ion::Storage::Record();
+    m_cacheLastUses[i] = 0;
+  }
+}
+
+ContinuousFunctionCache * ContinuousFunctionStore::cacheForRecord(Ion::Storage::Record record) const {
+  if (m_numberOfCaches == 0) {
+    return nullptr;
+  }
+  uint32_t checksum = record.checksum();
+  m_cacheUseCounter++;
+  int leastRecentlyUsed = 0;
+  for (int i = 0; i < m_numberOfCaches; i++) {
+    if (m_cacheRecords[i] == record) {
+      if (m_cacheChecksums[i] != checksum) {
+        m_caches[i].clear();
+        m_cacheChecksums[i] = checksum;
+      }
+      m_cacheLastUses[i] = m_cacheUseCounter;
+      return m_caches + i;
+    }
+    if (cacheAge(i) > cacheAge(leastRecentlyUsed)) {
+      leastRecentlyUsed = i;
+    }
+  }
+  if (cacheAge(leastRecentlyUsed) <= static_cast<uint32_t>(numberOfActiveFunctions())) {
+    return nullptr;
+  }
+  // Take the cache from the function it belonged to
+  ContinuousFunctionCache * cache = m_caches + leastRecentlyUsed;
+  for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
+    if (m_functions[i].cache() == cache) {
+      m_functions[i].setCache(nullptr);
+    }
+  }
+  cache->clear();
+  m_cacheRecords[leastRecentlyUsed] = record;
+  m_cacheChecksums[leastRecentlyUsed] = checksum;
+  m_cacheLastUses[leastRecentlyUsed] = m_cacheUseCounter;
+  return cache;
+}
+
+uint32_t ContinuousFunctionStore::cacheAge(int i) const {
+  // Unsigned differences remain right when the counter wraps around
+  return m_cacheRecords[i].isNull() ? UINT32_MAX : m_cacheUseCounter - m_cacheLastUses[i];
+}
+
 ExpressionModelHandle * ContinuousFunctionStore::setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const {
   assert(cacheIndex >= 0 && cacheIndex < maxNumberOfMemoizedModels());
   m_functions[cacheIndex] = ContinuousFunction(record);
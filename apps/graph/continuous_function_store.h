@@ -8,6 +8,7 @@ namespace Graph {
 
 class ContinuousFunctionStore : public Shared::FunctionStore {
 public:
+  ContinuousFunctionStore() : Shared::FunctionStore(), m_caches(nullptr), m_numberOfCaches(0), m_cacheUseCounter(0) {}
   bool displaysNonCartesianFunctions(int * nbActiveFunctions = nullptr) const;
   int numberOfActiveFunctionsOfType(Shared::ContinuousFunction::PlotType plotType) const {
     return numberOfModelsSatisfyingTest(&isFunctionActiveOfType, &plotType);
@@ -16,18 +17,31 @@ public:
     return recordSatisfyingTestAtIndex(i, &isFunctionActiveOfType, &plotType);
   }
   Shared::ExpiringPointer<Shared::ContinuousFunction> modelForRecord(Ion::Storage::Record record) const { return Shared::ExpiringPointer<Shared::ContinuousFunction>(static_cast<Shared::ContinuousFunction *>(privateModelForRecord(record))); }
-  Shared::ContinuousFunctionCache * cacheAtIndex(int i) const { return (i < Shared::ContinuousFunctionCache::k_numberOfAvailableCaches) ? m_functionCaches + i : nullptr; }
+  /* The caches are lent by the App while it is active. Each one belongs to a
+   * record and is cleared if the record's checksum changed. When a record has
+   * no cache yet, it takes the least recently used one, unless this one was
+   * used since all the active functions were last drawn. Otherwise, when more
+   * functions than caches are drawn, they would take the caches from each
+   * other at every redraw. */
+  void setCaches(Shared::ContinuousFunctionCache * caches, int numberOfCaches);
+  Shared::ContinuousFunctionCache * cacheForRecord(Ion::Storage::Record record) const;
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
 private:
   const char * modelExtension() const override { return Ion::Storage::funcExtension; }
   Shared::ExpressionModelHandle * setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const override;
   Shared::ExpressionModelHandle * memoizedModelAtIndex(int cacheIndex) const override;
+  uint32_t cacheAge(int i) const;
   static bool isFunctionActiveOfType(Shared::ExpressionModelHandle * model, void * context) {
     Shared::ContinuousFunction::PlotType plotType = *static_cast<Shared::ContinuousFunction::PlotType *>(context);
     return isFunctionActive(model, context) && plotType == static_cast<Shared::ContinuousFunction *>(model)->plotType();
   }
   mutable Shared::ContinuousFunction m_functions[k_maxNumberOfMemoizedModels];
-  mutable Shared::ContinuousFunctionCache m_functionCaches[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  Shared::ContinuousFunctionCache * m_caches;
+  int m_numberOfCaches;
+  mutable Ion::Storage::Record m_cacheRecords[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable uint32_t m_cacheChecksums[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable uint32_t m_cacheLastUses[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable uint32_t m_cacheUseCounter;
 
 };
 
@@ -17,9 +17,9 @@ CalculationParameterController::CalculationParameterController(Responder * paren
   m_preimageGraphController(nullptr, graphView, bannerView, range, cursor),
   m_tangentGraphController(nullptr, graphView, bannerView, range, cursor),
   m_integralGraphController(nullptr, inputEventHandlerDelegate, graphView, range, cursor),
-  m_minimumGraphController(nullptr, graphView, bannerView, range, cursor),
-  m_maximumGraphController(nullptr, graphView, bannerView, range, cursor),
-  m_rootGraphController(nullptr, graphView, bannerView, range, cursor),
+  m_minimumGraphController(nullptr, graphView, bannerView, range, cursor, &m_pointsOfInterestCache),
+  m_maximumGraphController(nullptr, graphView, bannerView, range, cursor, &m_pointsOfInterestCache),
+  m_rootGraphController(nullptr, graphView, bannerView, range, cursor, &m_pointsOfInterestCache),
   m_intersectionGraphController(nullptr, graphView, bannerView, range, cursor)
 {
 }
@@ -34,6 +34,8 @@ View * CalculationParameterController::view() {
 
 void CalculationParameterController::viewWillAppear() {
   ViewController::viewWillAppear();
+  // The function or the range may have changed since the last calculation
+  m_pointsOfInterestCache.tidy();
   m_selectableTableView.reloadData();
 }
 
@@ -7,6 +7,7 @@
 #include "extremum_graph_controller.h"
 #include "integral_graph_controller.h"
 #include "intersection_graph_controller.h"
+#include "points_of_interest_cache.h"
 #include "root_graph_controller.h"
 #include "graph_view.h"
 #include "banner_view.h"
@@ -37,6 +38,7 @@ private:
   MessageTableCell<> m_cells[k_totalNumberOfReusableCells];
   SelectableTableView m_selectableTableView;
   Ion::Storage::Record m_record;
+  PointsOfInterestCache m_pointsOfInterestCache;
   PreimageParameterController m_preimageParameterController;
   PreimageGraphController m_preimageGraphController;
   TangentGraphController m_tangentGraphController;
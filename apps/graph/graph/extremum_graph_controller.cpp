@@ -6,8 +6,9 @@ using namespace Poincare;
 
 namespace Graph {
 
-MinimumGraphController::MinimumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor) :
-  CalculationGraphController(parentResponder, graphView, bannerView, curveViewRange, cursor, I18n::Message::NoMinimumFound)
+MinimumGraphController::MinimumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor, PointsOfInterestCache * pointsOfInterestCache) :
+  CalculationGraphController(parentResponder, graphView, bannerView, curveViewRange, cursor, I18n::Message::NoMinimumFound),
+  m_pointsOfInterestCache(pointsOfInterestCache)
 {
 }
 
@@ -16,11 +17,12 @@ const char * MinimumGraphController::title() {
 }
 
 Coordinate2D<double> MinimumGraphController::computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) {
-  return functionStore()->modelForRecord(m_record)->nextMinimumFrom(start, step, max, context);
+  return m_pointsOfInterestCache->nextPointOfInterest(functionStore()->modelForRecord(m_record), Solver::PointOfInterestType::Minimum, start, step, max, m_graphRange->xMin(), m_graphRange->xMax(), context);
 }
 
-MaximumGraphController::MaximumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor) :
-  CalculationGraphController(parentResponder, graphView, bannerView, curveViewRange, cursor, I18n::Message::NoMaximumFound)
+MaximumGraphController::MaximumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor, PointsOfInterestCache * pointsOfInterestCache) :
+  CalculationGraphController(parentResponder, graphView, bannerView, curveViewRange, cursor, I18n::Message::NoMaximumFound),
+  m_pointsOfInterestCache(pointsOfInterestCache)
 {
 }
 
@@ -29,7 +31,7 @@ const char * MaximumGraphController::title() {
 }
 
 Coordinate2D<double> MaximumGraphController::computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) {
-  return functionStore()->modelForRecord(m_record)->nextMaximumFrom(start, step, max, context);
+  return m_pointsOfInterestCache->nextPointOfInterest(functionStore()->modelForRecord(m_record), Solver::PointOfInterestType::Maximum, start, step, max, m_graphRange->xMin(), m_graphRange->xMax(), context);
 }
 
 }
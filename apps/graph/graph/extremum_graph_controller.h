@@ -2,12 +2,13 @@
 #define GRAPH_EXTREMUM_GRAPH_CONTROLLER_H
 
 #include "calculation_graph_controller.h"
+#include "points_of_interest_cache.h"
 
 namespace Graph {
 
 class MinimumGraphController : public CalculationGraphController {
 public:
-  MinimumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor);
+  MinimumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor, PointsOfInterestCache * pointsOfInterestCache);
   const char * title() override;
   TELEMETRY_ID("Minimum");
 private:
@@ -15,11 +16,12 @@ private:
   // Prevent horizontal panning to preserve search interval
   float cursorRightMarginRatio() override { return 0.0f; }
   float cursorLeftMarginRatio() override { return 0.0f; }
+  PointsOfInterestCache * m_pointsOfInterestCache;
 };
 
 class MaximumGraphController : public CalculationGraphController {
 public:
-  MaximumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor);
+  MaximumGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor, PointsOfInterestCache * pointsOfInterestCache);
   const char * title() override;
   TELEMETRY_ID("Maximum");
 private:
@@ -27,6 +29,7 @@ private:
   // Prevent horizontal panning to preserve search interval
   float cursorRightMarginRatio() override { return 0.0f; }
   float cursorLeftMarginRatio() override { return 0.0f; }
+  PointsOfInterestCache * m_pointsOfInterestCache;
 };
 
 }
@@ -22,6 +22,18 @@ void GraphView::reload() {
   return FunctionGraphView::reload();
 }
 
+bool GraphView::drawsCurvesProgressively() const {
+  ContinuousFunctionStore * functionStore = App::app()->functionStore();
+  const int activeFunctionsCount = functionStore->numberOfActiveFunctions();
+  for (int i = 0; i < activeFunctionsCount; i++) {
+    ExpiringPointer<ContinuousFunction> f = functionStore->modelForRecord(functionStore->activeRecordAtIndex(i));
+    if (f->basedOnCostlyAlgorithms(context())) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   FunctionGraphView::drawRect(ctx, rect);
   ContinuousFunctionStore * functionStore = App::app()->functionStore();
@@ -29,7 +41,7 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   for (int i = 0; i < activeFunctionsCount ; i++) {
     Ion::Storage::Record record = functionStore->activeRecordAtIndex(i);
     ExpiringPointer<ContinuousFunction> f = functionStore->modelForRecord(record);
-    ContinuousFunctionCache * cch = functionStore->cacheAtIndex(i);
+    ContinuousFunctionCache * cch = functionStore->cacheForRecord(record);
     Shared::ContinuousFunction::PlotType type = f->plotType();
     Poincare::Expression e = f->expressionReduced(context());
     if (e.isUndefined() || (
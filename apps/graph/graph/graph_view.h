@@ -37,6 +37,7 @@ public:
    * of the graph where the area under the curve is colored. */
   void setAreaHighlightColor(bool highlightColor) override {};
 private:
+  bool drawsCurvesProgressively() const override;
   bool m_tangent;
 };
 
@@ -0,0 +1,37 @@
+#include "points_of_interest_cache.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Shared;
+using namespace Poincare;
+
+namespace Graph {
+
+Coordinate2D<double> PointsOfInterestCache::nextPointOfInterest(ExpiringPointer<ContinuousFunction> function, Solver::PointOfInterestType type, double start, double step, double max, double xMin, double xMax, Context * context) {
+  // The points of interest are searched on the domain of the function
+  double tMin = function->tMin();
+  double tMax = function->tMax();
+  double sweepStart = std::max(xMin, tMin);
+  double sweepEnd = std::min(xMax, tMax);
+  double sweepStep = std::fabs(step);
+  if (sweepStart <= sweepEnd && !m_points.isComputedOn(sweepStart, sweepEnd, sweepStep)) {
+    function->pointsOfInterestBetween(sweepStart, sweepEnd, sweepStep, context, &m_points);
+  }
+  double clippedStart = step > 0.0 ? std::max(start, tMin) : std::min(start, tMax);
+  double clippedMax = step > 0.0 ? std::min(max, tMax) : std::max(max, tMin);
+  Coordinate2D<double> result;
+  if (m_points.isComputedOn(sweepStart, sweepEnd, sweepStep) && m_points.next(type, clippedStart, step, clippedMax, &result)) {
+    return result;
+  }
+  switch (type) {
+    case Solver::PointOfInterestType::Root:
+      return function->nextRootFrom(start, step, max, context);
+    case Solver::PointOfInterestType::Minimum:
+      return function->nextMinimumFrom(start, step, max, context);
+    default:
+      assert(type == Solver::PointOfInterestType::Maximum);
+      return function->nextMaximumFrom(start, step, max, context);
+  }
+}
+
+}
@@ -0,0 +1,27 @@
+#ifndef GRAPH_POINTS_OF_INTEREST_CACHE_H
+#define GRAPH_POINTS_OF_INTEREST_CACHE_H
+
+#include "../../shared/continuous_function.h"
+#include "../../shared/expiring_pointer.h"
+#include <poincare/solver.h>
+
+namespace Graph {
+
+/* PointsOfInterestCache holds the roots and extrema of the selected function
+ * on the displayed range. They are computed in a single sweep when a point is
+ * first requested, and shared by the root, minimum and maximum controllers, so
+ * that moving the cursor does not search the function again. */
+
+class PointsOfInterestCache {
+public:
+  void tidy() { m_points.init(NAN, NAN, NAN); }
+  /* Equivalent to the ContinuousFunction::next...From methods. The points of
+   * interest are computed on [xMin, xMax] with the step |step|. */
+  Poincare::Coordinate2D<double> nextPointOfInterest(Shared::ExpiringPointer<Shared::ContinuousFunction> function, Poincare::Solver::PointOfInterestType type, double start, double step, double max, double xMin, double xMax, Poincare::Context * context);
+private:
+  Poincare::Solver::PointsOfInterest m_points;
+};
+
+}
+
+#endif
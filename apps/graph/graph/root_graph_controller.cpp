@@ -7,8 +7,9 @@ using namespace Poincare;
 
 namespace Graph {
 
-RootGraphController::RootGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, CurveViewCursor * cursor) :
-  CalculationGraphController(parentResponder, graphView, bannerView, curveViewRange, cursor, I18n::Message::NoZeroFound)
+RootGraphController::RootGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, CurveViewCursor * cursor, PointsOfInterestCache * pointsOfInterestCache) :
+  CalculationGraphController(parentResponder, graphView, bannerView, curveViewRange, cursor, I18n::Message::NoZeroFound),
+  m_pointsOfInterestCache(pointsOfInterestCache)
 {
 }
 
@@ -17,7 +18,7 @@ const char * RootGraphController::title() {
 }
 
 Coordinate2D<double> RootGraphController::computeNewPointOfInterest(double start, double step, double max, Context * context) {
-  return functionStore()->modelForRecord(m_record)->nextRootFrom(start, step, max, context);
+  return m_pointsOfInterestCache->nextPointOfInterest(functionStore()->modelForRecord(m_record), Solver::PointOfInterestType::Root, start, step, max, m_graphRange->xMin(), m_graphRange->xMax(), context);
 }
 
 }
@@ -2,12 +2,13 @@
 #define GRAPH_ROOT_GRAPH_CONTROLLER_H
 
 #include "calculation_graph_controller.h"
+#include "points_of_interest_cache.h"
 
 namespace Graph {
 
 class RootGraphController : public CalculationGraphController {
 public:
-  RootGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor);
+  RootGraphController(Responder * parentResponder, GraphView * graphView, BannerView * bannerView, Shared::InteractiveCurveViewRange * curveViewRange, Shared::CurveViewCursor * cursor, PointsOfInterestCache * pointsOfInterestCache);
   const char * title() override;
   TELEMETRY_ID("Root");
 private:
@@ -15,6 +16,7 @@ private:
   // Prevent horizontal panning to preserve search interval
   float cursorRightMarginRatio() override { return 0.0f; }
   float cursorLeftMarginRatio() override { return 0.0f; }
+  PointsOfInterestCache * m_pointsOfInterestCache;
 };
 
 }
@@ -33,7 +33,7 @@ void assert_check_cartesian_cache_against_function(ContinuousFunction * function
 }
 
 void assert_cartesian_cache_stays_valid_while_panning(ContinuousFunction * function, Context * context, InteractiveCurveViewRange * range, CurveViewCursor * cursor, ContinuousFunctionStore * store, float step) {
-  ContinuousFunctionCache * cache = store->cacheAtIndex(0);
+  ContinuousFunctionCache * cache = store->cacheForRecord(*function);
   assert(cache);
 
   float tMin, tStep;
@@ -50,7 +50,7 @@ void assert_cartesian_cache_stays_valid_while_panning(ContinuousFunction * funct
 }
 
 void assert_check_polar_cache_against_function(ContinuousFunction * function, Context * context, InteractiveCurveViewRange * range, ContinuousFunctionStore * store) {
-  ContinuousFunctionCache * cache = store->cacheAtIndex(0);
+  ContinuousFunctionCache * cache = store->cacheForRecord(*function);
   assert(cache);
 
   float tMin = range->xMin();
@@ -81,6 +81,8 @@ void assert_check_polar_cache_against_function(ContinuousFunction * function, Co
 void assert_cache_stays_valid(ContinuousFunction::PlotType type, const char * definition, float rangeXMin = -5, float rangeXMax = 5) {
   GlobalContext globalContext;
   ContinuousFunctionStore functionStore;
+  ContinuousFunctionCache caches[1];
+  functionStore.setCaches(caches, 1);
 
   InteractiveCurveViewRange graphRange;
   graphRange.setXMin(rangeXMin);
@@ -121,4 +123,122 @@ QUIZ_CASE(graph_caching) {
   assert_cache_stays_valid(Polar, "cos(5θ)", -1e8f, 1e8f);
 }
 
+void assert_cache_is_accurate_around(const char * definition, float root) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunctionCache caches[1];
+  functionStore.setCaches(caches, 1);
+
+  ContinuousFunction * function = addFunction(definition, Cartesian, &functionStore, &globalContext);
+  ContinuousFunctionCache * cache = functionStore.cacheForRecord(*function);
+  // The parameters are exact in float so that only the evaluation is compared
+  constexpr float step = 1.0f/64.0f;
+  const float tMin = root - 1.0f;
+  ContinuousFunctionCache::PrepareForCaching(function, cache, tMin, step);
+  for (int i = 0; i < 128; i++) {
+    float t = tMin + i*step;
+    double expected = std::pow(static_cast<double>(t) - root, 16.0);
+    float value = cache->valueForParameter(function, &globalContext, t).x2();
+    quiz_assert_print_if_failure(IsApproximatelyEqual(value, static_cast<float>(expected), 1E-5f, 0.0f), definition);
+  }
+
+  functionStore.removeAll();
+}
+
+QUIZ_CASE(graph_caching_accuracy) {
+  /* High-degree powers are expanded into polynomials with large coefficients,
+   * whose values cancel out close to the root. */
+  assert_cache_is_accurate_around("(x-20)^16", 20.0f);
+  assert_cache_is_accurate_around("(x-10)^16", 10.0f);
+}
+
+void assert_cache_computes_drawn_points(const char * definition, int batchSize) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunctionCache caches[1];
+  functionStore.setCaches(caches, 1);
+
+  ContinuousFunction * function = addFunction(definition, Cartesian, &functionStore, &globalContext);
+  ContinuousFunctionCache * cache = functionStore.cacheForRecord(*function);
+  constexpr float step = 1.0f/64.0f;
+  constexpr int numberOfPoints = 128;
+  bool computed[numberOfPoints] = {};
+  /* Costly curves are drawn in passes of decreasing strides. On a miss after
+   * the first point of a pass, the next points of the pass are approximated
+   * together, and the points in between are left alone. */
+  for (int stride = 4; stride > 0; stride /= 2) {
+    ContinuousFunctionCache::PrepareForCaching(function, cache, 0.0f, step);
+    for (int i = 0; i < numberOfPoints; i += stride) {
+      if (!computed[i]) {
+        int batchEnd = i == 0 ? 1 : i + batchSize*stride;
+        for (int j = i; j < batchEnd && j < numberOfPoints; j += stride) {
+          computed[j] = true;
+        }
+      }
+      cache->valueForParameter(function, &globalContext, i*step);
+      for (int j = 0; j < numberOfPoints; j++) {
+        quiz_assert_print_if_failure(cache->isComputedAtParameter(function, j*step) == computed[j], definition);
+      }
+    }
+  }
+
+  function->setCache(nullptr);
+  for (int i = 0; i < numberOfPoints; i++) {
+    float t = i*step;
+    quiz_assert_print_if_failure(floatEquals(cache->valueForParameter(function, &globalContext, t).x2(), function->evaluateXYAtParameter(t, &globalContext).x2()), definition);
+  }
+
+  functionStore.removeAll();
+}
+
+QUIZ_CASE(graph_caching_passes) {
+  assert_cache_computes_drawn_points("sin(x)", 32);
+  // Without a compiled program, only the requested points are approximated
+  assert_cache_computes_drawn_points("int(sin(t),t,0,x)", 1);
+}
+
+QUIZ_CASE(graph_caching_pool) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  constexpr int numberOfCaches = 2;
+  ContinuousFunctionCache caches[numberOfCaches];
+  functionStore.setCaches(caches, numberOfCaches);
+
+  constexpr int numberOfFunctions = 3;
+  const char * definitions[numberOfFunctions] = {"x", "x^2", "θ"};
+  const ContinuousFunction::PlotType types[numberOfFunctions] = {Cartesian, Cartesian, Polar};
+  ContinuousFunction * functions[numberOfFunctions];
+  for (int i = 0; i < numberOfFunctions; i++) {
+    functions[i] = addFunction(definitions[i], types[i], &functionStore, &globalContext);
+  }
+
+  // The first functions keep their caches while all the functions are drawn
+  ContinuousFunctionCache * cache0 = functionStore.cacheForRecord(*functions[0]);
+  ContinuousFunctionCache * cache1 = functionStore.cacheForRecord(*functions[1]);
+  quiz_assert(cache0 != nullptr && cache1 != nullptr && cache0 != cache1);
+  for (int pass = 0; pass < 3; pass++) {
+    quiz_assert(functionStore.cacheForRecord(*functions[0]) == cache0);
+    quiz_assert(functionStore.cacheForRecord(*functions[1]) == cache1);
+    quiz_assert(functionStore.cacheForRecord(*functions[2]) == nullptr);
+  }
+
+  // A cache is taken from a function which is not drawn anymore
+  ContinuousFunctionCache::PrepareForCaching(functions[0], cache0, 0.0f, 0.1f);
+  quiz_assert(functions[0]->cache() == cache0);
+  functions[0]->setActive(false);
+  quiz_assert(functionStore.cacheForRecord(*functions[1]) == cache1);
+  quiz_assert(functionStore.cacheForRecord(*functions[2]) == cache0);
+  quiz_assert(functions[0]->cache() == nullptr);
+
+  // The cache of a function is cleared when its definition changes
+  ContinuousFunctionCache::PrepareForCaching(functions[1], cache1, 0.0f, 0.1f);
+  functions[1]->evaluateXYAtParameter(0.5f, &globalContext);
+  functions[1]->setContent("x^3", &globalContext);
+  functions[1]->setCache(cache1);
+  quiz_assert(functionStore.cacheForRecord(*functions[1]) == cache1);
+  quiz_assert(cache1->step() == 0.0f);
+
+  functionStore.removeAll();
+}
+
 }
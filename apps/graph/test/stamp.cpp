@@ -0,0 +1,115 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <apps/shared/curve_view.h>
+#include <apps/shared/stamps.h>
+#include <kandinsky/framebuffer_context.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <cmath>
+
+using namespace Shared;
+
+namespace Graph {
+
+constexpr KDCoordinate k_stampBufferWidth = 64;
+constexpr KDCoordinate k_stampBufferHeight = 48;
+constexpr int k_numberOfPoints = 2000;
+
+/* Stamp the way CurveView did before precomputing the shifted masks: they
+ * were interpolated with floats for each stamp. */
+void reference_stamp_at_location(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) {
+  KDCoordinate stampSize = thick ? Stamps::ThickStampSize : Stamps::ThinStampSize;
+  const uint8_t * stampMask = thick ? Stamps::ThickStampMask : Stamps::ThinStampMask;
+  pxf -= stampSize/2.0f;
+  pyf -= stampSize/2.0f;
+  const KDCoordinate px = std::ceil(pxf);
+  const KDCoordinate py = std::ceil(pyf);
+  KDRect stampRect(px, py, stampSize, stampSize);
+  if (!rect.intersects(stampRect)) {
+    return;
+  }
+  uint8_t shiftedMask[Stamps::ThickStampSize*Stamps::ThickStampSize];
+  KDColor workingBuffer[Stamps::ThickStampSize*Stamps::ThickStampSize];
+  const float dx = px - pxf;
+  const float dy = py - pyf;
+  const KDCoordinate stampMaskSize = stampSize + 1;
+  for (int i = 0; i < stampSize; i++) {
+    for (int j = 0; j < stampSize; j++) {
+      shiftedMask[j*stampSize+i] = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0f-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
+        + dx * (stampMask[j*stampMaskSize+(i+1)]*(1.0f-dy) + stampMask[(j+1)*stampMaskSize+(i+1)]*dy);
+    }
+  }
+  ctx->blendRectWithMask(stampRect, color, shiftedMask, workingBuffer);
+}
+
+typedef void (*StampFunction)(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick);
+
+// Points of a Lissajous curve, which are shifted by all sorts of amounts
+void fill_curve_points(float * x, float * y, int numberOfPoints) {
+  for (int i = 0; i < numberOfPoints; i++) {
+    float t = i * 0.01f;
+    x[i] = k_stampBufferWidth * (0.5f + 0.45f * std::sin(3.0f * t));
+    y[i] = k_stampBufferHeight * (0.5f + 0.45f * std::sin(2.0f * t));
+  }
+}
+
+void stamp_points(StampFunction stamp, KDColor * pixels, const float * x, const float * y, int numberOfPoints, bool thick) {
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_stampBufferWidth, k_stampBufferHeight));
+  KDFrameBufferContext ctx(&frameBuffer);
+  KDRect rect = frameBuffer.bounds();
+  ctx.fillRect(rect, KDColorWhite);
+  for (int i = 0; i < numberOfPoints; i++) {
+    stamp(&ctx, rect, x[i], y[i], KDColorBlack, thick);
+  }
+}
+
+void assert_stamps_look_like_reference(bool thick) {
+  KDColor pixels[k_stampBufferWidth*k_stampBufferHeight];
+  KDColor referencePixels[k_stampBufferWidth*k_stampBufferHeight];
+  float x[k_numberOfPoints];
+  float y[k_numberOfPoints];
+  fill_curve_points(x, y, k_numberOfPoints);
+  /* Rounding the shift to an eighth of a pixel changes the mask by at most
+   * half an eighth of the difference between adjacent mask values. The
+   * points are stamped by small batches so that the buffer does not end up
+   * black. */
+  constexpr int batchSize = 20;
+  constexpr int tolerance = 0x20;
+  for (int batch = 0; batch < k_numberOfPoints; batch += batchSize) {
+    stamp_points(CurveView::StampAtLocation, pixels, x + batch, y + batch, batchSize, thick);
+    stamp_points(reference_stamp_at_location, referencePixels, x + batch, y + batch, batchSize, thick);
+    for (int i = 0; i < k_stampBufferWidth*k_stampBufferHeight; i++) {
+      quiz_assert(abs(pixels[i].red() - referencePixels[i].red()) <= tolerance);
+      quiz_assert(abs(pixels[i].green() - referencePixels[i].green()) <= tolerance);
+      quiz_assert(abs(pixels[i].blue() - referencePixels[i].blue()) <= tolerance);
+    }
+  }
+}
+
+QUIZ_CASE(graph_stamp_precomputed_masks) {
+  assert_stamps_look_like_reference(false);
+  assert_stamps_look_like_reference(true);
+}
+
+QUIZ_CASE(graph_stamp_benchmark) {
+  // Timings are printed but not checked, as they depend on the machine load
+  constexpr int numberOfRuns = 100;
+  KDColor pixels[k_stampBufferWidth*k_stampBufferHeight];
+  float x[k_numberOfPoints];
+  float y[k_numberOfPoints];
+  fill_curve_points(x, y, k_numberOfPoints);
+  StampFunction stamps[] = {CurveView::StampAtLocation, reference_stamp_at_location};
+  const char * names[] = {"Precomputed masks, thin then thick", "Float interpolation, thin then thick"};
+  for (int s = 0; s < 2; s++) {
+    quiz_print(names[s]);
+    for (int thick = 0; thick < 2; thick++) {
+      uint64_t startTime = quiz_stopwatch_start();
+      for (int i = 0; i < numberOfRuns; i++) {
+        stamp_points(stamps[s], pixels, x, y, k_numberOfPoints, thick);
+      }
+      quiz_stopwatch_print_lap(startTime);
+    }
+  }
+}
+
+}
@@ -184,6 +184,18 @@ I18n::Message ContinuousFunction::ParameterMessageForPlotType(PlotType plotType)
   return I18n::Message::T;
 }
 
+template <typename T>
+static T polarAngleFactor() {
+  Preferences::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
+  if (angleUnit == Preferences::AngleUnit::Degree) {
+    return (T) (M_PI/180.0);
+  } else if (angleUnit == Preferences::AngleUnit::Gradian) {
+    return (T) (M_PI/200.0);
+  }
+  assert(angleUnit == Preferences::AngleUnit::Radian);
+  return (T)1.0;
+}
+
 template <typename T>
 Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t, Poincare::Context * context) const {
   Coordinate2D<T> x1x2 = templatedApproximateAtParameter(t, context);
@@ -192,19 +204,62 @@ Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t,
     return x1x2;
   }
   assert(type == PlotType::Polar);
-  T factor = (T)1.0;
-  Preferences::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
-  if (angleUnit == Preferences::AngleUnit::Degree) {
-    factor = (T) (M_PI/180.0);
-  } else if (angleUnit == Preferences::AngleUnit::Gradian) {
-    factor = (T) (M_PI/200.0);
-  } else {
-    assert(angleUnit == Preferences::AngleUnit::Radian);
-  }
-  const float angle = x1x2.x1()*factor;
+  const float angle = x1x2.x1()*polarAngleFactor<T>();
   return Coordinate2D<T>(x1x2.x2() * std::cos(angle), x1x2.x2() * std::sin(angle));
 }
 
+bool ContinuousFunction::isCompiled(Poincare::Context * context) const {
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  const CompiledExpression * compiledExpressions = m_model.compiledExpressions(expressionReduced(context), unknown, context);
+  return !compiledExpressions[0].isUninitialized() && (plotType() != PlotType::Parametric || !compiledExpressions[1].isUninitialized());
+}
+
+void ContinuousFunction::privateEvaluateXYAtParameters(const float * t, float * x, float * y, int n, Poincare::Context * context) const {
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  PlotType type = plotType();
+  const CompiledExpression * compiledExpressions = m_model.compiledExpressions(expressionReduced(context), unknown, context);
+  const DensePolynomial & polynomial = m_model.polynomial(expressionReduced(context), unknown, context);
+  /* Horner's scheme is cheaper than the compiled program, but it is only used
+   * where its rounding errors are negligible. */
+  bool useHornerScheme = type != PlotType::Parametric && !polynomial.isUninitialized() && polynomial.hasRealCoefficients()
+    && polynomial.approximateBatchWithValueForSymbol(t, y, n);
+  if (!useHornerScheme && (compiledExpressions[0].isUninitialized() || (type == PlotType::Parametric && compiledExpressions[1].isUninitialized()))) {
+    for (int i = 0; i < n; i++) {
+      Coordinate2D<float> xy = privateEvaluateXYAtParameter(t[i], context);
+      x[i] = xy.x1();
+      y[i] = xy.x2();
+    }
+    return;
+  }
+  // Approximate the whole column of parameters in one go
+  if (type == PlotType::Parametric) {
+    compiledExpressions[0].approximateBatchWithValueForSymbol(t, x, n);
+    compiledExpressions[1].approximateBatchWithValueForSymbol(t, y, n);
+  } else if (!useHornerScheme) {
+    compiledExpressions[0].approximateBatchWithValueForSymbol(t, y, n);
+  }
+  const float tMin = this->tMin();
+  const float tMax = this->tMax();
+  const float factor = polarAngleFactor<float>();
+  for (int i = 0; i < n; i++) {
+    if (t[i] < tMin || t[i] > tMax) {
+      x[i] = type == PlotType::Cartesian ? t[i] : NAN;
+      y[i] = NAN;
+    } else if (type == PlotType::Cartesian) {
+      x[i] = t[i];
+    } else if (type == PlotType::Polar) {
+      const float angle = t[i]*factor;
+      const float radius = y[i];
+      x[i] = radius * std::cos(angle);
+      y[i] = radius * std::sin(angle);
+    }
+  }
+}
+
 bool ContinuousFunction::displayDerivative() const {
   return recordData()->displayDerivative();
 }
@@ -236,6 +291,14 @@ double ContinuousFunction::approximateDerivative(double x, Poincare::Context * c
   if (x < tMin() || x > tMax()) {
     return NAN;
   }
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  const CompiledExpression * compiledExpressions = m_model.compiledExpressions(expressionReduced(context), unknown, context);
+  double result;
+  if (!compiledExpressions[0].isUninitialized() && compiledExpressions[0].approximateDerivative(x, &result)) {
+    return result;
+  }
   Poincare::Derivative derivative = Poincare::Derivative::Builder(expressionReduced(context).clone(), Symbol::Builder(UCodePointUnknown), Poincare::Float<double>::Builder(x)); // derivative takes ownership of Poincare::Float<double>::Builder(x) and the clone of expression
   /* TODO: when we approximate derivative, we might want to simplify the
    * derivative here. However, we might want to do it once for all x (to avoid
@@ -331,12 +394,51 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
   return record->value().size-sizeof(RecordDataBuffer);
 }
 
+void ContinuousFunction::Model::tidy() const {
+  ExpressionModel::tidy();
+  m_hasCompiledExpressions = false;
+}
+
+const CompiledExpression * ContinuousFunction::Model::compiledExpressions(const Expression reducedExpression, const char * symbol, Context * context) const {
+  /* The compiled expressions live as long as the reduced expression they are
+   * built from, which is cleared by tidy. */
+  if (!m_hasCompiledExpressions) {
+    Preferences * preferences = Preferences::sharedPreferences();
+    bool parametric = reducedExpression.type() == ExpressionNode::Type::Matrix;
+    for (int i = 0; i < 2; i++) {
+      if (i > 0 && !parametric) {
+        m_compiledExpressions[i] = CompiledExpression();
+        break;
+      }
+      Expression e = parametric ? reducedExpression.childAtIndex(i) : reducedExpression;
+      Preferences::ComplexFormat complexFormat = Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+      m_compiledExpressions[i] = CompiledExpression::Compile(e, symbol, context, complexFormat, preferences->angleUnit());
+      m_polynomial = parametric ? DensePolynomial() : DensePolynomial::Build(e, symbol, context, complexFormat, preferences->angleUnit());
+    }
+    m_hasCompiledExpressions = true;
+  }
+  return m_compiledExpressions;
+}
+
+const DensePolynomial & ContinuousFunction::Model::polynomial(const Expression reducedExpression, const char * symbol, Context * context) const {
+  compiledExpressions(reducedExpression, symbol, context);
+  return m_polynomial;
+}
+
 ContinuousFunction::RecordDataBuffer * ContinuousFunction::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
   return reinterpret_cast<RecordDataBuffer *>(const_cast<void *>(d.buffer));
 }
 
+template<typename T>
+static T approximateWithValueForSymbol(const CompiledExpression & compiledExpression, const Expression e, const char * symbol, T x, Context * context) {
+  if (compiledExpression.isUninitialized()) {
+    return PoincareHelpers::ApproximateWithValueForSymbol(e, symbol, x, context);
+  }
+  return compiledExpression.approximateWithValueForSymbol(x);
+}
+
 template<typename T>
 Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincare::Context * context) const {
   if (t < tMin() || t > tMax()) {
@@ -347,16 +449,17 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
   Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
   PlotType type = plotType();
   Expression e = expressionReduced(context);
+  const CompiledExpression * compiledExpressions = m_model.compiledExpressions(e, unknown, context);
   if (type != PlotType::Parametric) {
     assert(type == PlotType::Cartesian || type == PlotType::Polar);
-    return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(e, unknown, t, context));
+    return Coordinate2D<T>(t, approximateWithValueForSymbol(compiledExpressions[0], e, unknown, t, context));
   }
   assert(e.type() == ExpressionNode::Type::Matrix);
   assert(static_cast<Poincare::Matrix&>(e).numberOfRows() == 2);
   assert(static_cast<Poincare::Matrix&>(e).numberOfColumns() == 1);
   return Coordinate2D<T>(
-      PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(0), unknown, t, context),
-      PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(1), unknown, t, context));
+      approximateWithValueForSymbol(compiledExpressions[0], e.childAtIndex(0), unknown, t, context),
+      approximateWithValueForSymbol(compiledExpressions[1], e.childAtIndex(1), unknown, t, context));
 }
 
 Coordinate2D<double> ContinuousFunction::nextMinimumFrom(double start, double step, double max, Context * context) const {
@@ -388,6 +491,15 @@ Coordinate2D<double> ContinuousFunction::nextIntersectionFrom(double start, doub
   return PoincareHelpers::NextIntersection(expressionReduced(context), unknownX, start, step, max, context, e);
 }
 
+void ContinuousFunction::pointsOfInterestBetween(double start, double end, double step, Context * context, Solver::PointsOfInterest * points) const {
+  assert(plotType() == PlotType::Cartesian);
+  assert(tMin() <= start && end <= tMax());
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknownX[bufferSize];
+  SerializationHelper::CodePoint(unknownX, bufferSize, UCodePointUnknown);
+  PoincareHelpers::AllPointsOfInterest(expressionReduced(context), unknownX, start, end, step, context, points);
+}
+
 Coordinate2D<double> ContinuousFunction::nextPointOfInterestFrom(double start, double step, double max, Context * context, ComputePointOfInterest compute) const {
   assert(plotType() == PlotType::Cartesian);
   constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
@@ -419,11 +531,7 @@ Ion::Storage::Record::ErrorStatus ContinuousFunction::setContent(const char * c,
 }
 
 bool ContinuousFunction::basedOnCostlyAlgorithms(Context * context) const {
-  return expressionReduced(context).hasExpression([](const Expression e, const void * context) {
-        return e.type() == ExpressionNode::Type::Sequence
-            || e.type() == ExpressionNode::Type::Integral
-            || e.type() == ExpressionNode::Type::Derivative;
-      }, nullptr);
+  return expressionReduced(context).hasDescendantWithProperty(ExpressionNode::Property::CostlyAlgorithm);
 }
 
 template Coordinate2D<float> ContinuousFunction::templatedApproximateAtParameter<float>(float, Poincare::Context *) const;
@@ -13,8 +13,11 @@
 #include "continuous_function_cache.h"
 #include "function.h"
 #include "range_1D.h"
+#include <poincare/compiled_expression.h>
+#include <poincare/dense_polynomial.h>
 #include <poincare/symbol.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/solver.h>
 
 namespace Shared {
 
@@ -78,8 +81,12 @@ public:
   // Roots
   Poincare::Coordinate2D<double> nextRootFrom(double start, double step, double max, Poincare::Context * context) const;
   Poincare::Coordinate2D<double> nextIntersectionFrom(double start, double step, double max, Poincare::Context * context, Poincare::Expression e, double eDomainMin = -INFINITY, double eDomainMax = INFINITY) const;
+  // Roots and extrema on [start, end], computed in a single sweep
+  void pointsOfInterestBetween(double start, double end, double step, Poincare::Context * context, Poincare::Solver::PointsOfInterest * points) const;
   // Integral
   Poincare::Expression sumBetweenBounds(double start, double end, Poincare::Context * context) const override;
+  // Integrals, derivatives and sequences are slow to approximate
+  bool basedOnCostlyAlgorithms(Poincare::Context * context) const;
 
   // Cache
   ContinuousFunctionCache * cache() const { return m_cache; }
@@ -90,10 +97,13 @@ private:
   typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(Poincare::Expression e, char * symbol, double start, double step, double max, Poincare::Context * context);
   Poincare::Coordinate2D<double> nextPointOfInterestFrom(double start, double step, double max, Poincare::Context * context, ComputePointOfInterest compute) const;
   template <typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context) const;
+  // Whether each coordinate of the function has a compiled program
+  bool isCompiled(Poincare::Context * context) const;
+  // Set (x[i], y[i]) to privateEvaluateXYAtParameter(t[i]) for 0 <= i < n
+  void privateEvaluateXYAtParameters(const float * t, float * x, float * y, int n, Poincare::Context * context) const;
   void didBecomeInactive() override { m_cache = nullptr; }
 
   void fullXYRange(float * xMin, float * xMax, float * yMin, float * yMax, Poincare::Context * context) const;
-  bool basedOnCostlyAlgorithms(Poincare::Context * context) const;
 
   /* RecordDataBuffer is the layout of the data buffer of Record
    * representing a ContinuousFunction. See comment on
@@ -123,9 +133,21 @@ private:
     //char m_expression[0];
   };
   class Model : public ExpressionModel {
+  public:
+    Model() : ExpressionModel(), m_hasCompiledExpressions(false) {}
+    void tidy() const override;
+    /* The reduced expression, or each of its coordinates for parametric
+     * functions, compiled to be approximated at many parameters. */
+    const Poincare::CompiledExpression * compiledExpressions(const Poincare::Expression reducedExpression, const char * symbol, Poincare::Context * context) const;
+    /* The coefficients of the reduced expression if it is a polynomial of the
+     * symbol, for cartesian and polar functions. */
+    const Poincare::DensePolynomial & polynomial(const Poincare::Expression reducedExpression, const char * symbol, Poincare::Context * context) const;
   private:
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    mutable Poincare::CompiledExpression m_compiledExpressions[2];
+    mutable Poincare::DensePolynomial m_polynomial;
+    mutable bool m_hasCompiledExpressions;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
@@ -7,15 +7,17 @@ namespace Shared {
 constexpr int ContinuousFunctionCache::k_sizeOfCache;
 constexpr float ContinuousFunctionCache::k_cacheHitTolerance;
 constexpr int ContinuousFunctionCache::k_numberOfAvailableCaches;
+constexpr int ContinuousFunctionCache::k_batchSize;
+constexpr int ContinuousFunctionCache::k_numberOfComputedFlags;
 
 // public
 void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCache * cache, float tMin, float tStep) {
   ContinuousFunction * function = static_cast<ContinuousFunction *>(fun);
 
   if (!cache) {
-    /* ContinuousFunctionStore::cacheAtIndex has returned a nullptr : the index
-     * of the function we are trying to draw is greater than the number of
-     * available caches, so we just tell the function to not lookup any cache. */
+    /* ContinuousFunctionStore::cacheForRecord has returned a nullptr: all the
+     * caches are used by other functions being drawn, so we just tell the
+     * function to not lookup any cache. */
     function->setCache(nullptr);
     return;
   }
@@ -44,6 +46,7 @@ void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCa
 void ContinuousFunctionCache::clear() {
   m_startOfCache = 0;
   m_tStep = 0;
+  m_lastRequestedIndex = -1;
   invalidateBetween(0, k_sizeOfCache);
 }
 
@@ -55,6 +58,11 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valueForParameter(const C
   return valuesAtIndex(function, context, t, resIndex);
 }
 
+bool ContinuousFunctionCache::isComputedAtParameter(const ContinuousFunction * function, float t) const {
+  int index = indexForParameter(function, t);
+  return index >= 0 && isComputed(index);
+}
+
 void ContinuousFunctionCache::ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin) {
   // Expected step length
   *tStep = (tMax - tMin) / Graph::GraphView::k_graphStepDenominator;
@@ -85,12 +93,14 @@ void ContinuousFunctionCache::ComputeNonCartesianSteps(float * tStep, float * tC
 void ContinuousFunctionCache::invalidateBetween(int iInf, int iSup) {
   for (int i = iInf; i < iSup; i++) {
     m_cache[i] = NAN;
+    m_computed[i / 32] &= ~(static_cast<uint32_t>(1) << (i % 32));
   }
 }
 
 void ContinuousFunctionCache::setRange(ContinuousFunction * function, float tMin, float tStep) {
   m_tMin = tMin;
   m_tStep = tStep;
+  m_lastRequestedIndex = -1;
 }
 
 int ContinuousFunctionCache::indexForParameter(const ContinuousFunction * function, float t) const {
@@ -110,20 +120,58 @@ int ContinuousFunctionCache::indexForParameter(const ContinuousFunction * functi
 }
 
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i) {
+  int index = (i - m_startOfCache + k_sizeOfCache) % k_sizeOfCache;
+  int stride = m_lastRequestedIndex < 0 ? 0 : index - m_lastRequestedIndex;
+  m_lastRequestedIndex = index;
+  if (!isComputed(i)) {
+    computeValuesFromIndex(function, context, t, i, stride);
+  }
+  assert(isComputed(i));
   if (function->plotType() == ContinuousFunction::PlotType::Cartesian) {
-    if (std::isnan(m_cache[i])) {
-      m_cache[i] = function->privateEvaluateXYAtParameter(t, context).x2();
-    }
     return Poincare::Coordinate2D<float>(t, m_cache[i]);
   }
-  if (std::isnan(m_cache[2 * i]) || std::isnan(m_cache[2 * i + 1])) {
-    Poincare::Coordinate2D<float> res = function->privateEvaluateXYAtParameter(t, context);
-    m_cache[2 * i] = res.x1();
-    m_cache[2 * i + 1] = res.x2();
-  }
   return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
 }
 
+void ContinuousFunctionCache::computeValuesFromIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i, int stride) {
+  /* Curves are drawn with increasing parameters, so the points following a
+   * cache miss with the same stride as the previous request are likely to be
+   * required next. The uncomputed ones are approximated in one batch.
+   * Functions without a compiled program are approximated on their tree,
+   * point by point: the batch would not be faster, and would compute points
+   * that may never be drawn. */
+  bool cartesian = function->plotType() == ContinuousFunction::PlotType::Cartesian;
+  int numberOfPoints = cartesian ? k_sizeOfCache : k_sizeOfCache / 2;
+  int numberOfCandidates = stride > 0 && function->isCompiled(context) ? k_batchSize : 1;
+  int index = (i - m_startOfCache + k_sizeOfCache) % k_sizeOfCache;
+  float parameters[k_batchSize];
+  int indexes[k_batchSize];
+  float xs[k_batchSize];
+  float ys[k_batchSize];
+  parameters[0] = t;
+  indexes[0] = i;
+  int n = 1;
+  for (int k = 1; k < numberOfCandidates && index + k * stride < numberOfPoints; k++) {
+    int j = (i + k * stride) % k_sizeOfCache;
+    if (!isComputed(j)) {
+      parameters[n] = m_tMin + (index + k * stride) * m_tStep;
+      indexes[n] = j;
+      n++;
+    }
+  }
+  function->privateEvaluateXYAtParameters(parameters, xs, ys, n, context);
+  for (int k = 0; k < n; k++) {
+    int j = indexes[k];
+    if (cartesian) {
+      m_cache[j] = ys[k];
+    } else {
+      m_cache[2 * j] = xs[k];
+      m_cache[2 * j + 1] = ys[k];
+    }
+    setComputed(j);
+  }
+}
+
 void ContinuousFunctionCache::pan(ContinuousFunction * function, float newTMin) {
   assert(function->plotType() == ContinuousFunction::PlotType::Cartesian);
   if (newTMin == m_tMin) {
@@ -5,6 +5,7 @@
 #include <ion/display.h>
 #include <poincare/context.h>
 #include <poincare/coordinate_2D.h>
+#include <stdint.h>
 
 namespace Shared {
 
@@ -12,7 +13,10 @@ class ContinuousFunction;
 
 class ContinuousFunctionCache {
 public:
-  static constexpr int k_numberOfAvailableCaches = 2;
+  /* One cache per memoized function. The caches are owned by the Graph App,
+   * which shares its buffer with bigger apps, so they do not take up any
+   * permanent RAM. */
+  static constexpr int k_numberOfAvailableCaches = 10;
 
   static void PrepareForCaching(void * fun, ContinuousFunctionCache * cache, float tMin, float tStep);
 
@@ -21,6 +25,7 @@ public:
   float step() const { return m_tStep; }
   void clear();
   Poincare::Coordinate2D<float> valueForParameter(const ContinuousFunction * function, Poincare::Context * context, float t);
+  bool isComputedAtParameter(const ContinuousFunction * function, float t) const;
   // Sets step parameters for non-cartesian curves
   static void ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin);
 private:
@@ -36,19 +41,34 @@ private:
    * The value 128*FLT_EPSILON has been found to be the lowest for which all
    * indices verify indexForParameter(tMin + index * tStep) = index. */
   static constexpr float k_cacheHitTolerance = 128.0f * FLT_EPSILON;
+  /* On a cache miss, the following uncomputed points are approximated
+   * together, up to k_batchSize points spaced as the last two requested
+   * points. */
+  static constexpr int k_batchSize = 32;
+  static constexpr int k_numberOfComputedFlags = (k_sizeOfCache + 31) / 32;
 
   void invalidateBetween(int iInf, int iSup);
   void setRange(ContinuousFunction * function, float tMin, float tStep);
   int indexForParameter(const ContinuousFunction * function, float t) const;
   Poincare::Coordinate2D<float> valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i);
+  void computeValuesFromIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i, int stride);
+  bool isComputed(int i) const { return m_computed[i / 32] & (static_cast<uint32_t>(1) << (i % 32)); }
+  void setComputed(int i) { m_computed[i / 32] |= static_cast<uint32_t>(1) << (i % 32); }
   void pan(ContinuousFunction * function, float newTMin);
 
   float m_tMin, m_tStep;
   float m_cache[k_sizeOfCache];
+  /* NAN is a legitimate value of the functions, so the computed entries are
+   * tracked separately. Bit i is set once the point at index i is known. */
+  uint32_t m_computed[k_numberOfComputedFlags];
   /* m_startOfCache is used to implement a circular buffer for easy panning
    * with cartesian functions. When dealing with parametric or polar functions,
    * m_startOfCache should be zero.*/
   int m_startOfCache;
+  /* Index of the last requested point, counted from m_tMin, or -1. Curves
+   * are first drawn with a coarser step when they are costly: the stride
+   * between requested points is then larger than one. */
+  int m_lastRequestedIndex;
 };
 
 }
@@ -1,6 +1,7 @@
 #include "curve_view.h"
 #include "../constant.h"
 #include "dots.h"
+#include "stamps.h"
 #include <poincare/print_float.h>
 #include <assert.h>
 #include <string.h>
@@ -8,6 +9,7 @@
 #include <cmath>
 #include <float.h>
 #include <escher/palette.h>
+#include <escher/timer_manager.h>
 #include <complex>
 #include <poincare/trigonometry.h>
 
@@ -25,27 +27,155 @@ CurveView::CurveView(CurveViewRange * curveViewRange, CurveViewCursor * curveVie
   m_okView(okView),
   m_forceOkDisplay(false),
   m_mainViewSelected(false),
-  m_drawnRangeVersion(0)
+  m_drawnRangeVersion(0),
+  m_drawnXMin(NAN),
+  m_drawnXMax(NAN),
+  m_drawnYMin(NAN),
+  m_drawnYMax(NAN),
+  m_drawnHorizontalLabelsMaxGlyphLength(0),
+  m_drawnLabelsCanBeScrolled(false),
+  m_refinementTimer(this),
+  m_drawingPass(k_numberOfDrawingPasses - 1),
+  m_isRefiningDrawing(false),
+  m_drawingInterrupted(false)
 {
 }
 
+CurveView::~CurveView() {
+  stopProgressiveDrawing();
+}
+
 void CurveView::reload() {
   uint32_t rangeVersion = m_curveViewRange->rangeChecksum();
   if (m_drawnRangeVersion != rangeVersion) {
     // FIXME: This should also be called if the *curve* changed
     m_drawnRangeVersion = rangeVersion;
-    KDCoordinate bannerHeight = (m_bannerView != nullptr) ? m_bannerView->bounds().height() : 0;
-    markRectAsDirty(KDRect(0, 0, bounds().width(), bounds().height() - bannerHeight));
     if (label(Axis::Horizontal, 0) != nullptr) {
       computeLabels(Axis::Horizontal);
     }
     if (label(Axis::Vertical, 0) != nullptr) {
       computeLabels(Axis::Vertical);
     }
+    KDRect curvesRect = this->curvesRect();
+    /* If the range was only panned, the pixels already drawn are moved and
+     * only the strip they uncover is redrawn. */
+    bool labelsCanBeScrolled = this->labelsCanBeScrolled();
+    int horizontalLabelsMaxGlyphLength = label(Axis::Horizontal, 0) != nullptr ? maxLabelGlyphLength(Axis::Horizontal) : 0;
+    KDPoint offset = KDPointZero;
+    if (labelsCanBeScrolled && m_drawnLabelsCanBeScrolled
+        && horizontalLabelsMaxGlyphLength == m_drawnHorizontalLabelsMaxGlyphLength
+        && scrollOffset(&offset)) {
+      scrollRect(curvesRect, offset);
+    } else {
+      markRectAsDirty(curvesRect);
+      startProgressiveDrawing();
+    }
+    m_drawnXMin = m_curveViewRange->xMin();
+    m_drawnXMax = m_curveViewRange->xMax();
+    m_drawnYMin = m_curveViewRange->yMin();
+    m_drawnYMax = m_curveViewRange->yMax();
+    m_drawnHorizontalLabelsMaxGlyphLength = horizontalLabelsMaxGlyphLength;
+    m_drawnLabelsCanBeScrolled = labelsCanBeScrolled;
   }
   layoutSubviews();
 }
 
+KDRect CurveView::curvesRect() const {
+  KDCoordinate bannerHeight = (m_bannerView != nullptr) ? m_bannerView->bounds().height() : 0;
+  return KDRect(0, 0, bounds().width(), bounds().height() - bannerHeight);
+}
+
+void CurveView::startProgressiveDrawing() {
+  if (!drawsCurvesProgressively()) {
+    stopProgressiveDrawing();
+    return;
+  }
+  m_drawingPass = 0;
+  m_drawingInterrupted = false;
+  if (!m_isRefiningDrawing) {
+    m_refinementTimer.setNext(nullptr);
+    TimerManager::AddTimer(&m_refinementTimer);
+    m_isRefiningDrawing = true;
+  }
+  m_refinementTimer.reset();
+}
+
+void CurveView::stopProgressiveDrawing() {
+  m_drawingPass = k_numberOfDrawingPasses - 1;
+  m_drawingInterrupted = false;
+  if (m_isRefiningDrawing) {
+    TimerManager::RemoveTimer(&m_refinementTimer);
+    m_isRefiningDrawing = false;
+  }
+}
+
+bool CurveView::refineDrawing() {
+  // An interrupted pass is drawn again
+  if (!m_drawingInterrupted) {
+    if (isLastDrawingPass()) {
+      stopProgressiveDrawing();
+      return false;
+    }
+    m_drawingPass++;
+  }
+  m_drawingInterrupted = false;
+  markRectAsDirty(curvesRect());
+  return true;
+}
+
+bool CurveView::drawingShouldBeInterrupted() const {
+  /* The refinement passes give way to the key presses, which are handled
+   * before the pass is drawn again. The first pass is never interrupted so
+   * that the curves are still previewed while a key is held down. */
+  if (!m_isRefiningDrawing || m_drawingPass == 0) {
+    return false;
+  }
+  if (!m_drawingInterrupted) {
+    m_drawingInterrupted = Ion::Keyboard::scan() != 0;
+  }
+  return m_drawingInterrupted;
+}
+
+bool CurveView::scrollOffset(KDPoint * offset) const {
+  /* The drawn pixels can be moved if the range was translated by a whole
+   * number of pixels. The tolerance absorbs the rounding errors of the range
+   * bounds, which InteractiveCurveViewRange pans by whole pixels. */
+  constexpr float tolerance = 0.01f;
+  const float horizontalOffset = (m_drawnXMin - m_curveViewRange->xMin()) / pixelWidth();
+  const float verticalOffset = (m_curveViewRange->yMax() - m_drawnYMax) / pixelHeight();
+  const float widthDifference = (m_curveViewRange->xMax() - m_curveViewRange->xMin() - m_drawnXMax + m_drawnXMin) / pixelWidth();
+  const float heightDifference = (m_curveViewRange->yMax() - m_curveViewRange->yMin() - m_drawnYMax + m_drawnYMin) / pixelHeight();
+  if (!(std::fabs(widthDifference) < tolerance && std::fabs(heightDifference) < tolerance
+        && std::fabs(horizontalOffset - std::round(horizontalOffset)) < tolerance
+        && std::fabs(verticalOffset - std::round(verticalOffset)) < tolerance
+        && std::fabs(horizontalOffset) < bounds().width()
+        && std::fabs(verticalOffset) < bounds().height())) {
+    return false;
+  }
+  *offset = KDPoint(std::round(horizontalOffset), std::round(verticalOffset));
+  return *offset != KDPointZero;
+}
+
+bool CurveView::labelsCanBeScrolled() const {
+  /* Labels move with the curves, unless they float on an edge of the view or
+   * only the extrema horizontal labels are written. As long as their maximal
+   * length does not change, they are then written the same way. */
+  if (floatingLabelsPosition(Axis::Horizontal, false, false, 0) != FloatingPosition::None
+      || floatingLabelsPosition(Axis::Vertical, false, false, 0) != FloatingPosition::None) {
+    return false;
+  }
+  if (label(Axis::Horizontal, 0) == nullptr) {
+    return true;
+  }
+  int numberOfHorizontalLabels = numberOfLabels(Axis::Horizontal);
+  for (int i = 0; i < numberOfHorizontalLabels; i++) {
+    if (label(Axis::Horizontal, i)[0] == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool CurveView::isMainViewSelected() const {
   return m_mainViewSelected;
 }
@@ -198,6 +328,14 @@ int CurveView::numberOfLabels(Axis axis) const {
   return numberOfLabels;
 }
 
+int CurveView::maxLabelGlyphLength(Axis axis) const {
+  if (axis == Axis::Horizontal) {
+    float pixelsPerLabel = std::max(0.0f, ((float)Ion::Display::Width)/((float)numberOfLabels(axis)) - k_labelMargin);
+    return std::min<int>(labelMaxGlyphLengthSize(), pixelsPerLabel/k_font->glyphSize().width());
+  }
+  return labelMaxGlyphLengthSize();
+}
+
 void CurveView::computeLabels(Axis axis) {
   float step = gridUnit(axis);
   int axisLabelsCount = numberOfLabels(axis);
@@ -205,11 +343,7 @@ void CurveView::computeLabels(Axis axis) {
     float labelValue = labelValueAtIndex(axis, i);
     /* Label cannot hold more than k_labelBufferMaxGlyphLength characters to prevent
      * them from overprinting one another.*/
-    int labelMaxGlyphLength = labelMaxGlyphLengthSize();
-    if (axis == Axis::Horizontal) {
-      float pixelsPerLabel = std::max(0.0f, ((float)Ion::Display::Width)/((float)axisLabelsCount) - k_labelMargin);
-      labelMaxGlyphLength = std::min<int>(labelMaxGlyphLengthSize(), pixelsPerLabel/k_font->glyphSize().width());
-    }
+    int labelMaxGlyphLength = maxLabelGlyphLength(axis);
 
     if (labelValue < step && labelValue > -step) {
       // Make sure the 0 value is really written 0
@@ -290,11 +424,23 @@ void CurveView::drawLabel(KDContext * ctx, KDRect rect, float xPosition, float y
   }
 }
 
-enum class FloatingPosition : uint8_t {
-  None,
-  Min,
-  Max
-};
+CurveView::FloatingPosition CurveView::floatingLabelsPosition(Axis axis, bool graduationOnly, bool fixCoordinate, KDCoordinate fixedCoordinate) const {
+  if (axis == Axis::Horizontal) {
+    float verticalCoordinate = fixCoordinate ? fixedCoordinate : std::round(floatToPixel(Axis::Vertical, 0.0f));
+    KDCoordinate viewHeight = bounds().height() - (bannerIsVisible() ? m_bannerView->minimalSizeForOptimalDisplay().height() : 0);
+    KDCoordinate maximalVerticalPosition = graduationOnly ? viewHeight : viewHeight - k_font->glyphSize().height() - k_labelMargin;
+    if (verticalCoordinate > maximalVerticalPosition) {
+      return FloatingPosition::Max;
+    }
+    return max(Axis::Vertical) < 0.0f ? FloatingPosition::Min : FloatingPosition::None;
+  }
+  float horizontalCoordinate = fixCoordinate ? fixedCoordinate : std::round(floatToPixel(Axis::Horizontal, 0.0f));
+  KDCoordinate minimalHorizontalPosition = graduationOnly ? 0 : k_labelMargin + k_font->glyphSize().width() * 3; // We want do display at least 3 characters left of the Y axis
+  if (horizontalCoordinate < minimalHorizontalPosition) {
+    return FloatingPosition::Min;
+  }
+  return max(Axis::Horizontal) < 0.0f ? FloatingPosition::Max : FloatingPosition::None;
+}
 
 void CurveView::drawLabelsAndGraduations(KDContext * ctx, KDRect rect, Axis axis, bool shiftOrigin, bool graduationOnly, bool fixCoordinate, KDCoordinate fixedCoordinate, KDColor backgroundColor) const {
   int numberLabels = numberOfLabels(axis);
@@ -309,25 +455,8 @@ void CurveView::drawLabelsAndGraduations(KDContext * ctx, KDRect rect, Axis axis
 
   /* If the axis is not visible, draw floating labels on the edge of the screen.
    * The X axis floating status is needed when drawing both axes labels. */
-  FloatingPosition floatingHorizontalLabels = FloatingPosition::None;
-  KDCoordinate maximalVerticalPosition = graduationOnly ? viewHeight : viewHeight - k_font->glyphSize().height() - k_labelMargin;
-  if (verticalCoordinate > maximalVerticalPosition) {
-    floatingHorizontalLabels = FloatingPosition::Max;
-  } else if (max(Axis::Vertical) < 0.0f) {
-    floatingHorizontalLabels = FloatingPosition::Min;
-  }
-
-  FloatingPosition floatingLabels = FloatingPosition::None;
-  if (axis == Axis::Horizontal) {
-    floatingLabels = floatingHorizontalLabels;
-  } else {
-    KDCoordinate minimalHorizontalPosition = graduationOnly ? 0 : k_labelMargin + k_font->glyphSize().width() * 3; // We want do display at least 3 characters left of the Y axis
-    if (horizontalCoordinate < minimalHorizontalPosition) {
-      floatingLabels = FloatingPosition::Min;
-    } else if (max(Axis::Horizontal) < 0.0f) {
-      floatingLabels = FloatingPosition::Max;
-    }
-  }
+  FloatingPosition floatingHorizontalLabels = floatingLabelsPosition(Axis::Horizontal, graduationOnly, fixCoordinate, fixedCoordinate);
+  FloatingPosition floatingLabels = axis == Axis::Horizontal ? floatingHorizontalLabels : floatingLabelsPosition(Axis::Vertical, graduationOnly, fixCoordinate, fixedCoordinate);
 
   /* There might be less labels than graduations, if the extrema labels are too
    * close to the screen edge to write them. We must thus draw the graduations
@@ -572,58 +701,72 @@ void CurveView::drawAxis(KDContext * ctx, KDRect rect, Axis axis) const {
   drawLine(ctx, rect, axis, 0.0f, Palette::PrimaryText, 1);
 }
 
-constexpr KDCoordinate thinCircleDiameter = 1;
-constexpr KDCoordinate thinStampSize = thinCircleDiameter+1;
-const uint8_t thinStampMask[(thinStampSize+1)*(thinStampSize+1)] = {
-  0xFF, 0xE1, 0xFF,
-  0xE1, 0x00, 0xE1,
-  0xFF, 0xE1, 0xFF,
-};
+/* A stamp shifted by (dx, dy), with 0 <= dx, dy <= 1, is a bilinear
+ * interpolation of the four pixels of stampMask covering each of its pixels.
+ * The shifts are rounded to 1/k_stampSubdivisions of a pixel, so that all the
+ * shifted masks are computed at compile time. ShiftedStampMasks stores them in
+ * flash one after the other, the mask shifted by (shiftX, shiftY) subdivisions
+ * being at index shiftY*k_numberOfStampShifts+shiftX. */
+constexpr int k_stampSubdivisions = 8;
+constexpr int k_numberOfStampShifts = k_stampSubdivisions + 1;
+
+constexpr KDCoordinate StampSize(bool thick) {
+  return thick ? Stamps::ThickStampSize : Stamps::ThinStampSize;
+}
 
-#define LINE_THICKNESS 2
+constexpr int StampNumberOfPixels(bool thick) {
+  return StampSize(thick) * StampSize(thick);
+}
 
-#if LINE_THICKNESS == 2
+constexpr int StampMaskValue(bool thick, int i, int j) {
+  return thick ? Stamps::ThickStampMask[j*(Stamps::ThickStampSize+1)+i] : Stamps::ThinStampMask[j*(Stamps::ThinStampSize+1)+i];
+}
 
-constexpr KDCoordinate thickCircleDiameter = 2;
-constexpr KDCoordinate thickStampSize = thickCircleDiameter+1;
-const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
-  0xFF, 0xE6, 0xE6, 0xFF,
-  0xE6, 0x33, 0x33, 0xE6,
-  0xE6, 0x33, 0x33, 0xE6,
-  0xFF, 0xE6, 0xE6, 0xFF,
-};
+constexpr uint8_t ShiftedStampMaskValue(bool thick, int shiftX, int shiftY, int i, int j) {
+  return ((k_stampSubdivisions - shiftX) * ((k_stampSubdivisions - shiftY) * StampMaskValue(thick, i, j) + shiftY * StampMaskValue(thick, i, j+1))
+      + shiftX * ((k_stampSubdivisions - shiftY) * StampMaskValue(thick, i+1, j) + shiftY * StampMaskValue(thick, i+1, j+1))
+      + k_stampSubdivisions * k_stampSubdivisions / 2) / (k_stampSubdivisions * k_stampSubdivisions);
+}
 
-#elif LINE_THICKNESS == 3
+constexpr uint8_t ShiftedStampMaskValueAtIndex(bool thick, int index) {
+  return ShiftedStampMaskValue(thick,
+      index / StampNumberOfPixels(thick) % k_numberOfStampShifts,
+      index / StampNumberOfPixels(thick) / k_numberOfStampShifts,
+      index % StampSize(thick),
+      index % StampNumberOfPixels(thick) / StampSize(thick));
+}
 
-constexpr KDCoordinate thickCircleDiameter = 3;
-constexpr KDCoordinate thickStampSize = thickCircleDiameter+1;
-const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x7A, 0x0C, 0x7A, 0xFF,
-  0xFF, 0x0C, 0x00, 0x0C, 0xFF,
-  0xFF, 0x7A, 0x0C, 0x7A, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+/* The tables are built with the list of their indexes. The list is made by
+ * halves so that the templates recursion stays shallow for thick stamps. */
+template<int... Indexes> struct StampIndexes {};
+template<typename Head, typename Tail> struct ConcatenateStampIndexes;
+template<int... HeadIndexes, int... TailIndexes> struct ConcatenateStampIndexes<StampIndexes<HeadIndexes...>, StampIndexes<TailIndexes...>> {
+  typedef StampIndexes<HeadIndexes..., (sizeof...(HeadIndexes) + TailIndexes)...> Type;
 };
+template<int N> struct MakeStampIndexes : ConcatenateStampIndexes<typename MakeStampIndexes<N/2>::Type, typename MakeStampIndexes<N - N/2>::Type> {};
+template<> struct MakeStampIndexes<0> { typedef StampIndexes<> Type; };
+template<> struct MakeStampIndexes<1> { typedef StampIndexes<0> Type; };
 
-#elif LINE_THICKNESS == 5
-
-constexpr KDCoordinate thickCircleDiameter = 5;
-constexpr KDCoordinate thickStampSize = thickCircleDiameter+1;
-const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF,
-  0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF,
-  0xFF, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0xFF,
-  0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF,
-  0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+template<bool Thick, typename Indexes> struct ShiftedStampMasks;
+template<bool Thick, int... Indexes> struct ShiftedStampMasks<Thick, StampIndexes<Indexes...>> {
+  static const uint8_t s_masks[sizeof...(Indexes)];
 };
+template<bool Thick, int... Indexes>
+const uint8_t ShiftedStampMasks<Thick, StampIndexes<Indexes...>>::s_masks[sizeof...(Indexes)] = {ShiftedStampMaskValueAtIndex(Thick, Indexes)...};
 
-#endif
+template<bool Thick>
+const uint8_t * ShiftedStampMask(int shiftX, int shiftY) {
+  return ShiftedStampMasks<Thick, typename MakeStampIndexes<k_numberOfStampShifts * k_numberOfStampShifts * StampNumberOfPixels(Thick)>::Type>::s_masks + (shiftY * k_numberOfStampShifts + shiftX) * StampNumberOfPixels(Thick);
+}
 
 constexpr static int k_maxNumberOfIterations = 10;
+constexpr static int k_interruptionCheckPeriod = 16;
 
 void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+  /* The passes before the last one skip columns and do not refine the
+   * segments between the dots, whose middle points are evaluated once. */
+  tStep *= 1 << (k_numberOfDrawingPasses - 1 - m_drawingPass);
+  const int maxNumberOfIterations = isLastDrawingPass() ? k_maxNumberOfIterations : 0;
   float previousT = NAN;
   float t = NAN;
   float previousX = NAN;
@@ -633,6 +776,9 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd
   int i = 0;
   bool isLastSegment = false;
   do {
+    if (i % k_interruptionCheckPeriod == 0 && drawingShouldBeInterrupted()) {
+      return;
+    }
     previousT = t;
     t = tStart + (i++) * tStep;
     if (t <= tStart) {
@@ -654,7 +800,7 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd
     if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
       drawHorizontalOrVerticalSegment(ctx, rect, Axis::Vertical, x, std::min(0.0f, y), std::max(0.0f, y), color, 1);
     }
-    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, thick, k_maxNumberOfIterations, xyDoubleEvaluation);
+    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, thick, maxNumberOfIterations, xyDoubleEvaluation);
   } while (!isLastSegment);
 }
 
@@ -846,7 +992,7 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParamet
   if (!isRightDotValid && !isLeftDotValid) {
     return;
   }
-  KDCoordinate circleDiameter = thick ? thickCircleDiameter : thinCircleDiameter;
+  KDCoordinate circleDiameter = thick ? Stamps::ThickCircleDiameter : Stamps::ThinCircleDiameter;
   if (isRightDotValid) {
     const float deltaX = pxf - puf;
     const float deltaY = pyf - pvf;
@@ -857,7 +1003,7 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParamet
       /* We need to be sure that the point is not an artifact caused by error
        * in float approximation. */
       float pvd = xyDoubleEvaluation ? floatToPixel(Axis::Vertical, static_cast<float>(xyDoubleEvaluation(u, model, context).x2())) : pvf;
-      stampAtLocation(ctx, rect, puf, pvd, color, thick);
+      StampAtLocation(ctx, rect, puf, pvd, color, thick);
       return;
     }
   }
@@ -934,7 +1080,7 @@ void CurveView::straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float
      * points. */
     float start = 0;
     float end   = 1;
-    KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
+    KDCoordinate stampSize = StampSize(thick);
     const KDCoordinate xBounds[2] = {
       static_cast<KDCoordinate>(rect.left() - stampSize),
       static_cast<KDCoordinate>(rect.right() + stampSize)
@@ -953,35 +1099,24 @@ void CurveView::straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float
     pxf =  end  * pxf + (1- end ) * puf;
     pyf =  end  * pyf + (1- end ) * pvf;
   }
-  const float deltaX = pxf - puf;
-  const float deltaY = pyf - pvf;
-  KDCoordinate circleDiameter = thick ? thickCircleDiameter : thinCircleDiameter;
-  const float normsRatio = std::sqrt(deltaX*deltaX + deltaY*deltaY) / (circleDiameter / 2.0f);
-  const float stepX = deltaX / normsRatio ;
-  const float stepY = deltaY / normsRatio;
-  const int numberOfStamps = std::floor(normsRatio);
-  for (int i = 0; i < numberOfStamps; i++) {
-    stampAtLocation(ctx, rect, puf, pvf, color, thick);
-    puf += stepX;
-    pvf += stepY;
-  }
+  ctx->drawAntialiasedLine(puf, pvf, pxf, pyf, thick ? Stamps::ThickCircleDiameter : Stamps::ThinCircleDiameter, color);
 }
 
-void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const {
+void CurveView::StampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) {
   /* The (pxf, pyf) coordinates are not generally locating the center of a
    * pixel. We use stampMask, which is one pixel wider and higher than
-   * stampSize, in order to cover stampRect without aligning the pixels. Then
-   * shiftedMask is computed so that each pixel is the average of the values of
-   * the four pixels of stampMask by which it is covered, proportionally to the
-   * area of the intersection with each of those.
+   * stampSize, in order to cover stampRect without aligning the pixels. The
+   * shifted mask blended in stampRect is the precomputed one whose pixels are
+   * the average of the values of the four pixels of stampMask by which they
+   * are covered, proportionally to the area of the intersection with each of
+   * those.
    *
    * In order to compute the coordinates (px, py) of the top-left pixel of
    * stampRect, we consider that stampMask is centered at the provided point
    * (pxf,pyf) which is then translated to the center of the top-left pixel of
    * stampMask.
    */
-  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
-  const uint8_t * stampMask = thick ? thickStampMask : thinStampMask;
+  KDCoordinate stampSize = StampSize(thick);
   pxf -= (stampSize + 1 - 1)/2.0f;
   pyf -= (stampSize + 1 - 1)/2.0f;
   const KDCoordinate px = std::ceil(pxf);
@@ -990,21 +1125,12 @@ void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float p
   if (!rect.intersects(stampRect)) {
     return;
   }
-  uint8_t shiftedMask[stampSize][stampSize];
-  KDColor workingBuffer[stampSize*stampSize];
-  const float dx = px - pxf;
-  const float dy = py - pyf;
-  /* TODO: this could be optimized by precomputing 10 or 100 shifted masks. The
-   * dx and dy would be rounded to one tenth or one hundredth to choose the
-   * right shifted mask. */
-  const KDCoordinate stampMaskSize = stampSize + 1;
-  for (int i=0; i<stampSize; i++) {
-    for (int j=0; j<stampSize; j++) {
-      shiftedMask[j][i] = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
-        + dx * (stampMask[j*stampMaskSize+(i+1)]*(1.0f-dy) + stampMask[(j+1)*stampMaskSize+(i+1)]*dy);
-    }
-  }
-  ctx->blendRectWithMask(stampRect, color, (const uint8_t *)shiftedMask, workingBuffer);
+  const int shiftX = (px - pxf) * k_stampSubdivisions + 0.5f;
+  const int shiftY = (py - pyf) * k_stampSubdivisions + 0.5f;
+  assert(0 <= shiftX && shiftX < k_numberOfStampShifts && 0 <= shiftY && shiftY < k_numberOfStampShifts);
+  const uint8_t * shiftedMask = thick ? ShiftedStampMask<true>(shiftX, shiftY) : ShiftedStampMask<false>(shiftX, shiftY);
+  KDColor workingBuffer[StampNumberOfPixels(true)];
+  ctx->blendRectWithMask(stampRect, color, shiftedMask, workingBuffer);
 }
 
 void CurveView::layoutSubviews(bool force) {
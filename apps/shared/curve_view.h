@@ -5,6 +5,7 @@
 #include "curve_view_range.h"
 #include "curve_view_cursor.h"
 #include "cursor_view.h"
+#include <escher/timer.h>
 #include <poincare/preferences.h>
 #include <poincare/coordinate_2D.h>
 #include <cmath>
@@ -29,6 +30,7 @@ public:
       CursorView * cursorView = nullptr,
       View * okView = nullptr,
       bool displayBanner = true);
+  ~CurveView();
   virtual void reload();
   // When the main view is selected, the banner view is visible
   bool isMainViewSelected() const;
@@ -42,6 +44,10 @@ public:
   float pixelWidth() const;
   float pixelHeight() const;
   float pixelLength(Axis axis) const;
+  /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
+   * function shifts the stamp (by blending adjacent pixel colors) to draw with
+   * anti alising. The shift is rounded to an eighth of a pixel. */
+  static void StampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick);
 protected:
   CurveViewRange * curveViewRange() const { return m_curveViewRange; }
   void setCurveViewRange(CurveViewRange * curveViewRange);
@@ -57,6 +63,11 @@ protected:
   constexpr static int k_maxNumberOfXLabels = CurveViewRange::k_maxNumberOfXGridUnits;
   constexpr static int k_maxNumberOfYLabels = CurveViewRange::k_maxNumberOfYGridUnits;
   constexpr static int k_externRectMargin = 2;
+  /* Costly curves are first drawn with a point every
+   * 2^(k_numberOfDrawingPasses-1) columns, and refined by each following pass
+   * until a point is drawn on every column. */
+  constexpr static int k_numberOfDrawingPasses = 3;
+  virtual bool drawsCurvesProgressively() const { return false; }
   float pixelToFloat(Axis axis, KDCoordinate p) const;
   float floatToPixel(Axis axis, float f) const;
   float floatLengthToPixelLength(Axis axis, float f) const;
@@ -126,6 +137,13 @@ protected:
   View * m_bannerView;
   CurveViewCursor * m_curveViewCursor;
 private:
+  class RefinementTimer : public Timer {
+  public:
+    RefinementTimer(CurveView * curveView) : Timer(1), m_curveView(curveView) {}
+  private:
+    bool fire() override { return m_curveView->refineDrawing(); }
+    CurveView * m_curveView;
+  };
   static constexpr const KDFont * k_font = KDFont::SmallFont;
   // returns the coordinates where should be drawn the label knowing the coordinates of its graduation and its relative position
    KDPoint positionLabel(KDCoordinate xPosition, KDCoordinate yPosition, KDSize labelSize, RelativePosition horizontalPosition, RelativePosition verticalPosition) const;
@@ -138,15 +156,28 @@ private:
   virtual char * label(Axis axis, int index) const { return nullptr; }
   virtual size_t labelMaxGlyphLengthSize() const { return k_labelBufferMaxGlyphLength; }
   int numberOfLabels(Axis axis) const;
+  int maxLabelGlyphLength(Axis axis) const;
+  enum class FloatingPosition : uint8_t {
+    None,
+    Min,
+    Max
+  };
+  FloatingPosition floatingLabelsPosition(Axis axis, bool graduationOnly, bool fixCoordinate, KDCoordinate fixedCoordinate) const;
+  // Set offset to the pixels offset of the curves since they were drawn
+  bool scrollOffset(KDPoint * offset) const;
+  bool labelsCanBeScrolled() const;
+  KDRect curvesRect() const;
+  void startProgressiveDrawing();
+  void stopProgressiveDrawing();
+  // Return true if the curves have to be redrawn by the next pass
+  bool refineDrawing();
+  bool isLastDrawingPass() const { return m_drawingPass == k_numberOfDrawingPasses - 1; }
+  bool drawingShouldBeInterrupted() const;
   /* Recursively join two dots (dichotomy). The method stops when the
    * maxNumberOfRecursion in reached. */
   void joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion, EvaluateXYForDoubleParameter xyDoubleEvaluation = nullptr) const;
   /* Join two dots with a straight line. */
   void straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color, bool thick) const;
-  /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
-   * function shifts the stamp (by blending adjacent pixel colors) to draw with
-   * anti alising. */
-  void stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const;
   void layoutSubviews(bool force = false) override;
   KDRect cursorFrame();
   KDRect bannerFrame();
@@ -164,6 +195,16 @@ private:
   bool m_forceOkDisplay;
   bool m_mainViewSelected;
   uint32_t m_drawnRangeVersion;
+  float m_drawnXMin;
+  float m_drawnXMax;
+  float m_drawnYMin;
+  float m_drawnYMax;
+  int m_drawnHorizontalLabelsMaxGlyphLength;
+  bool m_drawnLabelsCanBeScrolled;
+  RefinementTimer m_refinementTimer;
+  uint8_t m_drawingPass;
+  bool m_isRefiningDrawing;
+  mutable bool m_drawingInterrupted;
 };
 
 }
@@ -113,6 +113,12 @@ inline typename Poincare::Coordinate2D<double> NextIntersection(const Poincare::
   return e.nextIntersection(symbol, start, step, max, context, complexFormat, preferences->angleUnit(), expression);
 }
 
+inline void AllPointsOfInterest(const Poincare::Expression e, const char * symbol, double start, double end, double step, Poincare::Context * context, Poincare::Solver::PointsOfInterest * points) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+  e.allPointsOfInterest(symbol, start, end, step, context, complexFormat, preferences->angleUnit(), points);
+}
+
 inline bool equalOrBothNan(double a, double b) { return a == b || (std::isnan(a) && std::isnan(b)); }
 
 }
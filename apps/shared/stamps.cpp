@@ -0,0 +1,12 @@
+#include "stamps.h"
+
+namespace Shared {
+
+constexpr KDCoordinate Stamps::ThinCircleDiameter;
+constexpr KDCoordinate Stamps::ThinStampSize;
+constexpr uint8_t Stamps::ThinStampMask[];
+constexpr KDCoordinate Stamps::ThickCircleDiameter;
+constexpr KDCoordinate Stamps::ThickStampSize;
+constexpr uint8_t Stamps::ThickStampMask[];
+
+}
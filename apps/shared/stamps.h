@@ -0,0 +1,71 @@
+#ifndef SHARED_STAMPS_H
+#define SHARED_STAMPS_H
+
+#include <kandinsky/coordinate.h>
+#include <stdint.h>
+
+namespace Shared {
+
+// Diameter of the thick curves, in pixels: 2, 3 or 5
+#define LINE_THICKNESS 2
+
+/* The masks of the stamps drawing the curves are one pixel wider and higher
+ * than the stamps, so that they can be shifted by a fraction of a pixel. They
+ * are constexpr so that all the shifted masks are computed at compile time. */
+class Stamps {
+public:
+  static constexpr KDCoordinate ThinCircleDiameter = 1;
+  static constexpr KDCoordinate ThinStampSize = ThinCircleDiameter+1;
+  static constexpr uint8_t ThinStampMask[(ThinStampSize+1)*(ThinStampSize+1)] = {
+    0xFF, 0xE1, 0xFF,
+    0xE1, 0x00, 0xE1,
+    0xFF, 0xE1, 0xFF,
+  };
+
+#if LINE_THICKNESS == 2
+
+  static constexpr KDCoordinate ThickCircleDiameter = 2;
+  static constexpr KDCoordinate ThickStampSize = ThickCircleDiameter+1;
+  static constexpr uint8_t ThickStampMask[(ThickStampSize+1)*(ThickStampSize+1)] = {
+    0xFF, 0xE6, 0xE6, 0xFF,
+    0xE6, 0x33, 0x33, 0xE6,
+    0xE6, 0x33, 0x33, 0xE6,
+    0xFF, 0xE6, 0xE6, 0xFF,
+  };
+
+#elif LINE_THICKNESS == 3
+
+  static constexpr KDCoordinate ThickCircleDiameter = 3;
+  static constexpr KDCoordinate ThickStampSize = ThickCircleDiameter+1;
+  static constexpr uint8_t ThickStampMask[(ThickStampSize+1)*(ThickStampSize+1)] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7A, 0x0C, 0x7A, 0xFF,
+    0xFF, 0x0C, 0x00, 0x0C, 0xFF,
+    0xFF, 0x7A, 0x0C, 0x7A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+  };
+
+#elif LINE_THICKNESS == 5
+
+  static constexpr KDCoordinate ThickCircleDiameter = 5;
+  static constexpr KDCoordinate ThickStampSize = ThickCircleDiameter+1;
+  static constexpr uint8_t ThickStampMask[(ThickStampSize+1)*(ThickStampSize+1)] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF,
+    0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0x45, 0x00, 0x00, 0x00, 0x45, 0xFF,
+    0xFF, 0xE1, 0x45, 0x0C, 0x45, 0xE1, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  };
+
+#else
+#error "LINE_THICKNESS must be 2, 3 or 5"
+#endif
+};
+
+#undef LINE_THICKNESS
+
+}
+
+#endif
@@ -26,6 +26,12 @@ bool ZoomAndPanCurveViewController::handlePan(Ion::Events::Event event) {
     assert(event == Ion::Events::Right);
     xMove = interactiveCurveViewRange()->xGridUnit();
   }
+  /* The range is panned by a whole number of pixels so that the drawn curves
+   * can be scrolled instead of redrawn. */
+  float pixelWidth = curveView()->pixelWidth();
+  float pixelHeight = curveView()->pixelHeight();
+  xMove = std::round(xMove / pixelWidth) * pixelWidth;
+  yMove = std::round(yMove / pixelHeight) * pixelHeight;
   interactiveCurveViewRange()->panWithVector(xMove, yMove);
   curveView()->reload();
   return true;
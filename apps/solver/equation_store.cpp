@@ -97,10 +97,22 @@ void EquationStore::approximateSolve(Poincare::Context * context, bool shouldRep
   assert(m_type == Type::Monovariable);
   m_numberOfSolutions = 0;
   double start = m_intervalApproximateSolutions[0];
-  double step = (m_intervalApproximateSolutions[1]-m_intervalApproximateSolutions[0])*k_precision;
+  double end = m_intervalApproximateSolutions[1];
+  double step = (end-start)*k_precision;
+  /* The roots are computed in a single sweep of the interval. They are only
+   * searched again if there are more roots than the sweep can store. */
+  Poincare::Solver::PointsOfInterest pointsOfInterest;
+  if (step > 0.0) {
+    PoincareHelpers::AllPointsOfInterest(undevelopedExpression, m_variables[0], start, end, step, context, &pointsOfInterest);
+  }
   double root;
   for (int i = 0; i <= k_maxNumberOfApproximateSolutions; i++) {
-    root = PoincareHelpers::NextRoot(undevelopedExpression, m_variables[0], start, step, m_intervalApproximateSolutions[1], context);
+    Coordinate2D<double> nextRoot;
+    if (pointsOfInterest.next(Poincare::Solver::PointOfInterestType::Root, start, step, end, &nextRoot)) {
+      root = nextRoot.x1();
+    } else {
+      root = PoincareHelpers::NextRoot(undevelopedExpression, m_variables[0], start, step, end, context);
+    }
     if (i == k_maxNumberOfApproximateSolutions) {
       m_hasMoreThanMaxNumberOfApproximateSolution = !std::isnan(root);
       break;
@@ -95,6 +95,8 @@ QUIZ_CASE(equation_solve) {
 
   assert_solves_to_error("(x-10)^7=0", RequireApproximateSolution);
   assert_solves_numerically_to("(x-10)^7=0", -100, 100, {10});
+  assert_solves_numerically_to("x^4-5x^2+4=0", -100, 100, {-2.0, -1.0, 1.0, 2.0});
+  assert_solves_numerically_to("(x-1)^2×(x^3+2)=0", -100, 100, {-1.259921049894873, 1.0});
 }
 
 
@@ -69,6 +69,12 @@ protected:
    *  - ... and that's all I can think of.
    */
   virtual void markRectAsDirty(KDRect rect);
+  /* Move the pixels of rect which are displayed by offset, instead of
+   * redrawing them. Only the part of rect which is not covered by the moved
+   * pixels is marked as dirty, as well as the moved copies of the subviews.
+   * Like the cursor speedup, this is out of the dirty tracking: the view is
+   * assumed not to be covered by another view. */
+  void scrollRect(KDRect rect, KDPoint offset);
 #if ESCHER_VIEW_LOGGING
   virtual const char * className() const;
   virtual void logAttributes(std::ostream &os) const;
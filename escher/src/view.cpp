@@ -2,6 +2,7 @@ extern "C" {
 #include <assert.h>
 }
 #include <escher/view.h>
+#include <ion/display.h>
 
 const Window * View::window() const {
   if (m_superview == nullptr) {
@@ -15,6 +16,39 @@ void View::markRectAsDirty(KDRect rect) {
   m_dirtyRect = m_dirtyRect.unionedWith(rect);
 }
 
+void View::scrollRect(KDRect rect, KDPoint offset) {
+  rect = rect.intersectedWith(bounds());
+  if (m_dirtyRect.containsRect(rect)) {
+    // rect will be redrawn anyway
+    return;
+  }
+  KDRect movedRect = KDRectZero;
+  if (window() != nullptr) {
+    KDPoint absOrigin = absoluteOrigin();
+    KDRect visibleRect = absoluteVisibleFrame().translatedBy(absOrigin.opposite()).intersectedWith(rect);
+    movedRect = visibleRect.intersectedWith(visibleRect.translatedBy(offset));
+    if (!movedRect.isEmpty()) {
+      KDContext * ctx = KDIonContext::sharedContext();
+      ctx->setOrigin(absOrigin);
+      ctx->setClippingRect(visibleRect.translatedBy(absOrigin));
+      KDColor workingBuffer[Ion::Display::Width];
+      ctx->copyRect(visibleRect, offset, workingBuffer);
+    }
+  }
+  // The pixels which were waiting to be redrawn have been moved too
+  markRectAsDirty(m_dirtyRect.intersectedWith(rect).translatedBy(offset).intersectedWith(rect));
+  /* The subviews are drawn over the moved pixels, so both their frames and
+   * their moved copies have to be redrawn. */
+  for (int i = 0; i < numberOfSubviews(); i++) {
+    View * subview = subviewAtIndex(i);
+    if (subview != nullptr) {
+      markRectAsDirty(subview->m_frame.intersectedWith(rect));
+      markRectAsDirty(subview->m_frame.translatedBy(offset).intersectedWith(rect));
+    }
+  }
+  markRectAsDirty(rect.differencedWith(movedRect));
+}
+
 KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   /* View::redraw recursively redraws the rectangle 'rect' of the view and all
    * its subviews.
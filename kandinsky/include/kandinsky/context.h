@@ -27,6 +27,10 @@ public:
 
   // Line. Not anti-aliased.
   void drawLine(KDPoint p1, KDPoint p2, KDColor c);
+  /* Anti-aliased line of the given width between (x1, y1) and (x2, y2), which
+   * need not be pixel centers. The ends are rounded. */
+  constexpr static float k_maxAntialiasedLineWidth = 8.0f;
+  void drawAntialiasedLine(float x1, float y1, float x2, float y2, float width, KDColor color);
 
   // Circle
   void drawCircle(KDPoint c, KDCoordinate r, KDColor color);
@@ -37,6 +41,10 @@ public:
   void fillRectWithPixels(KDRect rect, const KDColor * pixels, KDColor * workingBuffer);
   void blendRectWithMask(KDRect rect, KDColor color, const uint8_t * mask, KDColor * workingBuffer);
   void strokeRect(KDRect rect, KDColor color);
+  /* Move the pixels of rect by offset. Only the pixels which are in the
+   * clipping rect both before and after the move are copied. The working
+   * buffer must hold a row of rect. */
+  void copyRect(KDRect rect, KDPoint offset, KDColor * workingBuffer);
   virtual void pushRect(KDRect, const KDColor * pixels) = 0;
   virtual void pushRectUniform(KDRect rect, KDColor color) = 0;
   virtual void pullRect(KDRect rect, KDColor * pixels) = 0;
@@ -46,6 +54,9 @@ public:
 protected:
   KDContext(KDPoint origin, KDRect clippingRect);
 private:
+  /* Along its minor axis, an anti-aliased line covers width+1 pixels and
+   * moves by at most width+1 pixels within a scanline. */
+  constexpr static int k_maxAntialiasedLineSpanLength = 2 * static_cast<int>(k_maxAntialiasedLineWidth) + 3;
   KDRect absoluteFillRect(KDRect rect);
   KDPoint pushOrPullString(const char * text, KDPoint p, const KDFont * font, KDColor textColor, KDColor backgroundColor, int maxByteLength, bool push, int * result = nullptr);
   KDPoint m_origin;
@@ -1,5 +1,6 @@
 #include <kandinsky/context.h>
 #include <assert.h>
+#include <math.h>
 
 void KDContext::drawLine(KDPoint p1, KDPoint p2, KDColor c) {
   // Find the largest gap
@@ -57,3 +58,101 @@ void KDContext::drawLine(KDPoint p1, KDPoint p2, KDColor c) {
     }
   }
 }
+
+static float clampedFloat(float x, float min, float max) {
+  return x < min ? min : (x > max ? max : x);
+}
+
+void KDContext::drawAntialiasedLine(float x1, float y1, float x2, float y2, float width, KDColor color) {
+  assert(width > 0.0f && width <= k_maxAntialiasedLineWidth);
+  /* Pixels are blended with the color proportionally to their coverage, which
+   * is approximated with the distance from their center to the segment: it
+   * fades linearly from 1 at width/2-1/2 to 0 at width/2+1/2.
+   * The line is scanned along its major axis a. Each scanline is a span along
+   * the minor axis b, which is pulled, blended and pushed at once. */
+  const bool horizontal = fabsf(x2 - x1) >= fabsf(y2 - y1);
+  float a1 = horizontal ? x1 : y1;
+  float b1 = horizontal ? y1 : x1;
+  float a2 = horizontal ? x2 : y2;
+  float b2 = horizontal ? y2 : x2;
+  if (a1 > a2) {
+    float temp = a1;
+    a1 = a2;
+    a2 = temp;
+    temp = b1;
+    b1 = b2;
+    b2 = temp;
+  }
+  const float da = a2 - a1;
+  const float db = b2 - b1;
+  const float squaredLength = da*da + db*db;
+  const float length = sqrtf(squaredLength);
+  const float slope = da > 0.0f ? db / da : 0.0f;
+  const float reach = width / 2.0f + 0.5f;
+
+  // Clip the scanlines to the clipping rect, in coordinates relative to origin
+  KDRect clippingRect = m_clippingRect.translatedBy(KDPoint(-m_origin.x(), -m_origin.y()));
+  if (clippingRect.isEmpty()) {
+    return;
+  }
+  const float aMinBound = horizontal ? clippingRect.left() : clippingRect.top();
+  const float aMaxBound = horizontal ? clippingRect.right() : clippingRect.bottom();
+  const float bMinBound = horizontal ? clippingRect.top() : clippingRect.left();
+  const float bMaxBound = horizontal ? clippingRect.bottom() : clippingRect.right();
+  const float aStart = fmaxf(ceilf(a1 - reach), aMinBound);
+  const float aEnd = fminf(floorf(a2 + reach), aMaxBound);
+
+  uint8_t alphas[k_maxAntialiasedLineSpanLength];
+  KDColor pixels[k_maxAntialiasedLineSpanLength];
+  for (float a = aStart; a <= aEnd; a++) {
+    // Along the scanline, the line is between its b at a-reach and at a+reach
+    const float bFrom = b1 + slope * (clampedFloat(a - reach, a1, a2) - a1);
+    const float bTo = b1 + slope * (clampedFloat(a + reach, a1, a2) - a1);
+    const float bStart = fmaxf(ceilf(fminf(bFrom, bTo) - reach), bMinBound);
+    const float bEnd = fminf(floorf(fmaxf(bFrom, bTo) + reach), bMaxBound);
+    /* Compute the alphas of the span, and trim the pixels of the span which
+     * are not covered. */
+    int spanStart = -1;
+    int spanEnd = -1;
+    int numberOfPixels = 0;
+    for (float b = bStart; b <= bEnd; b++) {
+      assert(numberOfPixels < k_maxAntialiasedLineSpanLength);
+      const float pa = a - a1;
+      const float pb = b - b1;
+      const float t = squaredLength > 0.0f ? (pa*da + pb*db) / squaredLength : 0.0f;
+      float distance;
+      if (t <= 0.0f) {
+        distance = sqrtf(pa*pa + pb*pb);
+      } else if (t >= 1.0f) {
+        distance = sqrtf((a - a2)*(a - a2) + (b - b2)*(b - b2));
+      } else {
+        distance = fabsf(pa*db - pb*da) / length;
+      }
+      const float coverage = reach - distance;
+      uint8_t alpha = 0xFF;
+      if (coverage >= 1.0f) {
+        alpha = 0;
+      } else if (coverage > 0.0f) {
+        alpha = 0xFF * (1.0f - coverage) + 0.5f;
+      }
+      if (alpha != 0xFF) {
+        spanStart = spanStart < 0 ? numberOfPixels : spanStart;
+        spanEnd = numberOfPixels;
+      }
+      alphas[numberOfPixels++] = alpha;
+    }
+    if (spanStart < 0) {
+      continue;
+    }
+    const KDCoordinate spanA = a;
+    const KDCoordinate spanB = bStart + spanStart;
+    const KDCoordinate spanLength = spanEnd - spanStart + 1;
+    KDRect span = horizontal ? KDRect(spanA, spanB, 1, spanLength) : KDRect(spanB, spanA, spanLength, 1);
+    KDRect absoluteSpan = span.translatedBy(m_origin);
+    pullRect(absoluteSpan, pixels);
+    for (int i = 0; i < spanLength; i++) {
+      pixels[i] = KDColor::blend(pixels[i], color, alphas[spanStart + i]);
+    }
+    pushRect(absoluteSpan, pixels);
+  }
+}
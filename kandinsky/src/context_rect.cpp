@@ -86,6 +86,23 @@ void KDContext::blendRectWithMask(KDRect rect, KDColor color, const uint8_t * ma
   pushRect(absoluteRect, workingBuffer);
 }
 
+void KDContext::copyRect(KDRect rect, KDPoint offset, KDColor * workingBuffer) {
+  KDRect absoluteRect = absoluteFillRect(rect);
+  KDRect absoluteSource = absoluteRect.intersectedWith(absoluteRect.translatedBy(offset.opposite()));
+  if (absoluteSource.isEmpty()) {
+    return;
+  }
+  /* Rows are copied one at a time, starting from the side the pixels are
+   * moved to, so that no row is overwritten before being copied. */
+  bool bottomUp = offset.y() > 0;
+  for (KDCoordinate j = 0; j < absoluteSource.height(); j++) {
+    KDCoordinate y = bottomUp ? absoluteSource.bottom() - j : absoluteSource.top() + j;
+    KDRect row(absoluteSource.x(), y, absoluteSource.width(), 1);
+    pullRect(row, workingBuffer);
+    pushRect(row.translatedBy(offset), workingBuffer);
+  }
+}
+
 void KDContext::strokeRect(KDRect rect, KDColor color) {
   fillRect(KDRect(rect.origin(), rect.width(), 1), color);
   fillRect(KDRect(KDPoint(rect.x(), rect.bottom()), rect.width(), 1), color);
@@ -0,0 +1,47 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+constexpr KDCoordinate k_copyBufferWidth = 12;
+constexpr KDCoordinate k_copyBufferHeight = 10;
+
+KDColor color_at(KDCoordinate x, KDCoordinate y) {
+  return KDColor::RGB888(20*x, 20*y, 0);
+}
+
+void assert_rect_copy_is(KDPoint offset, KDRect clippingRect) {
+  KDColor pixels[k_copyBufferWidth*k_copyBufferHeight];
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_copyBufferWidth, k_copyBufferHeight));
+  KDFrameBufferContext ctx(&frameBuffer);
+  for (KDCoordinate x = 0; x < k_copyBufferWidth; x++) {
+    for (KDCoordinate y = 0; y < k_copyBufferHeight; y++) {
+      pixels[x + k_copyBufferWidth*y] = color_at(x, y);
+    }
+  }
+  ctx.setClippingRect(clippingRect);
+  KDColor workingBuffer[k_copyBufferWidth];
+  ctx.copyRect(frameBuffer.bounds(), offset, workingBuffer);
+  for (KDCoordinate x = 0; x < k_copyBufferWidth; x++) {
+    for (KDCoordinate y = 0; y < k_copyBufferHeight; y++) {
+      KDPoint source(x - offset.x(), y - offset.y());
+      bool isCopied = clippingRect.contains(KDPoint(x, y)) && clippingRect.contains(source);
+      KDColor expected = isCopied ? color_at(source.x(), source.y()) : color_at(x, y);
+      quiz_assert(pixels[x + k_copyBufferWidth*y] == expected);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_context_copy_rect) {
+  KDRect bounds(0, 0, k_copyBufferWidth, k_copyBufferHeight);
+  // The copied pixels overlap whatever the direction
+  assert_rect_copy_is(KDPoint(3, 0), bounds);
+  assert_rect_copy_is(KDPoint(-3, 0), bounds);
+  assert_rect_copy_is(KDPoint(0, 2), bounds);
+  assert_rect_copy_is(KDPoint(0, -2), bounds);
+  assert_rect_copy_is(KDPoint(-1, 4), bounds);
+  assert_rect_copy_is(KDPoint(5, -3), bounds);
+  assert_rect_copy_is(KDPoint(k_copyBufferWidth, 0), bounds);
+  // Pixels are only copied from and to the clipping rect
+  assert_rect_copy_is(KDPoint(2, 1), KDRect(3, 2, 6, 5));
+  assert_rect_copy_is(KDPoint(-2, -3), KDRect(3, 2, 6, 5));
+}
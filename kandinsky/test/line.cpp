@@ -0,0 +1,90 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <assert.h>
+
+constexpr KDCoordinate k_lineBufferSize = 24;
+
+class LineBuffer {
+public:
+  LineBuffer() :
+    m_frameBuffer(m_pixels, KDSize(k_lineBufferSize, k_lineBufferSize)),
+    m_context(&m_frameBuffer)
+  {
+    m_context.fillRect(m_frameBuffer.bounds(), KDColorWhite);
+  }
+  KDContext * context() { return &m_context; }
+  KDColor pixel(KDCoordinate x, KDCoordinate y) const { return m_pixels[x + k_lineBufferSize*y]; }
+private:
+  KDColor m_pixels[k_lineBufferSize*k_lineBufferSize];
+  KDFrameBuffer m_frameBuffer;
+  KDFrameBufferContext m_context;
+};
+
+QUIZ_CASE(kandinsky_antialiased_line_aligned) {
+  // A line along pixel centers only covers one row
+  LineBuffer thin;
+  thin.context()->drawAntialiasedLine(3.0f, 5.0f, 20.0f, 5.0f, 1.0f, KDColorBlack);
+  for (KDCoordinate x = 0; x < k_lineBufferSize; x++) {
+    quiz_assert(thin.pixel(x, 4) == KDColorWhite);
+    quiz_assert(thin.pixel(x, 5) == ((3 <= x && x <= 20) ? KDColorBlack : KDColorWhite));
+    quiz_assert(thin.pixel(x, 6) == KDColorWhite);
+  }
+
+  // A line of width 2 between pixel centers covers two columns
+  LineBuffer thick;
+  thick.context()->drawAntialiasedLine(10.5f, 20.0f, 10.5f, 4.0f, 2.0f, KDColorBlack);
+  for (KDCoordinate y = 4; y <= 20; y++) {
+    quiz_assert(thick.pixel(9, y) == KDColorWhite);
+    quiz_assert(thick.pixel(10, y) == KDColorBlack);
+    quiz_assert(thick.pixel(11, y) == KDColorBlack);
+    quiz_assert(thick.pixel(12, y) == KDColorWhite);
+  }
+  // The ends are rounded
+  quiz_assert(thick.pixel(10, 21) != KDColorWhite && thick.pixel(10, 21) != KDColorBlack);
+  quiz_assert(thick.pixel(10, 3) != KDColorWhite && thick.pixel(10, 3) != KDColorBlack);
+}
+
+QUIZ_CASE(kandinsky_antialiased_line_symmetry) {
+  // Lines do not depend on the direction they are drawn in
+  LineBuffer forward, backward, transposed;
+  forward.context()->drawAntialiasedLine(2.3f, 4.7f, 19.6f, 11.2f, 2.0f, KDColorRed);
+  backward.context()->drawAntialiasedLine(19.6f, 11.2f, 2.3f, 4.7f, 2.0f, KDColorRed);
+  transposed.context()->drawAntialiasedLine(4.7f, 2.3f, 11.2f, 19.6f, 2.0f, KDColorRed);
+  bool drawn = false;
+  for (KDCoordinate x = 0; x < k_lineBufferSize; x++) {
+    for (KDCoordinate y = 0; y < k_lineBufferSize; y++) {
+      quiz_assert(forward.pixel(x, y) == backward.pixel(x, y));
+      quiz_assert(forward.pixel(x, y) == transposed.pixel(y, x));
+      drawn = drawn || forward.pixel(x, y) == KDColorRed;
+    }
+  }
+  quiz_assert(drawn);
+
+  // A line of null length is a dot
+  LineBuffer dot;
+  dot.context()->drawAntialiasedLine(8.0f, 8.0f, 8.0f, 8.0f, 1.0f, KDColorBlack);
+  for (KDCoordinate x = 0; x < k_lineBufferSize; x++) {
+    for (KDCoordinate y = 0; y < k_lineBufferSize; y++) {
+      quiz_assert(dot.pixel(x, y) == ((x == 8 && y == 8) ? KDColorBlack : KDColorWhite));
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_antialiased_line_clipping) {
+  LineBuffer clipped;
+  KDContext * ctx = clipped.context();
+  KDRect clippingRect(4, 6, 10, 8);
+  ctx->setOrigin(KDPoint(2, 3));
+  ctx->setClippingRect(clippingRect);
+  // The line goes far outside of the clipping rect
+  ctx->drawAntialiasedLine(-1000.0f, -500.0f, 1000.0f, 500.0f, 2.0f, KDColorBlack);
+  bool drawn = false;
+  for (KDCoordinate x = 0; x < k_lineBufferSize; x++) {
+    for (KDCoordinate y = 0; y < k_lineBufferSize; y++) {
+      bool isInClippingRect = clippingRect.contains(KDPoint(x, y));
+      quiz_assert(isInClippingRect || clipped.pixel(x, y) == KDColorWhite);
+      drawn = drawn || (isInClippingRect && clipped.pixel(x, y) == KDColorBlack);
+    }
+  }
+  quiz_assert(drawn);
+}
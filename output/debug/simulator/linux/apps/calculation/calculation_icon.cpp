@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calculation_icon.h"
+
+// Compressed 3080 pixels into 523 bytes (8.49% compression ratio)/
+const uint8_t compressedPixelData[523] = {0x0013, 0x00ff, 0x0001, 0x0000, 0x008f, 0x00df, 0x00ff, 0x007d, 0x00ef, 0x005d, 0x00ef, 0x003c, 0x00e7, 0x0002, 0x0000, 0x003d, 0x006a, 0x005d, 0x00ef, 0x007d, 0x00ef, 0x00df, 0x00ff, 0x0001, 0x0000, 0x00af, 0x007d, 0x00ef, 0x003c, 0x00e7, 0x007d, 0x00ef, 0x007d, 0x00ef, 0x009e, 0x00f7, 0x0002, 0x0000, 0x0013, 0x002f, 0x003c, 0x00e7, 0x002a, 0x0000, 0x0015, 0x0022, 0x007d, 0x00ef, 0x005c, 0x0000, 0x0006, 0x006c, 0x0000, 0x003e, 0x005d, 0x00ef, 0x005d, 0x0068, 0x0000, 0x000f, 0x006e, 0x0000, 0x0034, 0x0002, 0x0002, 0x0000, 0x0000, 0x0062, 0x0000, 0x0004, 0x00d8, 0x0000, 0x000e, 0x006c, 0x0000, 0x000f, 0x006e, 0x0000, 0x003d, 0x0020, 0x009e, 0x00f7, 0x0052, 0x0001, 0x0000, 0x00b0, 0x0001, 0x000e, 0x003a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0041, 0x0000, 0x0034, 0x0000, 0x002e, 0x00df, 0x00ff, 0x00ae, 0x0001, 0x000f, 0x006e, 0x0000, 0x0045, 0x0000, 0x006a, 0x0000, 0x001f, 0x005d, 0x006e, 0x0000, 0x0058, 0x002f, 0x005d, 0x00ef, 0x0038, 0x0000, 0x0007, 0x006f, 0x009c, 0x00c6, 0x001b, 0x00ae, 0x005c, 0x00be, 0x006e, 0x0000, 0x0037, 0x0000, 0x0036, 0x0000, 0x000f, 0x0038, 0x0000, 0x0007, 0x006f, 0x00fb, 0x00a5, 0x0019, 0x007d, 0x007a, 0x0095, 0x006e, 0x0000, 0x00ff, 0x00ff, 0x0003, 0x0044, 0x00bc, 0x00c6, 0x00ba, 0x009d, 0x0002, 0x0000, 0x0066, 0x005a, 0x008d, 0x0019, 0x007d, 0x0039, 0x0085, 0x0010, 0x0000, 0x002f, 0x005c, 0x00be, 0x006e, 0x0000, 0x003d, 0x004f, 0x005c, 0x00be, 0x0019, 0x007d, 0x0002, 0x0000, 0x0005, 0x002f, 0x00fb, 0x00a5, 0x00dc, 0x0000, 0x003e, 0x0034, 0x00ce, 0x00db, 0x009d, 0x0002, 0x0000, 0x0002, 0x00dc, 0x0000, 0x0006, 0x0010, 0x0000, 0x000f, 0x00dc, 0x0000, 0x000e, 0x0019, 0x00ef, 0x0002, 0x0000, 0x000f, 0x00b8, 0x0001, 0x004a, 0x002a, 0x00fd, 0x00d6, 0x000a, 0x0001, 0x002f, 0x007a, 0x008d, 0x006e, 0x0000, 0x00b7, 0x0048, 0x003d, 0x00e7, 0x00fb, 0x00ad, 0x0002, 0x0000, 0x002f, 0x003b, 0x00b6, 0x00de, 0x0003, 0x00f7, 0x000f, 0x0004, 0x0006, 0x005b, 0x000e, 0x00e0, 0x0006, 0x000f, 0x006e, 0x0000, 0x00ff, 0x00ea, 0x002f, 0x007d, 0x00ef, 0x0002, 0x0000, 0x001f, 0x000f, 0x0036, 0x0000, 0x0025, 0x000f, 0x0038, 0x0000, 0x0025, 0x002f, 0x00f3, 0x009c, 0x0002, 0x0000, 0x001f, 0x000f, 0x004a, 0x0001, 0x0027, 0x002f, 0x0049, 0x004a, 0x0002, 0x0000, 0x001f, 0x000f, 0x006e, 0x0000, 0x00ff, 0x00ff, 0x0031, 0x0020, 0x00fd, 0x00d6, 0x0002, 0x0000, 0x002f, 0x009e, 0x00ef, 0x006e, 0x0000, 0x0053, 0x0020, 0x005a, 0x008d, 0x00f2, 0x0007, 0x001f, 0x005d, 0x006e, 0x0000, 0x007c, 0x002f, 0x00cf, 0x007b, 0x0006, 0x0004, 0x0007, 0x002f, 0x00db, 0x00de, 0x006e, 0x0000, 0x0015, 0x0020, 0x00fb, 0x00a5, 0x00b4, 0x000a, 0x001f, 0x007e, 0x006e, 0x0000, 0x0010, 0x000f, 0x00e0, 0x0001, 0x0007, 0x002f, 0x00fb, 0x00de, 0x0026, 0x0002, 0x003d, 0x002f, 0x000c, 0x0063, 0x00ac, 0x0004, 0x0007, 0x002f, 0x0092, 0x0094, 0x006e, 0x0000, 0x0009, 0x004f, 0x00dd, 0x00d6, 0x001b, 0x00ae, 0x0002, 0x0000, 0x0005, 0x002f, 0x009c, 0x00c6, 0x00b8, 0x0001, 0x003d, 0x000f, 0x009a, 0x000b, 0x0009, 0x002f, 0x00db, 0x00a5, 0x006e, 0x0000, 0x003d, 0x004f, 0x009c, 0x00c6, 0x005a, 0x008d, 0x0002, 0x0000, 0x0005, 0x002f, 0x001b, 0x00ae, 0x00de, 0x0003, 0x0071, 0x004f, 0x00eb, 0x005a, 0x00b2, 0x0094, 0x0002, 0x0000, 0x0005, 0x002f, 0x0071, 0x008c, 0x006e, 0x0000, 0x0015, 0x006f, 0x009c, 0x00c6, 0x007c, 0x00be, 0x007c, 0x00be, 0x0094, 0x0002, 0x0055, 0x000e, 0x0070, 0x0003, 0x000f, 0x006e, 0x0000, 0x0071, 0x003f, 0x0049, 0x004a, 0x0069, 0x0002, 0x0000, 0x0008, 0x000f, 0x006e, 0x0000, 0x0015, 0x008f, 0x005c, 0x00b6, 0x003b, 0x00b6, 0x003b, 0x00b6, 0x007e, 0x00ef, 0x0004, 0x0006, 0x00a3, 0x0022, 0x008a, 0x0052, 0x00ae, 0x0014, 0x000f, 0x006e, 0x0000, 0x0053, 0x0020, 0x004d, 0x006b, 0x006c, 0x0000, 0x000f, 0x006e, 0x0000, 0x0055, 0x004e, 0x00d3, 0x009c, 0x007d, 0x00ef, 0x0032, 0x0014, 0x000f, 0x006e, 0x0000, 0x0043, 0x005e, 0x00aa, 0x0052, 0x00db, 0x00de, 0x00df, 0x000e, 0x0015, 0x000f, 0x006e, 0x0000, 0x0044, 0x004f, 0x00d7, 0x00bd, 0x007d, 0x00ef, 0x00ea, 0x0015, 0x0027, 0x000f, 0x00d8, 0x0000, 0x001b, 0x004c, 0x00d7, 0x00bd, 0x005d, 0x00ef, 0x00c6, 0x0016, 0x000f, 0x006e, 0x0000, 0x003f, 0x0088, 0x008a, 0x0052, 0x004d, 0x006b, 0x00d3, 0x009c, 0x00db, 0x00de, 0x00c6, 0x0016, 0x000f, 0x00a2, 0x0017, 0x0052, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 523);
+
+const Image * ImageStore::CalculationIcon = &image;
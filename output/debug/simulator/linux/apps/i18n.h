@@ -0,0 +1,2400 @@
+#ifndef APPS_I18N_H
+#define APPS_I18N_H
+
+// This file is auto-generated by i18n.py
+
+#include <escher.h>
+#include <apps/country_preferences.h>
+
+namespace I18n {
+
+constexpr static int NumberOfLanguages = 8;
+
+constexpr static int NumberOfCountries = 10;
+
+enum class Message : uint16_t {
+  Default = 0,
+  A,
+  AbsCommandWithArg,
+  AcoshCommandWithArg,
+  AlmostEqual,
+  Alpha,
+  AntoninLoubiere,
+  ArgCommandWithArg,
+  AsinhCommandWithArg,
+  AtanhCommandWithArg,
+  AtmosphericPressure,
+  AtomicMassUnit,
+  Avogadro,
+  B,
+  BinomialCDFCommandWithArg,
+  BinomialCommandWithArg,
+  BinomialPDFCommandWithArg,
+  BlankMessage,
+  BohrMagneton,
+  BohrRadius,
+  Boltzmann,
+  C,
+  CapitalAlpha,
+  CeilCommandWithArg,
+  CharlotteThomas,
+  CirculationQuantum,
+  CmathModule,
+  Cndcvt_Air,
+  Cndcvt_Aluminium,
+  Cndcvt_Calcium,
+  Cndcvt_Cobalt,
+  Cndcvt_Copper,
+  Cndcvt_Glass,
+  Cndcvt_Gold,
+  Cndcvt_Iron,
+  Cndcvt_Lithium,
+  Cndcvt_Nickel,
+  Cndcvt_Platinum,
+  Cndcvt_Sea_water,
+  Cndcvt_Silver,
+  Cndcvt_Tin,
+  Cndcvt_Tungsten,
+  Cndcvt_Water,
+  Cndcvt_Wood,
+  Cndcvt_Zinc,
+  CodeApp,
+  CodeAppCapital,
+  ConditionAnd,
+  ConditionNot,
+  ConditionOr,
+  ConditionsMenu,
+  ConductanceQuantum,
+  ConfidenceCommandWithArg,
+  ConjCommandWithArg,
+  ConsolePrompt,
+  CoshCommandWithArg,
+  Coulomb,
+  CrossCommandWithArg,
+  CubicRegressionFormula,
+  CyprienMejat,
+  D,
+  D1,
+  D2,
+  DamienNicolet,
+  Dash,
+  David,
+  DavidLuca,
+  DefaultSetting,
+  DeterminantCommandWithArg,
+  DiffCommand,
+  DiffCommandWithArg,
+  DimensionCommandWithArg,
+  DiscreteLegend,
+  DotCommandWithArg,
+  E,
+  EarthMass,
+  EarthMoonDistance,
+  EarthRadius,
+  EarthSunDistance,
+  ElectronMass,
+  ElementAcMass,
+  ElementAgMass,
+  ElementAlMass,
+  ElementAmMass,
+  ElementArMass,
+  ElementAsMass,
+  ElementAtMass,
+  ElementAuMass,
+  ElementBMass,
+  ElementBaMass,
+  ElementBeMass,
+  ElementBhMass,
+  ElementBiMass,
+  ElementBkMass,
+  ElementBrMass,
+  ElementCMass,
+  ElementCaMass,
+  ElementCdMass,
+  ElementCeMass,
+  ElementCfMass,
+  ElementClMass,
+  ElementCmMass,
+  ElementCnMass,
+  ElementCoMass,
+  ElementCrMass,
+  ElementCsMass,
+  ElementCuMass,
+  ElementDbMass,
+  ElementDsMass,
+  ElementDyMass,
+  ElementErMass,
+  ElementEsMass,
+  ElementEuMass,
+  ElementFMass,
+  ElementFeMass,
+  ElementFlMass,
+  ElementFmMass,
+  ElementFrMass,
+  ElementGaMass,
+  ElementGdMass,
+  ElementGeMass,
+  ElementHMass,
+  ElementHeMass,
+  ElementHfMass,
+  ElementHgMass,
+  ElementHoMass,
+  ElementHsMass,
+  ElementIMass,
+  ElementInMass,
+  ElementIrMass,
+  ElementKMass,
+  ElementKrMass,
+  ElementLaMass,
+  ElementLiMass,
+  ElementLrMass,
+  ElementLuMass,
+  ElementLvMass,
+  ElementMcMass,
+  ElementMdMass,
+  ElementMgMass,
+  ElementMnMass,
+  ElementMoMass,
+  ElementMtMass,
+  ElementNMass,
+  ElementNaMass,
+  ElementNbMass,
+  ElementNdMass,
+  ElementNeMass,
+  ElementNhMass,
+  ElementNiMass,
+  ElementNoMass,
+  ElementNpMass,
+  ElementOMass,
+  ElementOgMass,
+  ElementOsMass,
+  ElementPMass,
+  ElementPaMass,
+  ElementPbMass,
+  ElementPdMass,
+  ElementPmMass,
+  ElementPoMass,
+  ElementPrMass,
+  ElementPtMass,
+  ElementPuMass,
+  ElementRaMass,
+  ElementRbMass,
+  ElementReMass,
+  ElementRfMass,
+  ElementRgMass,
+  ElementRhMass,
+  ElementRnMass,
+  ElementRuMass,
+  ElementSMass,
+  ElementSbMass,
+  ElementScMass,
+  ElementSeMass,
+  ElementSgMass,
+  ElementSiMass,
+  ElementSmMass,
+  ElementSnMass,
+  ElementSrMass,
+  ElementTaMass,
+  ElementTbMass,
+  ElementTcMass,
+  ElementTeMass,
+  ElementThMass,
+  ElementTiMass,
+  ElementTlMass,
+  ElementTmMass,
+  ElementTsMass,
+  ElementUMass,
+  ElementUbnMass,
+  ElementUueMass,
+  ElementVMass,
+  ElementWMass,
+  ElementXeMass,
+  ElementYMass,
+  ElementYbMass,
+  ElementZnMass,
+  ElementZrMass,
+  ElementalCharge,
+  Equal,
+  EqualityCondition,
+  EqualityConditionWithArg,
+  EscapeVelocityOfEarth,
+  EscapeVelocityOfMoon,
+  EscapeVelocityOfSun,
+  EvannDreumont,
+  ExponentialRegressionFormula,
+  FactorCommandWithArg,
+  FactorialCommand,
+  FactorialCommandWithArg,
+  FaradayConstant,
+  FccId,
+  FineStructure,
+  FiniteIntegralFirstLegend,
+  FiniteIntegralLegend,
+  Fisher,
+  FloorCommandWithArg,
+  ForInListLoop,
+  ForInListLoopWithArg,
+  ForInRange1ArgLoop,
+  ForInRange1ArgLoopWithArg,
+  ForInRange2ArgsLoop,
+  ForInRange2ArgsLoopWithArg,
+  ForInRange3ArgsLoop,
+  ForInRange3ArgsLoopWithArg,
+  ForLoopMenu,
+  FracCommandWithArg,
+  GAcceleration,
+  GConstant,
+  Gas,
+  GcdCommandWithArg,
+  Gon,
+  HartreeConstant,
+  IfAndIfElseStatement,
+  IfAndIfElseStatementWithArg,
+  IfElifElseStatement,
+  IfElifElseStatementWithArg,
+  IfElseStatement,
+  IfElseStatementWithArg,
+  IfOrIfElseStatement,
+  IfOrIfElseStatementWithArg,
+  IfStatementMenu,
+  IfThenStatement,
+  IfThenStatementWithArg,
+  ImCommandWithArg,
+  IndentityCommandWithArg,
+  InferiorCondition,
+  InferiorConditionWithArg,
+  InferiorStrictCondition,
+  InferiorStrictConditionWithArg,
+  Infinity,
+  IntCommand,
+  IntCommandWithArg,
+  InvBinomialCommandWithArg,
+  InvNormCommandWithArg,
+  InvSortCommandWithArg,
+  InverseCommandWithArg,
+  IonModule,
+  JeanBaptisteBoric,
+  JoachimLeFournis,
+  K,
+  KandinskyModule,
+  Lambda,
+  LanguageDE,
+  LanguageEN,
+  LanguageES,
+  LanguageFR,
+  LanguageHU,
+  LanguageIT,
+  LanguageNL,
+  LanguagePT,
+  LaurianFournier,
+  LcmCommandWithArg,
+  LeftIntegralFirstLegend,
+  LeftIntegralSecondLegend,
+  LinearRegressionFormula,
+  LogCommandWithArg,
+  LogarithmicRegressionFormula,
+  LogisticRegressionFormula,
+  LoicE,
+  MagneticFluxQuantum,
+  MathModule,
+  MatplotlibPyplotModule,
+  MatrixCommand,
+  MatrixCommandWithArg,
+  MaxCommandWithArg,
+  MaximeFriess,
+  MinCommandWithArg,
+  MoonMass,
+  MoonRadius,
+  Mu,
+  MuonMass,
+  N,
+  NeutronMass,
+  NonEqualityCondition,
+  NonEqualityConditionWithArg,
+  NormCDF2CommandWithArg,
+  NormCDFCommandWithArg,
+  NormPDFCommandWithArg,
+  NormVectorCommandWithArg,
+  NuclearMagneton,
+  NumpyFftModule,
+  NumpyLinalgModule,
+  NumpyModule,
+  NumpyNdarray,
+  OsModule,
+  P,
+  PAntoninLoubiere,
+  PCharlotteThomas,
+  PCyprienMejat,
+  PDamienNicolet,
+  PDavid,
+  PDavidLuca,
+  PEvannDreumont,
+  PJeanBaptisteBoric,
+  PJoachimLeFournis,
+  PLaurianFournier,
+  PLoicE,
+  PMaximeFriess,
+  PQuentinGuidee,
+  PSandraSimmons,
+  PSzaboLevente,
+  PVenceslasDuet,
+  PVictorKretz,
+  PYannCouturier,
+  PermuteCommandWithArg,
+  Pka,
+  Pka01,
+  Pka01Value,
+  Pka02,
+  Pka02Value,
+  Pka03,
+  Pka03Value,
+  Pka04,
+  Pka04Value,
+  Pka05,
+  Pka05Value,
+  Pka06,
+  Pka06Value,
+  Pka07,
+  Pka07Value,
+  Pka08,
+  Pka08Value,
+  Pka09,
+  Pka09Value,
+  Pka10,
+  Pka10Value,
+  Pka11,
+  Pka11Value,
+  Pka12,
+  Pka12Value,
+  Pka13,
+  Pka13Value,
+  Pka14,
+  Pka14Value,
+  Pka15,
+  Pka15Value,
+  Pka16,
+  Pka16Value,
+  Planck,
+  PlanckCharge,
+  PlanckCurrent,
+  PlanckDensity,
+  PlanckEnergy,
+  PlanckForce,
+  PlanckImpedance,
+  PlanckLength,
+  PlanckLinearMass,
+  PlanckMass,
+  PlanckPower,
+  PlanckPressure,
+  PlanckQuantityMovement,
+  PlanckReduce,
+  PlanckTemperature,
+  PlanckTension,
+  PlanckTime,
+  Poisson,
+  PowerRegressionFormula,
+  Prediction95CommandWithArg,
+  PredictionCommandWithArg,
+  ProductCommand,
+  ProductCommandWithArg,
+  ProportionalRegressionFormula,
+  ProtonMass,
+  PythonCommand1J,
+  PythonCommandAbs,
+  PythonCommandAcos,
+  PythonCommandAcosh,
+  PythonCommandAmpersand,
+  PythonCommandAppend,
+  PythonCommandAppendWithoutArg,
+  PythonCommandArrow,
+  PythonCommandAsin,
+  PythonCommandAsinh,
+  PythonCommandAtan,
+  PythonCommandAtan2,
+  PythonCommandAtanh,
+  PythonCommandAxis,
+  PythonCommandAxisWithoutArg,
+  PythonCommandBar,
+  PythonCommandBattery,
+  PythonCommandBatteryIscharging,
+  PythonCommandBatteryLevel,
+  PythonCommandBin,
+  PythonCommandCeil,
+  PythonCommandChoice,
+  PythonCommandClear,
+  PythonCommandClearWithoutArg,
+  PythonCommandCmathFunction,
+  PythonCommandCmathFunctionWithoutArg,
+  PythonCommandColon,
+  PythonCommandColor,
+  PythonCommandColorBlack,
+  PythonCommandColorBlue,
+  PythonCommandColorBrown,
+  PythonCommandColorGray,
+  PythonCommandColorGreen,
+  PythonCommandColorOrange,
+  PythonCommandColorPink,
+  PythonCommandColorPurple,
+  PythonCommandColorRed,
+  PythonCommandColorWhite,
+  PythonCommandColorYellow,
+  PythonCommandComplex,
+  PythonCommandConstantE,
+  PythonCommandConstantPi,
+  PythonCommandCopySign,
+  PythonCommandCos,
+  PythonCommandCosComplex,
+  PythonCommandCosh,
+  PythonCommandCount,
+  PythonCommandCountWithoutArg,
+  PythonCommandDef,
+  PythonCommandDefWithArg,
+  PythonCommandDegrees,
+  PythonCommandDivMod,
+  PythonCommandDrawCircle,
+  PythonCommandDrawLine,
+  PythonCommandDrawString,
+  PythonCommandErf,
+  PythonCommandErfc,
+  PythonCommandEval,
+  PythonCommandExclamationMark,
+  PythonCommandExp,
+  PythonCommandExpComplex,
+  PythonCommandExpm1,
+  PythonCommandFabs,
+  PythonCommandFactorial,
+  PythonCommandFileClose,
+  PythonCommandFileCloseWithoutArg,
+  PythonCommandFileClosed,
+  PythonCommandFileClosedWithoutArg,
+  PythonCommandFileMode,
+  PythonCommandFileModeWithoutArg,
+  PythonCommandFileName,
+  PythonCommandFileNameWithoutArg,
+  PythonCommandFileOpen,
+  PythonCommandFileOpenWithoutArg,
+  PythonCommandFileRead,
+  PythonCommandFileReadWithoutArg,
+  PythonCommandFileReadable,
+  PythonCommandFileReadableWithoutArg,
+  PythonCommandFileReadline,
+  PythonCommandFileReadlineWithoutArg,
+  PythonCommandFileReadlines,
+  PythonCommandFileReadlinesWithoutArg,
+  PythonCommandFileSeek,
+  PythonCommandFileSeekWithoutArg,
+  PythonCommandFileSeekable,
+  PythonCommandFileSeekableWithoutArg,
+  PythonCommandFileTell,
+  PythonCommandFileTellWithoutArg,
+  PythonCommandFileTruncate,
+  PythonCommandFileTruncateWithoutArg,
+  PythonCommandFileWritable,
+  PythonCommandFileWritableWithoutArg,
+  PythonCommandFileWrite,
+  PythonCommandFileWriteWithoutArg,
+  PythonCommandFileWritelines,
+  PythonCommandFileWritelinesWithoutArg,
+  PythonCommandFillCircle,
+  PythonCommandFillPolygon,
+  PythonCommandFillRect,
+  PythonCommandFloat,
+  PythonCommandFloor,
+  PythonCommandFmod,
+  PythonCommandFrExp,
+  PythonCommandGamma,
+  PythonCommandGetBrightness,
+  PythonCommandGetKeys,
+  PythonCommandGetPalette,
+  PythonCommandGetPixel,
+  PythonCommandGetrandbits,
+  PythonCommandGreaterThan,
+  PythonCommandGrid,
+  PythonCommandHex,
+  PythonCommandHist,
+  PythonCommandImag,
+  PythonCommandImagWithoutArg,
+  PythonCommandImportCmath,
+  PythonCommandImportFromCmath,
+  PythonCommandImportFromIon,
+  PythonCommandImportFromKandinsky,
+  PythonCommandImportFromMath,
+  PythonCommandImportFromMatplotlibPyplot,
+  PythonCommandImportFromNumpy,
+  PythonCommandImportFromOs,
+  PythonCommandImportFromRandom,
+  PythonCommandImportFromScipy,
+  PythonCommandImportFromSys,
+  PythonCommandImportFromTime,
+  PythonCommandImportFromTurtle,
+  PythonCommandImportFromUtils,
+  PythonCommandImportIon,
+  PythonCommandImportKandinsky,
+  PythonCommandImportMath,
+  PythonCommandImportMatplotlibPyplot,
+  PythonCommandImportOs,
+  PythonCommandImportRandom,
+  PythonCommandImportSys,
+  PythonCommandImportTime,
+  PythonCommandImportTurtle,
+  PythonCommandIndex,
+  PythonCommandIndexWithoutArg,
+  PythonCommandInput,
+  PythonCommandInsert,
+  PythonCommandInsertWithoutArg,
+  PythonCommandInt,
+  PythonCommandIonFunction,
+  PythonCommandIonFunctionWithoutArg,
+  PythonCommandIsFinite,
+  PythonCommandIsInfinite,
+  PythonCommandIsKeyDown,
+  PythonCommandIsNaN,
+  PythonCommandKandinskyFunction,
+  PythonCommandKandinskyFunctionWithoutArg,
+  PythonCommandKeyAlpha,
+  PythonCommandKeyAns,
+  PythonCommandKeyBack,
+  PythonCommandKeyBackspace,
+  PythonCommandKeyComma,
+  PythonCommandKeyCosine,
+  PythonCommandKeyDivision,
+  PythonCommandKeyDot,
+  PythonCommandKeyDown,
+  PythonCommandKeyEe,
+  PythonCommandKeyEight,
+  PythonCommandKeyExe,
+  PythonCommandKeyExp,
+  PythonCommandKeyFive,
+  PythonCommandKeyFour,
+  PythonCommandKeyHome,
+  PythonCommandKeyImaginary,
+  PythonCommandKeyLeft,
+  PythonCommandKeyLeftParenthesis,
+  PythonCommandKeyLn,
+  PythonCommandKeyLog,
+  PythonCommandKeyMinus,
+  PythonCommandKeyMultiplication,
+  PythonCommandKeyNine,
+  PythonCommandKeyOk,
+  PythonCommandKeyOnOff,
+  PythonCommandKeyOne,
+  PythonCommandKeyPi,
+  PythonCommandKeyPlus,
+  PythonCommandKeyPower,
+  PythonCommandKeyRight,
+  PythonCommandKeyRightParenthesis,
+  PythonCommandKeySeven,
+  PythonCommandKeyShift,
+  PythonCommandKeySine,
+  PythonCommandKeySix,
+  PythonCommandKeySqrt,
+  PythonCommandKeySquare,
+  PythonCommandKeyTangent,
+  PythonCommandKeyThree,
+  PythonCommandKeyToolbox,
+  PythonCommandKeyTwo,
+  PythonCommandKeyUp,
+  PythonCommandKeyVar,
+  PythonCommandKeyXnt,
+  PythonCommandKeyZero,
+  PythonCommandLF,
+  PythonCommandLdexp,
+  PythonCommandLength,
+  PythonCommandLessThan,
+  PythonCommandLgamma,
+  PythonCommandLocalTime,
+  PythonCommandLog,
+  PythonCommandLog10,
+  PythonCommandLog2,
+  PythonCommandLogComplex,
+  PythonCommandMathFunction,
+  PythonCommandMathFunctionWithoutArg,
+  PythonCommandMatplotlibPyplotFunction,
+  PythonCommandMatplotlibPyplotFunctionWithoutArg,
+  PythonCommandMax,
+  PythonCommandMin,
+  PythonCommandMktime,
+  PythonCommandModf,
+  PythonCommandMonotonic,
+  PythonCommandNumpyAcos,
+  PythonCommandNumpyAcosh,
+  PythonCommandNumpyAll,
+  PythonCommandNumpyAny,
+  PythonCommandNumpyArange,
+  PythonCommandNumpyArctan2,
+  PythonCommandNumpyArgmax,
+  PythonCommandNumpyArgmin,
+  PythonCommandNumpyArgsort,
+  PythonCommandNumpyAround,
+  PythonCommandNumpyArray,
+  PythonCommandNumpyAsin,
+  PythonCommandNumpyAsinh,
+  PythonCommandNumpyAtan,
+  PythonCommandNumpyAtanh,
+  PythonCommandNumpyBool,
+  PythonCommandNumpyCeil,
+  PythonCommandNumpyCholesky,
+  PythonCommandNumpyClip,
+  PythonCommandNumpyConcatenate,
+  PythonCommandNumpyConvolve,
+  PythonCommandNumpyCopy,
+  PythonCommandNumpyCopyWithoutArg,
+  PythonCommandNumpyCos,
+  PythonCommandNumpyCosh,
+  PythonCommandNumpyCross,
+  PythonCommandNumpyDegrees,
+  PythonCommandNumpyDet,
+  PythonCommandNumpyDiag,
+  PythonCommandNumpyDiff,
+  PythonCommandNumpyDot,
+  PythonCommandNumpyDtype,
+  PythonCommandNumpyDtypeWithoutArg,
+  PythonCommandNumpyE,
+  PythonCommandNumpyEig,
+  PythonCommandNumpyEmpty,
+  PythonCommandNumpyEqual,
+  PythonCommandNumpyExp,
+  PythonCommandNumpyExpm1,
+  PythonCommandNumpyEye,
+  PythonCommandNumpyFft,
+  PythonCommandNumpyFftFunction,
+  PythonCommandNumpyFftFunctionWithoutArg,
+  PythonCommandNumpyFlat,
+  PythonCommandNumpyFlatWithoutArg,
+  PythonCommandNumpyFlatten,
+  PythonCommandNumpyFlattenWithoutArg,
+  PythonCommandNumpyFlip,
+  PythonCommandNumpyFloat,
+  PythonCommandNumpyFloor,
+  PythonCommandNumpyFromBuffer,
+  PythonCommandNumpyFull,
+  PythonCommandNumpyFunction,
+  PythonCommandNumpyFunctionWithoutArg,
+  PythonCommandNumpyGetPrintOptions,
+  PythonCommandNumpyIfft,
+  PythonCommandNumpyInf,
+  PythonCommandNumpyInt16,
+  PythonCommandNumpyInt8,
+  PythonCommandNumpyInterp,
+  PythonCommandNumpyInv,
+  PythonCommandNumpyIsfinite,
+  PythonCommandNumpyIsinf,
+  PythonCommandNumpyLinalgFunction,
+  PythonCommandNumpyLinalgFunctionWithoutArg,
+  PythonCommandNumpyLinspace,
+  PythonCommandNumpyLog,
+  PythonCommandNumpyLog10,
+  PythonCommandNumpyLog2,
+  PythonCommandNumpyLogspace,
+  PythonCommandNumpyMax,
+  PythonCommandNumpyMaximum,
+  PythonCommandNumpyMean,
+  PythonCommandNumpyMedian,
+  PythonCommandNumpyMin,
+  PythonCommandNumpyMinimum,
+  PythonCommandNumpyNan,
+  PythonCommandNumpyNdinfo,
+  PythonCommandNumpyNorm,
+  PythonCommandNumpyNot_equal,
+  PythonCommandNumpyOnes,
+  PythonCommandNumpyPi,
+  PythonCommandNumpyPolyfit,
+  PythonCommandNumpyPolyval,
+  PythonCommandNumpyRadians,
+  PythonCommandNumpyReshape,
+  PythonCommandNumpyReshapeWithoutArg,
+  PythonCommandNumpyRoll,
+  PythonCommandNumpySetPrintOptions,
+  PythonCommandNumpyShape,
+  PythonCommandNumpyShapeWithoutArg,
+  PythonCommandNumpySin,
+  PythonCommandNumpySinh,
+  PythonCommandNumpySize,
+  PythonCommandNumpySizeWithoutArg,
+  PythonCommandNumpySort,
+  PythonCommandNumpySortWithArguments,
+  PythonCommandNumpySortWithoutArg,
+  PythonCommandNumpySqrt,
+  PythonCommandNumpyStd,
+  PythonCommandNumpySum,
+  PythonCommandNumpyTan,
+  PythonCommandNumpyTanh,
+  PythonCommandNumpyToBytes,
+  PythonCommandNumpyToBytesWithoutArg,
+  PythonCommandNumpyTrace,
+  PythonCommandNumpyTranspose,
+  PythonCommandNumpyTransposeWithoutArg,
+  PythonCommandNumpyTrapz,
+  PythonCommandNumpyUint16,
+  PythonCommandNumpyUint8,
+  PythonCommandNumpyVectorize,
+  PythonCommandNumpyWhere,
+  PythonCommandNumpyZeros,
+  PythonCommandOct,
+  PythonCommandPercent,
+  PythonCommandPhase,
+  PythonCommandPlot,
+  PythonCommandPolar,
+  PythonCommandPop,
+  PythonCommandPopWithoutArg,
+  PythonCommandPound,
+  PythonCommandPower,
+  PythonCommandPrint,
+  PythonCommandQuestionMark,
+  PythonCommandRTCmode,
+  PythonCommandRadians,
+  PythonCommandRandint,
+  PythonCommandRandom,
+  PythonCommandRandomFunction,
+  PythonCommandRandomFunctionWithoutArg,
+  PythonCommandRandrange,
+  PythonCommandRangeStartStop,
+  PythonCommandRangeStop,
+  PythonCommandReal,
+  PythonCommandRealWithoutArg,
+  PythonCommandRect,
+  PythonCommandRemove,
+  PythonCommandRemoveWithoutArg,
+  PythonCommandReturn,
+  PythonCommandReverse,
+  PythonCommandReverseWithoutArg,
+  PythonCommandRound,
+  PythonCommandScatter,
+  PythonCommandScipyFunction,
+  PythonCommandScipyFunctionWithoutArg,
+  PythonCommandScipyLinalgChoSolve,
+  PythonCommandScipyLinalgFunction,
+  PythonCommandScipyLinalgFunctionWithoutArg,
+  PythonCommandScipyLinalgSolveTriangular,
+  PythonCommandScipyOptimizeBisect,
+  PythonCommandScipyOptimizeFmin,
+  PythonCommandScipyOptimizeFunction,
+  PythonCommandScipyOptimizeFunctionWithoutArg,
+  PythonCommandScipyOptimizeNewton,
+  PythonCommandScipySignalFunction,
+  PythonCommandScipySignalFunctionWithoutArg,
+  PythonCommandScipySignalSosfilt,
+  PythonCommandScipySignalSpectrogram,
+  PythonCommandScipySpecialErf,
+  PythonCommandScipySpecialErfc,
+  PythonCommandScipySpecialFunction,
+  PythonCommandScipySpecialFunctionWithoutArg,
+  PythonCommandScipySpecialGamma,
+  PythonCommandScipySpecialGammaln,
+  PythonCommandSeed,
+  PythonCommandSemicon,
+  PythonCommandSetBrightness,
+  PythonCommandSetLocaltime,
+  PythonCommandSetPixel,
+  PythonCommandSetRTCmode,
+  PythonCommandShow,
+  PythonCommandSin,
+  PythonCommandSinComplex,
+  PythonCommandSingleQuote,
+  PythonCommandSinh,
+  PythonCommandSleep,
+  PythonCommandSort,
+  PythonCommandSortWithoutArg,
+  PythonCommandSorted,
+  PythonCommandSqrt,
+  PythonCommandSqrtComplex,
+  PythonCommandSum,
+  PythonCommandSymbolExp,
+  PythonCommandTab,
+  PythonCommandTan,
+  PythonCommandTanh,
+  PythonCommandText,
+  PythonCommandTime,
+  PythonCommandTimeFunction,
+  PythonCommandTimeFunctionWithoutArg,
+  PythonCommandTrunc,
+  PythonCommandTurtleFunction,
+  PythonCommandTurtleFunctionWithoutArg,
+  PythonCommandUniform,
+  PythonCommandUtilsFromInt16Buffer,
+  PythonCommandUtilsFromInt32Buffer,
+  PythonCommandUtilsFromUint16Buffer,
+  PythonCommandUtilsFromUint32Buffer,
+  PythonCommandUtilsFunction,
+  PythonCommandUtilsFunctionWithoutArg,
+  PythonCommandUtilsSpectrogram,
+  PythonCommandVerticalBar,
+  PythonConstantE,
+  PythonConstantPi,
+  PythonOsCommandGetlogin,
+  PythonOsCommandListdir,
+  PythonOsCommandRemove,
+  PythonOsCommandRemoveWithoutArg,
+  PythonOsCommandRename,
+  PythonOsCommandRenameWithoutArg,
+  PythonOsCommandUname,
+  PythonSysCommandByteorder,
+  PythonSysCommandExit,
+  PythonSysCommandImplementation,
+  PythonSysCommandModules,
+  PythonSysCommandPrintexception,
+  PythonSysCommandPrintexceptionWithoutArg,
+  PythonSysCommandVersion,
+  PythonSysCommandVersioninfo,
+  PythonTurtleCommandBackward,
+  PythonTurtleCommandCircle,
+  PythonTurtleCommandColor,
+  PythonTurtleCommandColorMode,
+  PythonTurtleCommandForward,
+  PythonTurtleCommandGoto,
+  PythonTurtleCommandHeading,
+  PythonTurtleCommandHideturtle,
+  PythonTurtleCommandIsdown,
+  PythonTurtleCommandLeft,
+  PythonTurtleCommandPendown,
+  PythonTurtleCommandPensize,
+  PythonTurtleCommandPenup,
+  PythonTurtleCommandPosition,
+  PythonTurtleCommandReset,
+  PythonTurtleCommandRight,
+  PythonTurtleCommandSetheading,
+  PythonTurtleCommandShowturtle,
+  PythonTurtleCommandSpeed,
+  PythonTurtleCommandWrite,
+  QuadraticRegressionFormula,
+  QuarticRegressionFormula,
+  QuentinGuidee,
+  QuoCommandWithArg,
+  R,
+  Rad,
+  RandintCommandWithArg,
+  RandomCommandWithArg,
+  RandomModule,
+  ReCommandWithArg,
+  ReducedRowEchelonFormCommandWithArg,
+  Reg,
+  RemCommandWithArg,
+  RightIntegralFirstLegend,
+  RightIntegralSecondLegend,
+  RootCommandWithArg,
+  RoundCommandWithArg,
+  RowEchelonFormCommandWithArg,
+  Rstvt_Air,
+  Rstvt_Aluminium,
+  Rstvt_Calcium,
+  Rstvt_Cobalt,
+  Rstvt_Copper,
+  Rstvt_Glass,
+  Rstvt_Gold,
+  Rstvt_Iron,
+  Rstvt_Lithium,
+  Rstvt_Nickel,
+  Rstvt_Platinum,
+  Rstvt_Sea_water,
+  Rstvt_Silver,
+  Rstvt_Tin,
+  Rstvt_Tungsten,
+  Rstvt_Water,
+  Rstvt_Wood,
+  Rstvt_Zinc,
+  RydbergConstant,
+  SandraSimmons,
+  ScipyLinalgModule,
+  ScipyModule,
+  ScipyOptimizeModule,
+  ScipySignalModule,
+  ScipySpecialModule,
+  Shift,
+  Sigma,
+  SinhCommandWithArg,
+  SortCommandWithArg,
+  SpeedOfLight,
+  SpeedOfSound0,
+  SpeedOfSoundGlass,
+  SpeedOfSoundSteel,
+  SpeedOfSoundWater,
+  StefanBoltzmann,
+  Student,
+  SumCommand,
+  SumCommandWithArg,
+  SunMass,
+  SunRadius,
+  SuperiorCondition,
+  SuperiorConditionWithArg,
+  SuperiorStrictCondition,
+  SuperiorStrictConditionWithArg,
+  Sxy,
+  SysModule,
+  SzaboLevente,
+  T,
+  TMax,
+  TMin,
+  TanhCommandWithArg,
+  TauonMass,
+  Theta,
+  ThetaMax,
+  ThetaMin,
+  TimeModule,
+  TraceCommandWithArg,
+  TransposeCommandWithArg,
+  TrigonometricRegressionFormula,
+  TryExcept1Error,
+  TryExcept1ErrorElse,
+  TryExcept1ErrorElseWithArg,
+  TryExcept1ErrorWithArg,
+  TryExcept2Error,
+  TryExcept2ErrorWithArg,
+  TurtleModule,
+  USBAppCapital,
+  UlabDocumentationLink,
+  UlabModule,
+  UltimateAnswer,
+  UltimateAnswerValue,
+  UnitAmountMoleMicroSymbol,
+  UnitAmountMoleMilliSymbol,
+  UnitAmountMoleSymbol,
+  UnitCapacitanceFarad,
+  UnitCapacitanceFaradMicroSymbol,
+  UnitCapacitanceFaradMilliSymbol,
+  UnitCapacitanceFaradSymbol,
+  UnitChargeCoulomb,
+  UnitChargeCoulombSymbol,
+  UnitConductanceSiemens,
+  UnitConductanceSiemensMilliSymbol,
+  UnitConductanceSiemensSymbol,
+  UnitCurrentAmpereMicroSymbol,
+  UnitCurrentAmpereMilliSymbol,
+  UnitCurrentAmpereSymbol,
+  UnitDistanceAstronomicalUnitSymbol,
+  UnitDistanceFootSymbol,
+  UnitDistanceInchSymbol,
+  UnitDistanceLightYearSymbol,
+  UnitDistanceMeterKiloSymbol,
+  UnitDistanceMeterMicroSymbol,
+  UnitDistanceMeterMilliSymbol,
+  UnitDistanceMeterNanoSymbol,
+  UnitDistanceMeterPicoSymbol,
+  UnitDistanceMeterSymbol,
+  UnitDistanceMileSymbol,
+  UnitDistanceParsecSymbol,
+  UnitDistanceYardSymbol,
+  UnitEnergyElectronVoltKiloSymbol,
+  UnitEnergyElectronVoltMegaSymbol,
+  UnitEnergyElectronVoltMilliSymbol,
+  UnitEnergyElectronVoltSymbol,
+  UnitEnergyJoule,
+  UnitEnergyJouleKilo,
+  UnitEnergyJouleKiloSymbol,
+  UnitEnergyJouleMenu,
+  UnitEnergyJouleMilliSymbol,
+  UnitEnergyJouleSymbol,
+  UnitForceNewton,
+  UnitForceNewtonKilo,
+  UnitForceNewtonKiloSymbol,
+  UnitForceNewtonMilliSymbol,
+  UnitForceNewtonSymbol,
+  UnitFrequencyHertz,
+  UnitFrequencyHertzGiga,
+  UnitFrequencyHertzGigaSymbol,
+  UnitFrequencyHertzKilo,
+  UnitFrequencyHertzKiloSymbol,
+  UnitFrequencyHertzMegaSymbol,
+  UnitFrequencyHertzSymbol,
+  UnitIlluminanceLuxSymbol,
+  UnitInductanceHenry,
+  UnitInductanceHenrySymbol,
+  UnitLuminousFluxLumenSymbol,
+  UnitLuminousIntensityCandela,
+  UnitLuminousIntensityCandelaSymbol,
+  UnitMagneticFieldTesla,
+  UnitMagneticFieldTeslaSymbol,
+  UnitMassGramKiloSymbol,
+  UnitMassGramMicroSymbol,
+  UnitMassGramMilliSymbol,
+  UnitMassGramSymbol,
+  UnitMassLongTonSymbol,
+  UnitMassOunceSymbol,
+  UnitMassPoundSymbol,
+  UnitMassShortTonSymbol,
+  UnitMassTonneSymbol,
+  UnitPotentialVolt,
+  UnitPotentialVoltKilo,
+  UnitPotentialVoltKiloSymbol,
+  UnitPotentialVoltMicroSymbol,
+  UnitPotentialVoltMilliSymbol,
+  UnitPotentialVoltSymbol,
+  UnitPowerWatt,
+  UnitPowerWattGiga,
+  UnitPowerWattGigaSymbol,
+  UnitPowerWattKilo,
+  UnitPowerWattKiloSymbol,
+  UnitPowerWattMegaSymbol,
+  UnitPowerWattMicroSymbol,
+  UnitPowerWattMilliSymbol,
+  UnitPowerWattSymbol,
+  UnitPressureAtmSymbol,
+  UnitPressureBar,
+  UnitPressureBarSymbol,
+  UnitPressurePascal,
+  UnitPressurePascalHectoSymbol,
+  UnitPressurePascalSymbol,
+  UnitResistanceOhm,
+  UnitResistanceOhmKilo,
+  UnitResistanceOhmKiloSymbol,
+  UnitResistanceOhmSymbol,
+  UnitSolidAngleSteradianSymbol,
+  UnitSurfaceAcreSymbol,
+  UnitSurfaceHectarSymbol,
+  UnitTemperatureCelsius,
+  UnitTemperatureCelsiusSymbol,
+  UnitTemperatureFahrenheit,
+  UnitTemperatureFahrenheitSymbol,
+  UnitTemperatureKelvin,
+  UnitTemperatureKelvinSymbol,
+  UnitTimeDaySymbol,
+  UnitTimeHourSymbol,
+  UnitTimeMinuteSymbol,
+  UnitTimeMonthSymbol,
+  UnitTimeSecondMicroSymbol,
+  UnitTimeSecondMilliSymbol,
+  UnitTimeSecondNanoSymbol,
+  UnitTimeSecondSymbol,
+  UnitTimeWeekSymbol,
+  UnitTimeYearSymbol,
+  UnitVolumeCupSymbol,
+  UnitVolumeFluidOunceSymbol,
+  UnitVolumeGallonSymbol,
+  UnitVolumeLiterCentiSymbol,
+  UnitVolumeLiterDeciSymbol,
+  UnitVolumeLiterMilliSymbol,
+  UnitVolumeLiterSymbol,
+  UnitVolumePintSymbol,
+  UnitVolumeQuartSymbol,
+  UnitVolumeTablespoonSymbol,
+  UnitVolumeTeaspoonSymbol,
+  UsbSetting,
+  UtilsModule,
+  VacuumImpedance,
+  Vacuum_permeability,
+  Vacuum_permittivity,
+  VenceslasDuet,
+  VictorKretz,
+  WBosonMass,
+  WaterTriplePoint,
+  WhileLoop,
+  WhileLoopMenu,
+  WhileLoopWithArg,
+  Wien,
+  WithInstruction,
+  WithInstructionWithArg,
+  X,
+  XMax,
+  XMin,
+  Y,
+  YMax,
+  YMin,
+  YannCouturier,
+  ZBosonMass,
+
+  LocalizedMessageMarker,
+
+  About,
+  AboutWarning1,
+  AboutWarning2,
+  AboutWarning3,
+  AboutWarning4,
+  AbsoluteValue,
+  Accessibility,
+  AccessibilityGamma,
+  AccessibilityGammaBlue,
+  AccessibilityGammaGreen,
+  AccessibilityGammaRed,
+  AccessibilityInvertColors,
+  AccessibilityMagnify,
+  ActivateClock,
+  ActivateDeactivate,
+  ActivateExamMode,
+  ActiveExamModeMessage1,
+  ActiveExamModeMessage2,
+  ActiveExamModeMessage3,
+  AddEquation,
+  AddFunction,
+  AddScript,
+  AddSequence,
+  AdditionalDeterminant,
+  AdditionalInverse,
+  AdditionalReducedRowEchelonForm,
+  AdditionalResults,
+  AdditionalRowEchelonForm,
+  AdditionalTrace,
+  Air,
+  AllowedCharactersAZaz09,
+  AllowedCharactersaz09,
+  AlphaElementAc,
+  AlphaElementAg,
+  AlphaElementAl,
+  AlphaElementAm,
+  AlphaElementAr,
+  AlphaElementAs,
+  AlphaElementAt,
+  AlphaElementAu,
+  AlphaElementB,
+  AlphaElementBa,
+  AlphaElementBe,
+  AlphaElementBh,
+  AlphaElementBi,
+  AlphaElementBk,
+  AlphaElementBr,
+  AlphaElementC,
+  AlphaElementCa,
+  AlphaElementCd,
+  AlphaElementCe,
+  AlphaElementCf,
+  AlphaElementCl,
+  AlphaElementCm,
+  AlphaElementCn,
+  AlphaElementCo,
+  AlphaElementCr,
+  AlphaElementCs,
+  AlphaElementCu,
+  AlphaElementDb,
+  AlphaElementDs,
+  AlphaElementDy,
+  AlphaElementEr,
+  AlphaElementEs,
+  AlphaElementEu,
+  AlphaElementF,
+  AlphaElementFe,
+  AlphaElementFl,
+  AlphaElementFm,
+  AlphaElementFr,
+  AlphaElementGa,
+  AlphaElementGd,
+  AlphaElementGe,
+  AlphaElementH,
+  AlphaElementHe,
+  AlphaElementHf,
+  AlphaElementHg,
+  AlphaElementHo,
+  AlphaElementHs,
+  AlphaElementI,
+  AlphaElementIn,
+  AlphaElementIr,
+  AlphaElementK,
+  AlphaElementKr,
+  AlphaElementLa,
+  AlphaElementLi,
+  AlphaElementLr,
+  AlphaElementLu,
+  AlphaElementLv,
+  AlphaElementMc,
+  AlphaElementMd,
+  AlphaElementMg,
+  AlphaElementMn,
+  AlphaElementMo,
+  AlphaElementMt,
+  AlphaElementN,
+  AlphaElementNa,
+  AlphaElementNb,
+  AlphaElementNd,
+  AlphaElementNe,
+  AlphaElementNh,
+  AlphaElementNi,
+  AlphaElementNo,
+  AlphaElementNp,
+  AlphaElementO,
+  AlphaElementOg,
+  AlphaElementOs,
+  AlphaElementP,
+  AlphaElementPa,
+  AlphaElementPb,
+  AlphaElementPd,
+  AlphaElementPm,
+  AlphaElementPo,
+  AlphaElementPr,
+  AlphaElementPt,
+  AlphaElementPu,
+  AlphaElementRa,
+  AlphaElementRb,
+  AlphaElementRe,
+  AlphaElementRf,
+  AlphaElementRg,
+  AlphaElementRh,
+  AlphaElementRn,
+  AlphaElementRu,
+  AlphaElementS,
+  AlphaElementSb,
+  AlphaElementSc,
+  AlphaElementSe,
+  AlphaElementSg,
+  AlphaElementSi,
+  AlphaElementSm,
+  AlphaElementSn,
+  AlphaElementSr,
+  AlphaElementTa,
+  AlphaElementTb,
+  AlphaElementTc,
+  AlphaElementTe,
+  AlphaElementTh,
+  AlphaElementTi,
+  AlphaElementTl,
+  AlphaElementTm,
+  AlphaElementTs,
+  AlphaElementU,
+  AlphaElementUbn,
+  AlphaElementUue,
+  AlphaElementV,
+  AlphaElementW,
+  AlphaElementXe,
+  AlphaElementY,
+  AlphaElementYb,
+  AlphaElementZn,
+  AlphaElementZr,
+  Aluminium,
+  AmountOfSubstanceDimension,
+  AngleUnit,
+  ApproximateSolution,
+  ApproximateSolutionIntervalInstruction0,
+  ApproximateSolutionIntervalInstruction1,
+  Apps,
+  AppsCapital,
+  Argument,
+  Arithmetic,
+  AtmosphericPressureTag,
+  AtomicMassUnitTag,
+  AutoImportScript,
+  Autocomplete,
+  AvogadroTag,
+  Axis,
+  BarStart,
+  BasedLogarithm,
+  Battery,
+  BetaPopUp,
+  BetaVersion,
+  BetaVersionMessage1,
+  BetaVersionMessage2,
+  BetaVersionMessage3,
+  BetaVersionMessage4,
+  BetaVersionMessage5,
+  BetaVersionMessage6,
+  BinaryBase,
+  Binomial,
+  BinomialCDF,
+  BinomialDistribution,
+  BinomialPDF,
+  BohrMagnetonTag,
+  BohrRadiusTag,
+  BoltzmannTag,
+  BoxTab,
+  Brightness,
+  BrightnessSettings,
+  BrightnessShortcut,
+  BuiltinsAndKeywords,
+  Calcium,
+  CalculApp,
+  CalculAppCapital,
+  Calculation,
+  Cancel,
+  CanonicalForm,
+  Cartesian,
+  CartesianType,
+  Catalog,
+  CatalyticActivityDimension,
+  Ceiling,
+  Chemistry,
+  ChiSquared,
+  ChiSquaredDistribution,
+  ChooseDistribution,
+  ChooseParameters,
+  ChooseSequenceType,
+  CirculationQuantumTag,
+  ClearColumn,
+  Cobalt,
+  ColorBlue,
+  ColorCyan,
+  ColorGreen,
+  ColorOrange,
+  ColorPink,
+  ColorPurple,
+  ColorRed,
+  ColorYellow,
+  ColumnOptions,
+  Combination,
+  Combinatorics,
+  ComplexAbsoluteValue,
+  ComplexFormat,
+  ComplexNumber,
+  Compute,
+  ComputeProbability,
+  ConductanceQuantumTag,
+  ConductivityConstants,
+  Confidence,
+  ConfirmDiscard1,
+  ConfirmDiscard2,
+  Conjugate,
+  ConnectedMessage1,
+  ConnectedMessage2,
+  ConnectedMessage3,
+  ConnectedMessage4,
+  ConnectedMessage5,
+  ConnectedMessage6,
+  Console,
+  Contributors,
+  Copper,
+  CopyColumnInList,
+  CoulombTag,
+  Country,
+  CountryCA,
+  CountryDE,
+  CountryES,
+  CountryFR,
+  CountryGB,
+  CountryIT,
+  CountryNL,
+  CountryPT,
+  CountryUS,
+  CountryWW,
+  CountryWarning1,
+  CountryWarning2,
+  Covariance,
+  Cross,
+  Cubic,
+  CurrentDimension,
+  CurveType,
+  D1FisherDefinition,
+  D2FisherDefinition,
+  DataNotSuitable,
+  DataNotSuitableForRegression,
+  DataTab,
+  Date,
+  DateTime,
+  Decimal,
+  DecimalBase,
+  Deg,
+  Degrees,
+  DegreesOfFreedomDefinition,
+  DeleteFunction,
+  DeleteScript,
+  DeleteSequence,
+  DerivateNumber,
+  DerivativeFunctionColumn,
+  Determinant,
+  Deviation,
+  DeviationDefinition,
+  Dimension,
+  Discriminant,
+  DisplayMode,
+  DisplayValues,
+  DistanceDimension,
+  Distances,
+  Dot,
+  DoubleRecurrence,
+  DuplicateScript,
+  EarthMassTag,
+  EarthMoonDistanceTag,
+  EarthSunDistanceTag,
+  Edition2D,
+  EditionLinear,
+  EditionMode,
+  ElectricCapacitanceDimension,
+  ElectricChargeDimension,
+  ElectricConductanceDimension,
+  ElectricPotentialDimension,
+  ElectricResistanceDimension,
+  Electricity,
+  Electromagnetism,
+  ElectronMassTag,
+  ElementalChargeTag,
+  Empty,
+  EmptyExpressionBox0,
+  EmptyExpressionBox1,
+  EmptyExpressionBox2,
+  EmptyFunctionBox0,
+  EmptyFunctionBox1,
+  EmptyFunctionBox2,
+  EmptySequenceBox0,
+  EmptySequenceBox1,
+  EnableCharacters,
+  EnergyDimension,
+  Eng,
+  Engineering,
+  EnterEquation,
+  EscapeVelocity,
+  EscapeVelocityFromEarth,
+  EscapeVelocityFromMoon,
+  EscapeVelocityFromSun,
+  EuclideanDivision,
+  ExamMode,
+  ExamModeActive,
+  ExamModeMode,
+  ExamModeModeDutch,
+  ExamModeModeNoSym,
+  ExamModeModeNoSymNoText,
+  ExamModeModeStandard,
+  ExamModeWarning1,
+  ExamModeWarning2,
+  ExamModeWarning3,
+  Exceptions,
+  ExecuteScript,
+  ExitExamMode1,
+  ExitExamMode2,
+  Explicit,
+  Exponential,
+  ExponentialDistribution,
+  Expressions,
+  ExtAppEnabled,
+  ExtAppWrite,
+  ExtAppWriteExplanation1,
+  ExtAppWriteExplanation2,
+  ExtAppWriteExplanation3,
+  ExternalApps,
+  Factorial,
+  FactorizedForm,
+  FaradayConstantTag,
+  Files,
+  FillWithFormula,
+  FineStructureTag,
+  FirstQuartile,
+  FirstRoot,
+  FirstTermIndex,
+  FisherDistribution,
+  Floor,
+  Fluctuation,
+  FontSizes,
+  ForbiddenAppInExamMode1,
+  ForbiddenAppInExamMode2,
+  ForbiddenValue,
+  ForceDimension,
+  FracPart,
+  Frequencies1,
+  Frequencies2,
+  Frequencies3,
+  Frequency,
+  FrequencyDimension,
+  FunctionApp,
+  FunctionAppCapital,
+  FunctionColor,
+  FunctionDomain,
+  FunctionOptions,
+  FunctionTab,
+  Functions,
+  FunctionsAndVariables,
+  FundamentalConstants,
+  GAccelerationTag,
+  GConstantTag,
+  GasTag,
+  Geometric,
+  GeometricDistribution,
+  GeometricMean,
+  Glass,
+  Gold,
+  Goto,
+  Gradians,
+  GraphTab,
+  Gravitation,
+  GreatCommonDivisor,
+  HardwareTestLaunch1,
+  HardwareTestLaunch2,
+  HardwareTestLaunch3,
+  HardwareTestLaunch4,
+  HarmonicMean,
+  HartreeConstantTag,
+  HexadecimalBase,
+  HideDerivativeColumn,
+  HistogramSet,
+  HistogramTab,
+  HyperbolicCosine,
+  HyperbolicSine,
+  HyperbolicTangent,
+  HyperbolicTrigonometry,
+  Identity,
+  IdleTimeBeforeDimming,
+  IdleTimeBeforeSuspend,
+  ImaginaryPart,
+  ImportedModulesAndScripts,
+  InductanceDimension,
+  InductanceMenu,
+  InfiniteNumberOfSolutions,
+  InfinityMessage,
+  Integral,
+  InterquartileRange,
+  Intersection,
+  Interval,
+  IntervalDefinition,
+  IntervalSet,
+  IntervalT,
+  IntervalTheta,
+  IntervalX,
+  InvBinomial,
+  InvNorm,
+  InvSort,
+  Inverse,
+  InverseHyperbolicCosine,
+  InverseHyperbolicSine,
+  InverseHyperbolicTangent,
+  IonKeyList,
+  IonSelector,
+  Iron,
+  LambdaExponentialDefinition,
+  LambdaPoissonDefinition,
+  Language,
+  LargeFont,
+  LeastCommonMultiple,
+  Length,
+  Linear,
+  Lists,
+  Lithium,
+  Logarithmic,
+  Logistic,
+  LoopsAndTests,
+  LowBattery,
+  LuminousIntensityDimension,
+  MagneticFieldDimension,
+  MagneticFluxDimension,
+  MagneticFluxQuantumTag,
+  Mass,
+  MassDimension,
+  MathOptions,
+  Matrices,
+  MatricesAndVectors,
+  Maximum,
+  Mean,
+  MeanDefinition,
+  MeanDot,
+  Median,
+  MemUse,
+  MicroPythonVersion,
+  Minimum,
+  MixedFraction,
+  Modules,
+  MolarMassesByAlpha,
+  MolarMassesByNumber,
+  MoonMassTag,
+  Move,
+  MuonMassTag,
+  NColumn,
+  NEnd,
+  NStart,
+  NameCannotStartWithNumber,
+  NameTaken,
+  NameTooLong,
+  Navigate,
+  NeutronMassTag,
+  NewMatrix,
+  Next,
+  Nickel,
+  NoActivatedFunction,
+  NoActivatedSequence,
+  NoDataToPlot,
+  NoFunction,
+  NoIntersectionFound,
+  NoMaximumFound,
+  NoMinimumFound,
+  NoPreimageFound,
+  NoSequence,
+  NoSolutionEquation,
+  NoSolutionInterval,
+  NoSolutionSystem,
+  NoValueToCompute,
+  NoWordAvailableHere,
+  NoZeroFound,
+  NonLinearSystem,
+  NormCDF,
+  NormCDF2,
+  NormPDF,
+  NormVector,
+  Normal,
+  NormalDistribution,
+  NthRoot,
+  NuclearConstants,
+  NuclearMagnetonTag,
+  NumberElementAc,
+  NumberElementAg,
+  NumberElementAl,
+  NumberElementAm,
+  NumberElementAr,
+  NumberElementAs,
+  NumberElementAt,
+  NumberElementAu,
+  NumberElementB,
+  NumberElementBa,
+  NumberElementBe,
+  NumberElementBh,
+  NumberElementBi,
+  NumberElementBk,
+  NumberElementBr,
+  NumberElementC,
+  NumberElementCa,
+  NumberElementCd,
+  NumberElementCe,
+  NumberElementCf,
+  NumberElementCl,
+  NumberElementCm,
+  NumberElementCn,
+  NumberElementCo,
+  NumberElementCr,
+  NumberElementCs,
+  NumberElementCu,
+  NumberElementDb,
+  NumberElementDs,
+  NumberElementDy,
+  NumberElementEr,
+  NumberElementEs,
+  NumberElementEu,
+  NumberElementF,
+  NumberElementFe,
+  NumberElementFl,
+  NumberElementFm,
+  NumberElementFr,
+  NumberElementGa,
+  NumberElementGd,
+  NumberElementGe,
+  NumberElementH,
+  NumberElementHe,
+  NumberElementHf,
+  NumberElementHg,
+  NumberElementHo,
+  NumberElementHs,
+  NumberElementI,
+  NumberElementIn,
+  NumberElementIr,
+  NumberElementK,
+  NumberElementKr,
+  NumberElementLa,
+  NumberElementLi,
+  NumberElementLr,
+  NumberElementLu,
+  NumberElementLv,
+  NumberElementMc,
+  NumberElementMd,
+  NumberElementMg,
+  NumberElementMn,
+  NumberElementMo,
+  NumberElementMt,
+  NumberElementN,
+  NumberElementNa,
+  NumberElementNb,
+  NumberElementNd,
+  NumberElementNe,
+  NumberElementNh,
+  NumberElementNi,
+  NumberElementNo,
+  NumberElementNp,
+  NumberElementO,
+  NumberElementOg,
+  NumberElementOs,
+  NumberElementP,
+  NumberElementPa,
+  NumberElementPb,
+  NumberElementPd,
+  NumberElementPm,
+  NumberElementPo,
+  NumberElementPr,
+  NumberElementPt,
+  NumberElementPu,
+  NumberElementRa,
+  NumberElementRb,
+  NumberElementRe,
+  NumberElementRf,
+  NumberElementRg,
+  NumberElementRh,
+  NumberElementRn,
+  NumberElementRu,
+  NumberElementS,
+  NumberElementSb,
+  NumberElementSc,
+  NumberElementSe,
+  NumberElementSg,
+  NumberElementSi,
+  NumberElementSm,
+  NumberElementSn,
+  NumberElementSr,
+  NumberElementTa,
+  NumberElementTb,
+  NumberElementTc,
+  NumberElementTe,
+  NumberElementTh,
+  NumberElementTi,
+  NumberElementTl,
+  NumberElementTm,
+  NumberElementTs,
+  NumberElementU,
+  NumberElementUbn,
+  NumberElementUue,
+  NumberElementV,
+  NumberElementW,
+  NumberElementXe,
+  NumberElementY,
+  NumberElementYb,
+  NumberElementZn,
+  NumberElementZr,
+  NumberOfDots,
+  Ok,
+  OmegaVersion,
+  OnlyFirstSolutionsDisplayed0,
+  OnlyFirstSolutionsDisplayed1,
+  OnlyRoot,
+  Or,
+  Orthonormal,
+  ParametricType,
+  ParticleMass,
+  Permutation,
+  Physics,
+  PlanckChargeTag,
+  PlanckCurrentTag,
+  PlanckDensityTag,
+  PlanckEnergyTag,
+  PlanckForceTag,
+  PlanckImpedanceTag,
+  PlanckLengthTag,
+  PlanckLinearMassTag,
+  PlanckMassTag,
+  PlanckPowerTag,
+  PlanckPressureTag,
+  PlanckQuantityMovementTag,
+  PlanckReduceTag,
+  PlanckTag,
+  PlanckTemperatureTag,
+  PlanckTensionTag,
+  PlanckTimeTag,
+  PlanckUnitsTag,
+  Platinum,
+  Plot,
+  PlotOptions,
+  PoissonDistribution,
+  Polar,
+  PolarType,
+  PolynomeHasNoRealSolution0,
+  PolynomeHasNoRealSolution1,
+  PoolMemoryFull1,
+  PoolMemoryFull2,
+  Power,
+  PowerDimension,
+  PredefinedVariablesIgnoredLeft,
+  PredefinedVariablesIgnoredRight,
+  PredefinedVariablesUsedLeft,
+  PredefinedVariablesUsedRight,
+  Prediction,
+  Prediction95,
+  Preimage,
+  PressAKey,
+  PressureDimension,
+  PrimeFactorDecomposition,
+  PrimeFactors,
+  ProbaApp,
+  ProbaAppCapital,
+  Probability,
+  Product,
+  Proportional,
+  ProtonMassTag,
+  Python1J,
+  PythonAbs,
+  PythonAcos,
+  PythonAcosh,
+  PythonAmpersand,
+  PythonAppend,
+  PythonArrow,
+  PythonAsin,
+  PythonAsinh,
+  PythonAtan,
+  PythonAtan2,
+  PythonAtanh,
+  PythonAxis,
+  PythonBar,
+  PythonBattery,
+  PythonBatteryIscharging,
+  PythonBatteryLevel,
+  PythonBin,
+  PythonCeil,
+  PythonChoice,
+  PythonClear,
+  PythonCmathFunction,
+  PythonColon,
+  PythonColor,
+  PythonColorBlack,
+  PythonColorBlue,
+  PythonColorBrown,
+  PythonColorGray,
+  PythonColorGreen,
+  PythonColorOrange,
+  PythonColorPink,
+  PythonColorPurple,
+  PythonColorRed,
+  PythonColorWhite,
+  PythonColorYellow,
+  PythonComplex,
+  PythonCopySign,
+  PythonCos,
+  PythonCosh,
+  PythonCount,
+  PythonDegrees,
+  PythonDivMod,
+  PythonDrawCircle,
+  PythonDrawLine,
+  PythonDrawString,
+  PythonErf,
+  PythonErfc,
+  PythonEval,
+  PythonExclamationMark,
+  PythonExp,
+  PythonExpm1,
+  PythonFabs,
+  PythonFactorial,
+  PythonFileClose,
+  PythonFileClosed,
+  PythonFileMode,
+  PythonFileName,
+  PythonFileOpen,
+  PythonFileRead,
+  PythonFileReadable,
+  PythonFileReadline,
+  PythonFileReadlines,
+  PythonFileSeek,
+  PythonFileSeekable,
+  PythonFileTell,
+  PythonFileTruncate,
+  PythonFileWritable,
+  PythonFileWrite,
+  PythonFileWritelines,
+  PythonFillCircle,
+  PythonFillPolygon,
+  PythonFillRect,
+  PythonFloat,
+  PythonFloor,
+  PythonFmod,
+  PythonFrExp,
+  PythonGamma,
+  PythonGetBrightness,
+  PythonGetKeys,
+  PythonGetPalette,
+  PythonGetPixel,
+  PythonGetrandbits,
+  PythonGreaterThan,
+  PythonGrid,
+  PythonHex,
+  PythonHist,
+  PythonImag,
+  PythonImportCmath,
+  PythonImportIon,
+  PythonImportKandinsky,
+  PythonImportMath,
+  PythonImportMatplotlibPyplot,
+  PythonImportNumpy,
+  PythonImportOs,
+  PythonImportRandom,
+  PythonImportScipy,
+  PythonImportSys,
+  PythonImportTime,
+  PythonImportTurtle,
+  PythonImportUtils,
+  PythonIndex,
+  PythonInput,
+  PythonInsert,
+  PythonInt,
+  PythonIonFunction,
+  PythonIsFinite,
+  PythonIsInfinite,
+  PythonIsKeyDown,
+  PythonIsNaN,
+  PythonKandinskyFunction,
+  PythonKeyAlpha,
+  PythonKeyAns,
+  PythonKeyBack,
+  PythonKeyBackspace,
+  PythonKeyComma,
+  PythonKeyCosine,
+  PythonKeyDivision,
+  PythonKeyDot,
+  PythonKeyDown,
+  PythonKeyEe,
+  PythonKeyEight,
+  PythonKeyExe,
+  PythonKeyExp,
+  PythonKeyFive,
+  PythonKeyFour,
+  PythonKeyHome,
+  PythonKeyImaginary,
+  PythonKeyLeft,
+  PythonKeyLeftParenthesis,
+  PythonKeyLn,
+  PythonKeyLog,
+  PythonKeyMinus,
+  PythonKeyMultiplication,
+  PythonKeyNine,
+  PythonKeyOk,
+  PythonKeyOnOff,
+  PythonKeyOne,
+  PythonKeyPi,
+  PythonKeyPlus,
+  PythonKeyPower,
+  PythonKeyRight,
+  PythonKeyRightParenthesis,
+  PythonKeySeven,
+  PythonKeyShift,
+  PythonKeySine,
+  PythonKeySix,
+  PythonKeySqrt,
+  PythonKeySquare,
+  PythonKeyTangent,
+  PythonKeyThree,
+  PythonKeyToolbox,
+  PythonKeyTwo,
+  PythonKeyUp,
+  PythonKeyVar,
+  PythonKeyXnt,
+  PythonKeyZero,
+  PythonLF,
+  PythonLdexp,
+  PythonLength,
+  PythonLessThan,
+  PythonLgamma,
+  PythonLocalTime,
+  PythonLog,
+  PythonLog10,
+  PythonLog2,
+  PythonMathFunction,
+  PythonMatplotlibPyplotFunction,
+  PythonMax,
+  PythonMin,
+  PythonMktime,
+  PythonModf,
+  PythonMonotonic,
+  PythonNumpyFftFunction,
+  PythonNumpyFunction,
+  PythonNumpyLinalgFunction,
+  PythonOct,
+  PythonOsGetlogin,
+  PythonOsListdir,
+  PythonOsRemove,
+  PythonOsRename,
+  PythonOsUname,
+  PythonPercent,
+  PythonPhase,
+  PythonPlot,
+  PythonPolar,
+  PythonPop,
+  PythonPound,
+  PythonPower,
+  PythonPrint,
+  PythonQuestionMark,
+  PythonRTCmode,
+  PythonRadians,
+  PythonRandint,
+  PythonRandom,
+  PythonRandomFunction,
+  PythonRandrange,
+  PythonRangeStartStop,
+  PythonRangeStop,
+  PythonReal,
+  PythonRect,
+  PythonRemove,
+  PythonReverse,
+  PythonRound,
+  PythonScatter,
+  PythonScipyFunction,
+  PythonScipyLinalgFunction,
+  PythonScipyOptimizeFunction,
+  PythonScipySignalFunction,
+  PythonScipySpecialFunction,
+  PythonSeed,
+  PythonSemicon,
+  PythonSetBrightness,
+  PythonSetLocaltime,
+  PythonSetPixel,
+  PythonSetRTCmode,
+  PythonShow,
+  PythonSin,
+  PythonSingleQuote,
+  PythonSinh,
+  PythonSleep,
+  PythonSort,
+  PythonSqrt,
+  PythonSum,
+  PythonSymbolExp,
+  PythonSysByteorder,
+  PythonSysExit,
+  PythonSysImplementation,
+  PythonSysModules,
+  PythonSysPrintexception,
+  PythonSysVersion,
+  PythonSysVersioninfo,
+  PythonTab,
+  PythonTan,
+  PythonTanh,
+  PythonText,
+  PythonTime,
+  PythonTimeFunction,
+  PythonTrunc,
+  PythonTurtleBackward,
+  PythonTurtleCircle,
+  PythonTurtleColor,
+  PythonTurtleColorMode,
+  PythonTurtleForward,
+  PythonTurtleFunction,
+  PythonTurtleGoto,
+  PythonTurtleHeading,
+  PythonTurtleHideturtle,
+  PythonTurtleIsdown,
+  PythonTurtleLeft,
+  PythonTurtlePendown,
+  PythonTurtlePensize,
+  PythonTurtlePenup,
+  PythonTurtlePosition,
+  PythonTurtleReset,
+  PythonTurtleRight,
+  PythonTurtleSetheading,
+  PythonTurtleShowturtle,
+  PythonTurtleSpeed,
+  PythonTurtleWrite,
+  PythonUniform,
+  PythonUtilsFunction,
+  PythonVerticalBar,
+  Quadratic,
+  Quartic,
+  Quotient,
+  RTCWarning1,
+  RTCWarning2,
+  Radian,
+  Radiuses,
+  RandomAndApproximation,
+  RandomFloat,
+  RandomInteger,
+  Range,
+  Real,
+  RealPart,
+  RectangleWidth,
+  ReducedRowEchelonForm,
+  Regression,
+  RegressionApp,
+  RegressionAppCapital,
+  RegressionCurve,
+  RelativeFrequency,
+  Remainder,
+  Rename,
+  RepetitionNumber,
+  RequireEquation,
+  ReservedName,
+  ResistivityConstants,
+  ResolveEquation,
+  ResolveSystem,
+  Rounding,
+  RowEchelonForm,
+  RydbergConstantTag,
+  SampleStandardDeviationS,
+  Sci,
+  Scientific,
+  ScriptInProgress,
+  ScriptOptions,
+  ScriptSize,
+  Sea_water,
+  SearchInterval,
+  SecondRoot,
+  SelectFirstTerm,
+  SelectLastTerm,
+  SelectLowerBound,
+  SelectUpperBound,
+  SequenceApp,
+  SequenceAppCapital,
+  SequenceColor,
+  SequenceOptions,
+  SequenceTab,
+  SequenceType,
+  Sequences,
+  SerialNumber,
+  SettingsApp,
+  SettingsAppCapital,
+  SignificantFigures,
+  Silver,
+  SingleRecurrence,
+  Skip,
+  SmallFont,
+  SoftwareVersion,
+  Solution,
+  SolverApp,
+  SolverAppCapital,
+  Sort,
+  SortSizes,
+  SortValues,
+  Speed,
+  SpeedDimension,
+  SpeedOfLightTag,
+  SpeedOfSound,
+  SpeedOfSound0Tag,
+  SpeedOfSoundGlassTag,
+  SpeedOfSoundSteelTag,
+  SpeedOfSoundWaterTag,
+  SquareSum,
+  StandardDeviation,
+  StandardDeviationSigma,
+  StatTab,
+  StatisticsMode,
+  StatsApp,
+  StatsAppCapital,
+  StefanBoltzmannTag,
+  Step,
+  StorageMemoryFull1,
+  StorageMemoryFull2,
+  StudentDistribution,
+  SuccessProbability,
+  Sum,
+  SumSquareValues,
+  SumValues,
+  SunMassTag,
+  SurfaceDimension,
+  Sym,
+  SymbolArgDefaultFunction,
+  SymbolArgFunction,
+  SymbolDefaultFunction,
+  SymbolFunction,
+  SymbolMultiplication,
+  SymbolMultiplicationAutoSymbol,
+  SymbolMultiplicationCross,
+  SymbolMultiplicationMiddleDot,
+  SymbolMultiplicationStar,
+  SyntaxError,
+  SyntaxHighlighting,
+  TEnd,
+  TStart,
+  Tangent,
+  TauonMassTag,
+  TemperatureDimension,
+  TermSum,
+  Thermodynamics,
+  ThetaEnd,
+  ThetaStart,
+  ThirdQuartile,
+  Time,
+  TimeDimension,
+  Tin,
+  ToDeactivateExamMode1,
+  ToDeactivateExamMode2,
+  ToDeactivateExamMode3,
+  ToZoom,
+  TooManyVariables,
+  Toolbox,
+  TotalFrequency,
+  Trace,
+  Transpose,
+  Trigonometrical,
+  Tungsten,
+  USBConnected,
+  UlabDocumentation,
+  UndefinedEquation,
+  UndefinedValue,
+  UniformDistribution,
+  Uniforme,
+  Unit,
+  UnitAmountMenu,
+  UnitAmountMole,
+  UnitAmountMoleMicro,
+  UnitAmountMoleMilli,
+  UnitCapacitanceFaradMicro,
+  UnitCapacitanceFaradMilli,
+  UnitCapacitanceMenu,
+  UnitConductanceMenu,
+  UnitConductanceSiemensMilli,
+  UnitCurrentAmpere,
+  UnitCurrentAmpereMicro,
+  UnitCurrentAmpereMilli,
+  UnitCurrentMenu,
+  UnitDistanceAstronomicalUnit,
+  UnitDistanceFoot,
+  UnitDistanceInch,
+  UnitDistanceLightYear,
+  UnitDistanceMenu,
+  UnitDistanceMeter,
+  UnitDistanceMeterKilo,
+  UnitDistanceMeterMicro,
+  UnitDistanceMeterMilli,
+  UnitDistanceMeterNano,
+  UnitDistanceMeterPico,
+  UnitDistanceMile,
+  UnitDistanceParsec,
+  UnitDistanceYard,
+  UnitElectricChargeMenu,
+  UnitEnergyElectronVolt,
+  UnitEnergyElectronVoltKilo,
+  UnitEnergyElectronVoltMega,
+  UnitEnergyElectronVoltMenu,
+  UnitEnergyElectronVoltMilli,
+  UnitEnergyJouleMilli,
+  UnitEnergyMenu,
+  UnitForceMenu,
+  UnitForceNewtonMilli,
+  UnitFrequencyHertzMega,
+  UnitFrequencyMenu,
+  UnitIlluminanceLux,
+  UnitIlluminanceMenu,
+  UnitImperialMenu,
+  UnitLuminousFluxLumen,
+  UnitLuminousFluxMenu,
+  UnitLuminousIntensityMenu,
+  UnitMagneticFieldMenu,
+  UnitMassGram,
+  UnitMassGramKilo,
+  UnitMassGramMicro,
+  UnitMassGramMilli,
+  UnitMassLongTon,
+  UnitMassMenu,
+  UnitMassOunce,
+  UnitMassPound,
+  UnitMassShortTon,
+  UnitMassTonne,
+  UnitMetricMenu,
+  UnitPotentialMenu,
+  UnitPotentialVoltMicro,
+  UnitPotentialVoltMilli,
+  UnitPowerMenu,
+  UnitPowerWattMega,
+  UnitPowerWattMicro,
+  UnitPowerWattMilli,
+  UnitPressureAtm,
+  UnitPressureMenu,
+  UnitPressurePascalHecto,
+  UnitResistanceMenu,
+  UnitSolidAngleMenu,
+  UnitSolidAngleSteradian,
+  UnitSurfaceAcre,
+  UnitSurfaceHectar,
+  UnitSurfaceMenu,
+  UnitTemperatureMenu,
+  UnitTimeDay,
+  UnitTimeHour,
+  UnitTimeMenu,
+  UnitTimeMinute,
+  UnitTimeMonth,
+  UnitTimeSecond,
+  UnitTimeSecondMicro,
+  UnitTimeSecondMilli,
+  UnitTimeSecondNano,
+  UnitTimeWeek,
+  UnitTimeYear,
+  UnitVolumeCup,
+  UnitVolumeFluidOunce,
+  UnitVolumeGallon,
+  UnitVolumeLiter,
+  UnitVolumeLiterCenti,
+  UnitVolumeLiterDeci,
+  UnitVolumeLiterMilli,
+  UnitVolumeMenu,
+  UnitVolumePint,
+  UnitVolumeQuart,
+  UnitVolumeTablespoon,
+  UnitVolumeTeaspoon,
+  UnrealEquation,
+  UpdateAvailable,
+  UpdateMessage1,
+  UpdateMessage2,
+  UpdateMessage3,
+  UpdateMessage4,
+  UpdatePopUp,
+  UpsilonVersion,
+  UseEquationModel,
+  Username,
+  VacuumImpedanceTag,
+  Vacuum_permeabilityTag,
+  Vacuum_permittivityTag,
+  ValueNotReachedByRegression,
+  Values1,
+  Values2,
+  Values3,
+  ValuesTab,
+  Variables,
+  Vectors,
+  VolumeDimension,
+  WBosonMassTag,
+  Warning,
+  Water,
+  WaterTriplePointTag,
+  WienTag,
+  Wood,
+  XEnd,
+  XPrediction,
+  XStart,
+  YPrediction,
+  ZBosonMassTag,
+  Zeros,
+  Zinc,
+};
+
+enum class Language : uint8_t {
+  EN,
+  FR,
+  NL,
+  PT,
+  IT,
+  DE,
+  ES,
+  HU,
+};
+
+constexpr const Message LanguageNames[NumberOfLanguages] = {
+  Message::LanguageEN,
+  Message::LanguageFR,
+  Message::LanguageNL,
+  Message::LanguagePT,
+  Message::LanguageIT,
+  Message::LanguageDE,
+  Message::LanguageES,
+  Message::LanguageHU,
+};
+
+enum class Country : uint8_t {
+  WW,
+  CA,
+  DE,
+  ES,
+  FR,
+  GB,
+  IT,
+  NL,
+  PT,
+  US,
+};
+
+constexpr const Message CountryNames[NumberOfCountries] = {
+  Message::CountryWW,
+  Message::CountryCA,
+  Message::CountryDE,
+  Message::CountryES,
+  Message::CountryFR,
+  Message::CountryGB,
+  Message::CountryIT,
+  Message::CountryNL,
+  Message::CountryPT,
+  Message::CountryUS,
+};
+
+constexpr static Country DefaultCountryForLanguage[NumberOfLanguages] = {
+  I18n::Country::US,
+  I18n::Country::FR,
+  I18n::Country::NL,
+  I18n::Country::PT,
+  I18n::Country::IT,
+  I18n::Country::DE,
+  I18n::Country::ES,
+  I18n::Country::WW,
+};
+
+constexpr static CountryPreferences CountryPreferencesArray[] = {
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::CumulatedFrequency, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::CumulatedFrequency, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::All, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Metric, CountryPreferences::HomeAppsLayout::Default),
+  CountryPreferences(CountryPreferences::AvailableExamModes::StandardOnly, CountryPreferences::MethodForQuartiles::MedianOfSublist, Poincare::Preferences::UnitFormat::Imperial, CountryPreferences::HomeAppsLayout::HidePython),
+};
+
+constexpr const char * LanguageISO6391Codes[NumberOfLanguages] = {
+  "en",
+  "fr",
+  "nl",
+  "pt",
+  "it",
+  "de",
+  "es",
+  "hu",
+};
+
+}
+
+#endif
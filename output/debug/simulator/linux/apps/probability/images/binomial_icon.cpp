@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "binomial_icon.h"
+
+// Compressed 665 pixels into 85 bytes (6.39% compression ratio)/
+const uint8_t compressedPixelData[85] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x000e, 0x003f, 0x0019, 0x007d, 0x00ff, 0x0001, 0x0000, 0x002c, 0x0026, 0x0019, 0x007d, 0x0004, 0x0000, 0x000f, 0x0046, 0x0000, 0x0069, 0x002e, 0x0019, 0x007d, 0x0004, 0x0000, 0x000f, 0x0046, 0x0000, 0x00a7, 0x000e, 0x0042, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x0097, 0x000e, 0x0042, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x00dd, 0x002f, 0x0019, 0x007d, 0x0004, 0x0000, 0x0017, 0x000f, 0x0046, 0x0000, 0x008f, 0x002f, 0x0019, 0x007d, 0x0004, 0x0000, 0x001f, 0x000f, 0x0042, 0x0000, 0x002f, 0x000a, 0x004a, 0x0000, 0x002f, 0x0019, 0x007d, 0x0004, 0x0000, 0x002a, 0x0050, 0x00ff, 0x0019, 0x007d, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 85);
+
+const Image * ImageStore::BinomialIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calcul3_icon.h"
+
+// Compressed 897 pixels into 315 bytes (17.56% compression ratio)/
+const uint8_t compressedPixelData[315] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x00aa, 0x00bf, 0x00df, 0x00f7, 0x003c, 0x00b6, 0x003a, 0x0085, 0x003a, 0x0085, 0x003c, 0x00b6, 0x00df, 0x004e, 0x0000, 0x0030, 0x00cf, 0x00bb, 0x009d, 0x009a, 0x0095, 0x001d, 0x00d7, 0x0019, 0x007d, 0x0019, 0x007d, 0x00db, 0x009d, 0x004c, 0x0000, 0x002d, 0x00a0, 0x009c, 0x00c6, 0x009a, 0x0095, 0x00df, 0x00f7, 0x00ff, 0x00ff, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x009d, 0x00c6, 0x00e6, 0x0000, 0x002b, 0x0031, 0x003a, 0x0085, 0x003e, 0x00e1, 0x0000, 0x0002, 0x004e, 0x0000, 0x004f, 0x003a, 0x0085, 0x00df, 0x00f7, 0x004e, 0x0000, 0x0027, 0x0066, 0x00bd, 0x00c6, 0x00fb, 0x00a5, 0x00ff, 0x00ff, 0x004e, 0x0000, 0x003f, 0x0019, 0x007d, 0x00bd, 0x009e, 0x0000, 0x0028, 0x0000, 0x0032, 0x0001, 0x000a, 0x004e, 0x0000, 0x002f, 0x009a, 0x0095, 0x004c, 0x0000, 0x0025, 0x006a, 0x007e, 0x00ef, 0x005a, 0x008d, 0x00ff, 0x00ff, 0x004e, 0x0000, 0x004f, 0x0019, 0x007d, 0x009e, 0x00ef, 0x00e8, 0x0000, 0x0025, 0x002e, 0x001b, 0x00ae, 0x004e, 0x0000, 0x000f, 0x00ec, 0x0000, 0x0025, 0x004e, 0x00db, 0x00a5, 0x00dd, 0x00ce, 0x004e, 0x0000, 0x002f, 0x00fb, 0x00a5, 0x00d0, 0x0001, 0x0022, 0x005e, 0x00ff, 0x003a, 0x0085, 0x00bf, 0x00f7, 0x004e, 0x0000, 0x002f, 0x003a, 0x0085, 0x00c6, 0x0002, 0x0021, 0x0028, 0x001e, 0x00d7, 0x0072, 0x0001, 0x0026, 0x0019, 0x007d, 0x0002, 0x0000, 0x001f, 0x001e, 0x004f, 0x0000, 0x0020, 0x004e, 0x00fb, 0x00a5, 0x009d, 0x00c6, 0x004e, 0x0000, 0x000f, 0x00ec, 0x0000, 0x0023, 0x002a, 0x007e, 0x00e7, 0x00aa, 0x0002, 0x0028, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x007e, 0x00e7, 0x004e, 0x0000, 0x001b, 0x002a, 0x00ba, 0x0095, 0x00bc, 0x0001, 0x000a, 0x004e, 0x0000, 0x001f, 0x00bb, 0x00b2, 0x0003, 0x001a, 0x002c, 0x001b, 0x00a6, 0x00e2, 0x0003, 0x002a, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x001b, 0x00ae, 0x009c, 0x0003, 0x0015, 0x004c, 0x00db, 0x00a5, 0x00db, 0x00a5, 0x0069, 0x0001, 0x000b, 0x004e, 0x0000, 0x0000, 0x0052, 0x0004, 0x001f, 0x00a5, 0x00b4, 0x0003, 0x000f, 0x006e, 0x00dd, 0x00ce, 0x005a, 0x008d, 0x003c, 0x00b6, 0x0018, 0x0000, 0x002e, 0x0019, 0x007d, 0x0002, 0x0000, 0x0026, 0x005a, 0x008d, 0x0090, 0x0002, 0x000c, 0x0092, 0x0000, 0x009e, 0x003e, 0x00df, 0x007c, 0x00be, 0x005a, 0x008d, 0x00bb, 0x009d, 0x005e, 0x0062, 0x0001, 0x000e, 0x004e, 0x0000, 0x0007, 0x0052, 0x0000, 0x004c, 0x007c, 0x00be, 0x003e, 0x00df, 0x00a6, 0x0000, 0x006e, 0x005a, 0x0085, 0x00bb, 0x009d, 0x007c, 0x00be, 0x00ac, 0x0001, 0x000f, 0x004e, 0x0000, 0x000d, 0x0004, 0x0002, 0x0000, 0x000f, 0x003f, 0x0006, 0x008a, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(39, 23, compressedPixelData, 315);
+
+const Image * ImageStore::Calcul3Icon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "fisher_icon.h"
+
+// Compressed 665 pixels into 224 bytes (16.84% compression ratio)/
+const uint8_t compressedPixelData[224] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x00c4, 0x004f, 0x003c, 0x00ae, 0x00db, 0x009d, 0x0044, 0x0000, 0x002d, 0x008f, 0x009e, 0x00ef, 0x0019, 0x007d, 0x0019, 0x007d, 0x003e, 0x00df, 0x0046, 0x0000, 0x002b, 0x0020, 0x005c, 0x00b6, 0x0046, 0x0000, 0x002f, 0x005c, 0x00b6, 0x0046, 0x0000, 0x002b, 0x0020, 0x009a, 0x0095, 0x0046, 0x0000, 0x002f, 0x007a, 0x008d, 0x0044, 0x0000, 0x0029, 0x0020, 0x00bf, 0x00f7, 0x0044, 0x0000, 0x000f, 0x00d4, 0x0000, 0x002d, 0x0024, 0x00fd, 0x00d6, 0x0046, 0x0000, 0x001f, 0x00bb, 0x0062, 0x0001, 0x0028, 0x0044, 0x007c, 0x00be, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x00fd, 0x00ce, 0x0046, 0x0000, 0x0025, 0x0026, 0x00db, 0x009d, 0x0046, 0x0000, 0x004f, 0x003a, 0x0085, 0x005e, 0x00e7, 0x0046, 0x0000, 0x0023, 0x0046, 0x005a, 0x008d, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x005a, 0x008d, 0x0048, 0x0000, 0x0021, 0x0015, 0x00df, 0x005c, 0x0001, 0x0004, 0x0002, 0x0000, 0x004f, 0x0039, 0x0085, 0x00bd, 0x00c6, 0x0046, 0x0000, 0x001d, 0x004e, 0x005e, 0x00e7, 0x0019, 0x007d, 0x0002, 0x0000, 0x004f, 0x00db, 0x00a5, 0x007e, 0x00ef, 0x0046, 0x0000, 0x0019, 0x002e, 0x00dd, 0x00ce, 0x0046, 0x0000, 0x0001, 0x0002, 0x0000, 0x005f, 0x0085, 0x003c, 0x00b6, 0x009f, 0x00ef, 0x00a2, 0x0001, 0x0021, 0x000e, 0x0002, 0x0000, 0x002f, 0x00fb, 0x00a5, 0x0044, 0x0002, 0x0013, 0x002f, 0x00fb, 0x00a5, 0x0046, 0x0000, 0x0009, 0x0002, 0x0070, 0x0001, 0x004f, 0x005c, 0x00b6, 0x005e, 0x00df, 0x00fe, 0x0002, 0x0011, 0x000f, 0x0002, 0x0000, 0x000f, 0x008f, 0x003a, 0x0085, 0x001b, 0x00a6, 0x00dd, 0x00ce, 0x007e, 0x00e7, 0x00e8, 0x0001, 0x0004, 0x001f, 0x0085, 0x0046, 0x0000, 0x0013, 0x0006, 0x004e, 0x0000, 0x00f0, 0x0005, 0x00db, 0x009d, 0x005c, 0x00b6, 0x00bd, 0x00c6, 0x001e, 0x00df, 0x005e, 0x00e7, 0x009f, 0x00ef, 0x00df, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 224);
+
+const Image * ImageStore::FisherIcon = &image;
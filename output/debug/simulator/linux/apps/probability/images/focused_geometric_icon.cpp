@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_geometric_icon.h"
+
+// Compressed 665 pixels into 77 bytes (5.79% compression ratio)/
+const uint8_t compressedPixelData[77] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x0031, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x007b, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x007b, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x007b, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x0035, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x0035, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x0035, 0x0004, 0x0004, 0x0000, 0x002f, 0x001a, 0x00ae, 0x0046, 0x0000, 0x0031, 0x000f, 0x0004, 0x0000, 0x000b, 0x000f, 0x0042, 0x0000, 0x002e, 0x0050, 0x007d, 0x001c, 0x00e7, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 77);
+
+const Image * ImageStore::FocusedGeometricIcon = &image;
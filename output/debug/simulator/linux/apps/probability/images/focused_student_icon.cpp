@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_student_icon.h"
+
+// Compressed 665 pixels into 249 bytes (18.72% compression ratio)/
+const uint8_t compressedPixelData[249] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x000b, 0x008f, 0x005b, 0x00be, 0x0039, 0x0085, 0x005b, 0x00be, 0x001c, 0x00e7, 0x0002, 0x0000, 0x0029, 0x00af, 0x00fb, 0x00de, 0x005a, 0x0085, 0x0019, 0x007d, 0x0039, 0x0085, 0x00fb, 0x00de, 0x0046, 0x0000, 0x0029, 0x0040, 0x003b, 0x00be, 0x0019, 0x007d, 0x0002, 0x0000, 0x001f, 0x003b, 0x008e, 0x0000, 0x002a, 0x0022, 0x009a, 0x009d, 0x0046, 0x0000, 0x002f, 0x00ba, 0x009d, 0x00d0, 0x0000, 0x0029, 0x0022, 0x0039, 0x0085, 0x0046, 0x0000, 0x000f, 0x00d4, 0x0000, 0x0029, 0x0044, 0x007b, 0x00c6, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x007b, 0x00c6, 0x0046, 0x0000, 0x0025, 0x0026, 0x00fa, 0x00ad, 0x0046, 0x0000, 0x002f, 0x00fa, 0x00ad, 0x0046, 0x0000, 0x0025, 0x0026, 0x007a, 0x0095, 0x0046, 0x0000, 0x002f, 0x007a, 0x0095, 0x0016, 0x0001, 0x0025, 0x0026, 0x0019, 0x0085, 0x0046, 0x0000, 0x001f, 0x0019, 0x001a, 0x0001, 0x0024, 0x0008, 0x0016, 0x0001, 0x0000, 0x0002, 0x0000, 0x001f, 0x009b, 0x001a, 0x0001, 0x0022, 0x002a, 0x001a, 0x00ae, 0x0046, 0x0000, 0x002f, 0x001a, 0x00ae, 0x0016, 0x0001, 0x0022, 0x001a, 0x008d, 0x0046, 0x0000, 0x002f, 0x007a, 0x008d, 0x00d0, 0x0000, 0x002f, 0x000f, 0x00ee, 0x0001, 0x0020, 0x0000, 0x0040, 0x0003, 0x001e, 0x008d, 0x0046, 0x0000, 0x004f, 0x005a, 0x008d, 0x00fb, 0x00de, 0x0044, 0x0000, 0x0019, 0x0017, 0x009a, 0x00e4, 0x0001, 0x0008, 0x0002, 0x0000, 0x002f, 0x009a, 0x009d, 0x0048, 0x0000, 0x0015, 0x003e, 0x00bb, 0x00ce, 0x007a, 0x0044, 0x0000, 0x0007, 0x0038, 0x0002, 0x002f, 0x00bb, 0x00ce, 0x0086, 0x0000, 0x000f, 0x0029, 0x001a, 0x00ae, 0x0026, 0x0002, 0x000d, 0x0002, 0x0000, 0x0000, 0x0054, 0x0003, 0x002f, 0x001a, 0x00ae, 0x0092, 0x0000, 0x0006, 0x006f, 0x00df, 0x00bb, 0x00ce, 0x00fa, 0x00ad, 0x0039, 0x0042, 0x0000, 0x000c, 0x0006, 0x004a, 0x0000, 0x0028, 0x00fa, 0x00ad, 0x0094, 0x0000, 0x00af, 0x00db, 0x00de, 0x009b, 0x00ce, 0x003b, 0x00be, 0x00da, 0x00a5, 0x005a, 0x008d, 0x0040, 0x0000, 0x0013, 0x000a, 0x006e, 0x0001, 0x0080, 0x00da, 0x00a5, 0x005b, 0x00be, 0x009b, 0x00ce, 0x00db, 0x00de, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 249);
+
+const Image * ImageStore::FocusedStudentIcon = &image;
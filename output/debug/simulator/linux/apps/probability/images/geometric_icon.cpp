@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "geometric_icon.h"
+
+// Compressed 665 pixels into 76 bytes (5.71% compression ratio)/
+const uint8_t compressedPixelData[76] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x0032, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x00c1, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x007b, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x007b, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x007b, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x0035, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x0035, 0x002f, 0x0019, 0x007d, 0x0046, 0x0000, 0x0035, 0x0004, 0x0004, 0x0000, 0x002f, 0x009c, 0x00be, 0x0046, 0x0000, 0x0031, 0x000f, 0x0004, 0x0000, 0x000b, 0x000f, 0x0042, 0x0000, 0x002e, 0x0050, 0x007d, 0x00ff, 0x00ff, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 76);
+
+const Image * ImageStore::GeometricIcon = &image;
@@ -0,0 +1,36 @@
+.global _ion_simulator_background_start
+.global _ion_simulator_background_end
+_ion_simulator_background_start:
+    .incbin "ion/src/simulator/assets/background.jpg"
+_ion_simulator_background_end:
+
+.global _ion_simulator_horizontal_arrow_start
+.global _ion_simulator_horizontal_arrow_end
+_ion_simulator_horizontal_arrow_start:
+    .incbin "ion/src/simulator/assets/horizontal_arrow.png"
+_ion_simulator_horizontal_arrow_end:
+
+.global _ion_simulator_vertical_arrow_start
+.global _ion_simulator_vertical_arrow_end
+_ion_simulator_vertical_arrow_start:
+    .incbin "ion/src/simulator/assets/vertical_arrow.png"
+_ion_simulator_vertical_arrow_end:
+
+.global _ion_simulator_round_start
+.global _ion_simulator_round_end
+_ion_simulator_round_start:
+    .incbin "ion/src/simulator/assets/round.png"
+_ion_simulator_round_end:
+
+.global _ion_simulator_small_squircle_start
+.global _ion_simulator_small_squircle_end
+_ion_simulator_small_squircle_start:
+    .incbin "ion/src/simulator/assets/small_squircle.png"
+_ion_simulator_small_squircle_end:
+
+.global _ion_simulator_large_squircle_start
+.global _ion_simulator_large_squircle_end
+_ion_simulator_large_squircle_start:
+    .incbin "ion/src/simulator/assets/large_squircle.png"
+_ion_simulator_large_squircle_end:
+
@@ -0,0 +1,1017 @@
+/* This file is auto-generated by the rasterizer */
+
+#include <kandinsky/font.h>
+
+static constexpr KDFont::CodePointIndexPair table[] = {
+  KDFont::CodePointIndexPair(0x20, 0),
+  KDFont::CodePointIndexPair(0xb0, 95),
+  KDFont::CodePointIndexPair(0xb7, 97),
+  KDFont::CodePointIndexPair(0xc6, 98),
+  KDFont::CodePointIndexPair(0xd0, 99),
+  KDFont::CodePointIndexPair(0xd7, 100),
+  KDFont::CodePointIndexPair(0xde, 102),
+  KDFont::CodePointIndexPair(0xe6, 104),
+  KDFont::CodePointIndexPair(0xf0, 105),
+  KDFont::CodePointIndexPair(0xf7, 106),
+  KDFont::CodePointIndexPair(0xfe, 108),
+  KDFont::CodePointIndexPair(0x192, 109),
+  KDFont::CodePointIndexPair(0x300, 110),
+  KDFont::CodePointIndexPair(0x305, 114),
+  KDFont::CodePointIndexPair(0x308, 115),
+  KDFont::CodePointIndexPair(0x30a, 116),
+  KDFont::CodePointIndexPair(0x327, 118),
+  KDFont::CodePointIndexPair(0x391, 119),
+  KDFont::CodePointIndexPair(0x3a3, 136),
+  KDFont::CodePointIndexPair(0x3b1, 143),
+  KDFont::CodePointIndexPair(0x3c3, 160),
+  KDFont::CodePointIndexPair(0x454, 167),
+  KDFont::CodePointIndexPair(0x1d07, 168),
+  KDFont::CodePointIndexPair(0x2026, 169),
+  KDFont::CodePointIndexPair(0x212f, 170),
+  KDFont::CodePointIndexPair(0x2190, 171),
+  KDFont::CodePointIndexPair(0x21d0, 181),
+  KDFont::CodePointIndexPair(0x2200, 185),
+  KDFont::CodePointIndexPair(0x2202, 186),
+  KDFont::CodePointIndexPair(0x2208, 189),
+  KDFont::CodePointIndexPair(0x2211, 191),
+  KDFont::CodePointIndexPair(0x221a, 192),
+  KDFont::CodePointIndexPair(0x221e, 193),
+  KDFont::CodePointIndexPair(0x2229, 194),
+  KDFont::CodePointIndexPair(0x2248, 197),
+  KDFont::CodePointIndexPair(0x2260, 198),
+  KDFont::CodePointIndexPair(0x2264, 200),
+  KDFont::CodePointIndexPair(0x2282, 202),
+  KDFont::CodePointIndexPair(0x2284, 203),
+  KDFont::CodePointIndexPair(0x22c2, 204),
+  KDFont::CodePointIndexPair(0x2505, 206),
+  KDFont::CodePointIndexPair(0x27e6, 207),
+  KDFont::CodePointIndexPair(0xfffd, 209),
+  KDFont::CodePointIndexPair(0x1d422, 210),
+};
+
+static constexpr size_t tableLength = 44;
+
+static constexpr KDCoordinate glyphWidth = 10;
+
+static constexpr KDCoordinate glyphHeight = 18;
+
+static constexpr uint16_t glyphDataOffset[212] = {
+  0x0000, 0x000b, 0x0045, 0x006c, 0x00b1, 0x0100, 0x010b, 0x0151, 0x0176,
+  0x01cd, 0x0222, 0x0256, 0x0289, 0x02ad, 0x02c5, 0x02df, 0x032d, 0x0372,
+  0x039e, 0x03e2, 0x0426, 0x0465, 0x04aa, 0x04ef, 0x0530, 0x0575, 0x05ba,
+  0x05e2, 0x0612, 0x0646, 0x066c, 0x06a1, 0x06e3, 0x0738, 0x077d, 0x07c2,
+  0x0807, 0x084c, 0x0890, 0x08d2, 0x0918, 0x095f, 0x09a0, 0x09e2, 0x0a27,
+  0x0a69, 0x0aaf, 0x0af5, 0x0b3a, 0x0b7c, 0x0bc8, 0x0c0d, 0x0c52, 0x0c94,
+  0x0cd9, 0x0d1e, 0x0d64, 0x0dae, 0x0df1, 0x0e36, 0x0e88, 0x0ec9, 0x0f1e,
+  0x0f45, 0x0f5c, 0x0f7a, 0x0fb1, 0x0ff3, 0x1029, 0x106c, 0x10a2, 0x10f0,
+  0x1137, 0x1179, 0x11b9, 0x1202, 0x1246, 0x1287, 0x12bf, 0x12f6, 0x132c,
+  0x136c, 0x13b0, 0x13e5, 0x141b, 0x1459, 0x1491, 0x14c7, 0x14fe, 0x1536,
+  0x1579, 0x15a6, 0x15f8, 0x1642, 0x1695, 0x16b1, 0x16dc, 0x1710, 0x172b,
+  0x173b, 0x1780, 0x17b2, 0x17bd, 0x17fe, 0x1813, 0x1860, 0x18a4, 0x18d7,
+  0x18e2, 0x1918, 0x1966, 0x1984, 0x19a3, 0x19bd, 0x19d9, 0x1a01, 0x1a18,
+  0x1a39, 0x1a54, 0x1a76, 0x1abb, 0x1b00, 0x1b3f, 0x1b83, 0x1bc7, 0x1c0c,
+  0x1c53, 0x1c97, 0x1cd8, 0x1d1d, 0x1d61, 0x1da7, 0x1ded, 0x1e1d, 0x1e62,
+  0x1ea7, 0x1ee9, 0x1f2d, 0x1f6f, 0x1fb2, 0x1ff7, 0x2041, 0x2082, 0x20c7,
+  0x20fc, 0x2150, 0x2193, 0x21da, 0x220f, 0x2263, 0x22a9, 0x22f3, 0x2323,
+  0x235d, 0x23a6, 0x23e5, 0x241a, 0x246d, 0x24a2, 0x24d8, 0x2518, 0x254d,
+  0x257e, 0x25b4, 0x2603, 0x264a, 0x2699, 0x26cf, 0x26f7, 0x271f, 0x272a,
+  0x275b, 0x2793, 0x27c7, 0x27fe, 0x282d, 0x2838, 0x2876, 0x28ac, 0x28dd,
+  0x2910, 0x2941, 0x297a, 0x29b0, 0x29e8, 0x2a1b, 0x2a43, 0x2a8c, 0x2ab4,
+  0x2adc, 0x2b04, 0x2b2c, 0x2b7b, 0x2bc0, 0x2be9, 0x2c11, 0x2c39, 0x2c8e,
+  0x2cbb, 0x2cf8, 0x2d20, 0x2d5a, 0x2d94, 0x2dbc, 0x2de4, 0x2e0c, 0x2e34,
+  0x2e5c, 0x2e84, 0x2eac, 0x2ed4, 0x2efc
+};
+
+/* Rasterized  = 37980 bytes (211 glyphs x 180 pixels)
+ * Downsampled = 18990 bytes (1/2 of rasterized)
+ * Compressed  = 12028 bytes (31.67% of rasterized) */
+static constexpr uint8_t glyphData[12028] = {
+  0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xf0, 0x06, 0x0e, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00,
+  0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x5f, 0x10, 0x00, 0x00, 0x00, 0x8d, 0x19,
+  0x00, 0x10, 0xaa, 0x05, 0x00, 0x15, 0xd7, 0x28, 0x00, 0x00, 0x18, 0x00, 0x8f,
+  0x0b, 0xf5, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x09, 0x07, 0xf0, 0x0f,
+  0x70, 0x00, 0x0a, 0xd0, 0x2f, 0x40, 0x00, 0x0d, 0xa0, 0x5f, 0x10, 0x00, 0x0f,
+  0x70, 0x8f, 0x00, 0x00, 0x2f, 0x40, 0xbc, 0x00, 0x01, 0x00, 0x1f, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x08, 0xc0, 0x0c,
+  0x80, 0x00, 0x0b, 0x90, 0x0f, 0x50, 0x00, 0x0e, 0x60, 0x2f, 0x20, 0x0c, 0xff,
+  0xff, 0xff, 0xfa, 0x03, 0x7f, 0x44, 0x9d, 0x42, 0x00, 0x6e, 0x00, 0xaa, 0x00,
+  0x00, 0x8b, 0x00, 0xc7, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf0, 0x13, 0xe7, 0x35,
+  0xf4, 0x30, 0x01, 0xf2, 0x05, 0xe0, 0x00, 0x04, 0xf0, 0x08, 0xb0, 0x00, 0x01,
+  0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x36, 0x00, 0x00, 0x02,
+  0x60, 0x00, 0x00, 0x00, 0x06, 0xb0, 0x00, 0x00, 0x08, 0xdf, 0xfc, 0x30, 0x00,
+  0xae, 0x5d, 0x7b, 0xe0, 0x00, 0xf6, 0x0f, 0x22, 0xe3, 0x00, 0xf8, 0x2f, 0x00,
+  0x00, 0x00, 0x7f, 0xdd, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xe5, 0x00, 0x00, 0x00,
+  0xb7, 0x9f, 0x30, 0x27, 0x00, 0xe3, 0x0e, 0x80, 0x4f, 0x30, 0xf0, 0x0e, 0x70,
+  0x0d, 0xd8, 0xe5, 0xbe, 0x10, 0x01, 0xaf, 0xfe, 0xa2, 0x00, 0x00, 0x09, 0x70,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x01,
+  0x04, 0xcf, 0xe7, 0x00, 0x00, 0x2f, 0xa4, 0x9f, 0x20, 0x00, 0x6f, 0x00, 0x06,
+  0x10, 0x00, 0x4f, 0x14, 0x00, 0xfe, 0x15, 0x4f, 0x80, 0x00, 0x00, 0x08, 0xe8,
+  0xf3, 0x04, 0xf2, 0x4f, 0x30, 0x9d, 0x1d, 0x80, 0x8c, 0x00, 0x0d, 0xed, 0x00,
+  0x9d, 0x00, 0x06, 0xf6, 0x00, 0x4f, 0x94, 0x7f, 0xdd, 0x00, 0x06, 0xdf, 0xd6,
+  0x1f, 0x60, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xff, 0x07, 0x0c, 0xb0, 0x00, 0x00, 0x00, 0x0e, 0x80, 0x00,
+  0x00, 0x00, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x4f, 0x30, 0x00, 0x00, 0x00, 0x7f,
+  0x00, 0x01, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x20, 0x00,
+  0x00, 0x00, 0x17, 0x30, 0x00, 0x00, 0x02, 0xdb, 0x00, 0x00, 0x00, 0x0d, 0xb0,
+  0x00, 0x00, 0x00, 0x9e, 0x10, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x00, 0x0a,
+  0xc0, 0x00, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x00, 0x00,
+  0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x05, 0x00, 0x10, 0x7e, 0x05, 0x00,
+  0x10, 0x5f, 0x05, 0x00, 0xc0, 0x2f, 0x40, 0x00, 0x00, 0x00, 0x0c, 0xa0, 0x00,
+  0x00, 0x00, 0x06, 0xf1, 0x10, 0x00, 0x10, 0xda, 0x05, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0x00, 0x74, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x09,
+  0xd0, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x01, 0xf5, 0x1a, 0x00,
+  0x10, 0xf6, 0x05, 0x00, 0x00, 0x0a, 0x00, 0xf0, 0x0a, 0x02, 0xf3, 0x00, 0x00,
+  0x00, 0x05, 0xf0, 0x00, 0x00, 0x00, 0x0a, 0xb0, 0x00, 0x00, 0x00, 0x2f, 0x40,
+  0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x07, 0x2c, 0x00, 0x73, 0x5f, 0x50,
+  0x00, 0x00, 0x05, 0xf5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x01, 0x00, 0xff, 0x16, 0x0f, 0x50, 0x00, 0x00, 0x30, 0x0f, 0x10,
+  0x30, 0x02, 0xf9, 0x2c, 0x3d, 0xd0, 0x00, 0x19, 0xde, 0xc5, 0x00, 0x00, 0x4a,
+  0xee, 0xa2, 0x00, 0x0a, 0xe5, 0xa4, 0x8f, 0x50, 0x03, 0x10, 0xe3, 0x03, 0x00,
+  0x00, 0x02, 0xf2, 0x00, 0x01, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x02, 0xf0, 0x0b, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x2f,
+  0x10, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xb0, 0x01,
+  0x33, 0xc9, 0x33, 0x10, 0x00, 0x00, 0xd5, 0x1e, 0x00, 0x10, 0xf2, 0x05, 0x00,
+  0x2f, 0x20, 0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x1f, 0xf9, 0x06, 0x03, 0x82, 0x00, 0x00, 0x00, 0x0c, 0xe0,
+  0x00, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x02,
+  0xf3, 0x22, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x10, 0x9f, 0x8f, 0xff, 0xfb, 0x00, 0x00, 0x23, 0x33, 0x32, 0x00, 0x01, 0x00,
+  0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x20, 0xbf,
+  0x10, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x21, 0x00,
+  0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x17, 0x00, 0x00, 0x00, 0x04,
+  0x60, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+  0x00, 0xe8, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x00, 0x00, 0x0d, 0x90, 0x00,
+  0x00, 0x00, 0x5f, 0x10, 0x00, 0x00, 0x00, 0xca, 0x26, 0x00, 0xfd, 0x0b, 0xf2,
+  0x00, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27,
+  0x05, 0x88, 0x20, 0x00, 0x00, 0xae, 0x8a, 0xf4, 0x00, 0x04, 0xf1, 0x00, 0x7d,
+  0x00, 0x09, 0xa0, 0x00, 0x0f, 0x30, 0x0c, 0x70, 0x63, 0x0d, 0x60, 0x0d, 0x62,
+  0xfc, 0x0c, 0x70, 0x0c, 0x60, 0x84, 0x0d, 0x60, 0x0a, 0x80, 0x00, 0x0f, 0x40,
+  0x06, 0xd0, 0x00, 0x4f, 0x00, 0x00, 0xd9, 0x13, 0xd7, 0x00, 0x00, 0x2b, 0xfe,
+  0x70, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xb0, 0x35, 0x00, 0x00, 0x00, 0x9e, 0xfd, 0x00, 0x00, 0x00, 0x23,
+  0x9d, 0x0f, 0x00, 0x1f, 0x8d, 0x05, 0x00, 0x08, 0xce, 0x02, 0x44, 0xad, 0x44,
+  0x20, 0x05, 0xdd, 0xdd, 0xdd, 0x60, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xd0, 0x27, 0x97, 0x10, 0x00, 0x06,
+  0xfa, 0x8c, 0xe2, 0x00, 0x05, 0x30, 0x00, 0xba, 0x11, 0x00, 0x10, 0x8c, 0x05,
+  0x00, 0xfe, 0x13, 0xb9, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x2e,
+  0x50, 0x00, 0x00, 0x02, 0xe7, 0x00, 0x00, 0x00, 0x3e, 0x60, 0x00, 0x00, 0x04,
+  0xfa, 0x45, 0x55, 0x10, 0x0a, 0xdd, 0xdd, 0xdd, 0x40, 0x00, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xd0, 0x17, 0x97,
+  0x20, 0x00, 0x05, 0xfa, 0x8b, 0xf5, 0x00, 0x01, 0x30, 0x00, 0x9d, 0x11, 0x00,
+  0xf0, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x16, 0xe4, 0x00, 0x00, 0x0c, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x15, 0xd8, 0x14, 0x00, 0xff, 0x02, 0x2f, 0x20, 0x01, 0x00,
+  0x00, 0x2f, 0x30, 0x0d, 0xa3, 0x24, 0xdd, 0x00, 0x01, 0x9d, 0xfe, 0x91, 0x00,
+  0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xf4, 0x1c, 0x02, 0x60, 0x00, 0x00, 0x00, 0x1e, 0xf2, 0x00, 0x00, 0x00, 0xb9,
+  0xf2, 0x00, 0x00, 0x08, 0xc1, 0xf2, 0x00, 0x00, 0x5e, 0x11, 0xf2, 0x00, 0x02,
+  0xe3, 0x01, 0xf2, 0x00, 0x0d, 0x71, 0x12, 0xf3, 0x00, 0x5f, 0xff, 0xff, 0xff,
+  0xb0, 0x00, 0x00, 0x01, 0xf2, 0x00, 0x05, 0x00, 0x2f, 0xd1, 0x00, 0x01, 0x00,
+  0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x0d,
+  0x66, 0x66, 0x65, 0x00, 0x00, 0xfc, 0xbb, 0xb9, 0x00, 0x01, 0xf2, 0x00, 0x00,
+  0x00, 0x02, 0xf1, 0x00, 0x00, 0x00, 0x03, 0xf6, 0x99, 0x50, 0x00, 0x02, 0xd8,
+  0x68, 0xfa, 0x20, 0x00, 0xff, 0x07, 0x4f, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x50,
+  0x01, 0x00, 0x00, 0x2f, 0x30, 0x0d, 0x93, 0x14, 0xeb, 0x00, 0x01, 0x9d, 0xfe,
+  0x80, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xff, 0x27, 0x01, 0x79, 0x71, 0x00, 0x00, 0x4f, 0xc8, 0xbe, 0x10,
+  0x00, 0xe7, 0x00, 0x01, 0x00, 0x06, 0xe0, 0x00, 0x00, 0x00, 0x0a, 0x90, 0x46,
+  0x30, 0x00, 0x0b, 0xad, 0xa9, 0xeb, 0x00, 0x0b, 0xe2, 0x00, 0x1f, 0x50, 0x0a,
+  0x90, 0x00, 0x0b, 0x80, 0x05, 0xe0, 0x00, 0x0d, 0x60, 0x00, 0xca, 0x21, 0x9e,
+  0x10, 0x00, 0x1a, 0xef, 0xb2, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xf0, 0x0d, 0x05, 0x66, 0x66, 0x66, 0x30,
+  0x0a, 0xbb, 0xbb, 0xcf, 0x60, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x04,
+  0xd0, 0x00, 0x00, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x5e, 0x20, 0x00, 0x10,
+  0xa9, 0x05, 0x00, 0x60, 0xe5, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x1d, 0x00, 0x10,
+  0xf1, 0x05, 0x00, 0x2f, 0xc0, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x05, 0x88, 0x30, 0x00, 0x00,
+  0xad, 0x78, 0xf6, 0x00, 0x02, 0xf1, 0x00, 0x4e, 0x00, 0x02, 0xf0, 0x00, 0x2f,
+  0x00, 0x00, 0xac, 0x30, 0x98, 0x00, 0x00, 0x1e, 0xfe, 0xc0, 0x00, 0x03, 0xd3,
+  0x06, 0xdb, 0x00, 0x0c, 0x60, 0x00, 0x1f, 0x50, 0x0d, 0x50, 0x00, 0x0d, 0x70,
+  0x07, 0xe4, 0x00, 0x7f, 0x20, 0x00, 0x6d, 0xff, 0xb3, 0x00, 0x01, 0x00, 0x01,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x16,
+  0x96, 0x10, 0x00, 0x02, 0xeb, 0x7b, 0xe2, 0x00, 0x0a, 0xa0, 0x00, 0x9c, 0x00,
+  0x0e, 0x50, 0x00, 0x1f, 0x20, 0x0d, 0x70, 0x00, 0x1f, 0x50, 0x07, 0xe5, 0x36,
+  0xcf, 0x50, 0x00, 0x6c, 0xc9, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x2f, 0x20, 0x00,
+  0x00, 0x00, 0x9c, 0x00, 0x05, 0x93, 0x28, 0xf3, 0x00, 0x01, 0xaf, 0xfb, 0x30,
+  0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x02, 0x10, 0x01, 0x05, 0x00, 0x7e, 0x9f, 0x60, 0x00, 0x00, 0x00, 0x8f,
+  0x50, 0x1e, 0x00, 0xbf, 0x10, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0x00, 0x00, 0x00,
+  0x09, 0xf4, 0x3f, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x02, 0x10, 0x01, 0x05, 0x00, 0x7d, 0x9f, 0x60, 0x00, 0x00, 0x00,
+  0x8f, 0x50, 0x1d, 0x00, 0xb0, 0x03, 0x82, 0x00, 0x00, 0x00, 0x0c, 0xe0, 0x00,
+  0x00, 0x00, 0x3f, 0x22, 0x00, 0x69, 0xbc, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x22,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x03, 0xf0,
+  0x0a, 0xae, 0x40, 0x00, 0x00, 0x1d, 0xd2, 0x00, 0x00, 0x03, 0xeb, 0x10, 0x00,
+  0x00, 0x6f, 0x90, 0x00, 0x00, 0x00, 0x9f, 0x30, 0x00, 0x00, 0x00, 0x0b, 0xe2,
+  0x1d, 0x00, 0x8f, 0xcd, 0x10, 0x00, 0x00, 0x00, 0x1d, 0xc0, 0x00, 0x01, 0x00,
+  0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0xa6,
+  0x02, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x44, 0x44, 0x44, 0x40, 0x14, 0x00, 0xaf,
+  0x0d, 0xff, 0xff, 0xff, 0x50, 0x03, 0x33, 0x33, 0x33, 0x00, 0x01, 0x00, 0x0b,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x20, 0x0a,
+  0xf2, 0x06, 0x00, 0xff, 0x11, 0xbe, 0x10, 0x00, 0x00, 0x00, 0x0d, 0xc0, 0x00,
+  0x00, 0x00, 0x01, 0xeb, 0x00, 0x00, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x00, 0x8f,
+  0x60, 0x00, 0x00, 0x1b, 0xe3, 0x00, 0x00, 0x02, 0xdc, 0x10, 0x00, 0x01, 0x00,
+  0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x11,
+  0x07, 0xdf, 0xe7, 0x00, 0x00, 0x9e, 0x74, 0x8f, 0x60, 0x01, 0xe3, 0x00, 0x0a,
+  0xb0, 0x00, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x13, 0x9f, 0x40, 0x00, 0x07,
+  0xff, 0xe6, 0x00, 0x00, 0x09, 0xb2, 0x23, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00,
+  0x01, 0x2d, 0x00, 0x8f, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x5f, 0x80, 0x00, 0x01,
+  0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0,
+  0x40, 0x01, 0x8d, 0xfd, 0x50, 0x00, 0x2e, 0xd6, 0x49, 0xf4, 0x00, 0xcb, 0x00,
+  0x00, 0xa9, 0x05, 0xf1, 0x3c, 0xfa, 0x99, 0x0c, 0x81, 0xea, 0x4b, 0xf6, 0x0f,
+  0x37, 0xd0, 0x02, 0xf4, 0x2f, 0x0a, 0x80, 0x01, 0xf1, 0x3f, 0x0a, 0x80, 0x05,
+  0xf0, 0x3f, 0x07, 0xe2, 0x3e, 0xc0, 0x1f, 0x41, 0xdf, 0xea, 0x90, 0x0b, 0xb0,
+  0x02, 0x01, 0x10, 0x03, 0xfa, 0x20, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xf5, 0x00,
+  0x00, 0x00, 0x23, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xfe, 0x28, 0x0c, 0xf1, 0x00, 0x00, 0x00,
+  0x4f, 0xf3, 0x00, 0x00, 0x00, 0xc8, 0xe6, 0x00, 0x00, 0x04, 0xf1, 0xc8, 0x00,
+  0x00, 0x0c, 0x90, 0xaa, 0x00, 0x00, 0x4f, 0x10, 0x8c, 0x00, 0x00, 0xca, 0x00,
+  0x6e, 0x00, 0x04, 0xff, 0xff, 0xff, 0x10, 0x0c, 0xb2, 0x22, 0x4f, 0x30, 0x4f,
+  0x30, 0x00, 0x0f, 0x50, 0xcc, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0xcf,
+  0xff, 0xea, 0x10, 0x00, 0xe8, 0x44, 0x6f, 0xb0, 0x01, 0xf3, 0x00, 0x08, 0xf0,
+  0x04, 0xf1, 0x00, 0x08, 0xd0, 0x07, 0xe0, 0x01, 0x5f, 0x60, 0x0a, 0xff, 0xff,
+  0xf5, 0x00, 0x0d, 0xa3, 0x34, 0xbe, 0x10, 0x0f, 0x50, 0x00, 0x0f, 0x60, 0x3f,
+  0x20, 0x00, 0x2f, 0x50, 0x5f, 0x44, 0x47, 0xed, 0x00, 0x8f, 0xff, 0xfd, 0x81,
+  0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xf0, 0x0f, 0x03, 0xbe, 0xfc, 0x40, 0x00, 0x6f, 0xa5, 0x5c, 0xf2, 0x03,
+  0xf6, 0x00, 0x01, 0xf7, 0x0b, 0xc0, 0x00, 0x00, 0x42, 0x1f, 0x50, 0x00, 0x00,
+  0x00, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x5f, 0x05, 0x00, 0xff, 0x05, 0x3f, 0x20,
+  0x00, 0x03, 0x30, 0x0f, 0x80, 0x00, 0x3f, 0x60, 0x08, 0xf8, 0x47, 0xeb, 0x00,
+  0x00, 0x8e, 0xfd, 0x70, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0xcf, 0xfe, 0xa2, 0x00, 0x00, 0xe8,
+  0x46, 0xdf, 0x30, 0x01, 0xf3, 0x00, 0x0d, 0xc0, 0x04, 0xf0, 0x00, 0x06, 0xf1,
+  0x07, 0xd0, 0x00, 0x03, 0xf3, 0x0a, 0xb0, 0x00, 0x03, 0xf2, 0x0d, 0x80, 0x00,
+  0x06, 0xf0, 0x0f, 0x50, 0x00, 0x0c, 0xa0, 0x3f, 0x20, 0x00, 0x9f, 0x20, 0x5f,
+  0x45, 0x7d, 0xe4, 0x00, 0x8f, 0xfe, 0xc7, 0x10, 0x00, 0x01, 0x00, 0x01, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xb0, 0x7f, 0xff, 0xff,
+  0xf8, 0x00, 0x9c, 0x44, 0x44, 0x41, 0x00, 0xc8, 0x0f, 0x00, 0xff, 0x18, 0xf6,
+  0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x30,
+  0x08, 0xd3, 0x33, 0x33, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x00,
+  0x00, 0x00, 0x0f, 0x74, 0x44, 0x43, 0x00, 0x3f, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xb0,
+  0x5f, 0xff, 0xff, 0xfa, 0x00, 0x8d, 0x44, 0x44, 0x42, 0x00, 0xba, 0x0f, 0x00,
+  0xff, 0x16, 0xe7, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff,
+  0xff, 0xfe, 0x00, 0x07, 0xe3, 0x33, 0x32, 0x00, 0x09, 0xb0, 0x00, 0x00, 0x00,
+  0x0c, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x2f, 0x20, 0x00,
+  0x01, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0xfe, 0x29, 0x03, 0xbe, 0xfc, 0x30, 0x00, 0x5f, 0xa5, 0x5d, 0xe0, 0x02, 0xf7,
+  0x00, 0x03, 0xf5, 0x09, 0xd0, 0x00, 0x00, 0x20, 0x0f, 0x70, 0x00, 0x00, 0x00,
+  0x2f, 0x40, 0x0c, 0xff, 0xf1, 0x3f, 0x20, 0x03, 0x3a, 0xe0, 0x2f, 0x40, 0x00,
+  0x0d, 0xb0, 0x0f, 0x80, 0x00, 0x7f, 0x90, 0x08, 0xf8, 0x49, 0xdf, 0x60, 0x00,
+  0x9e, 0xfb, 0x2f, 0x30, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x01, 0x00, 0xfe, 0x2a, 0x01, 0xf4, 0x00, 0x00, 0x4f, 0x03,
+  0xf1, 0x00, 0x00, 0x7d, 0x06, 0xf0, 0x00, 0x00, 0xab, 0x09, 0xc0, 0x00, 0x00,
+  0xc8, 0x0c, 0x90, 0x00, 0x00, 0xf5, 0x0f, 0xff, 0xff, 0xff, 0xf2, 0x2f, 0x53,
+  0x33, 0x37, 0xf0, 0x5f, 0x00, 0x00, 0x08, 0xc0, 0x8d, 0x00, 0x00, 0x0b, 0x90,
+  0xaa, 0x00, 0x00, 0x0e, 0x60, 0xd7, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xd0, 0x3f,
+  0xff, 0xff, 0xf3, 0x00, 0x14, 0x4e, 0x94, 0x40, 0x00, 0x00, 0x0f, 0x50, 0x10,
+  0x00, 0x50, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x1a, 0x00, 0x10, 0x9c, 0x05, 0x00,
+  0x10, 0xc9, 0x05, 0x00, 0xf0, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x00,
+  0x00, 0x03, 0x47, 0xf4, 0x42, 0x00, 0x0f, 0xff, 0xff, 0x10, 0x00, 0x0e, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xff, 0x24,
+  0xe6, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00,
+  0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x00, 0x0d, 0x70,
+  0x00, 0x00, 0x00, 0x0f, 0x40, 0x04, 0x50, 0x00, 0x3f, 0x10, 0x09, 0xc0, 0x00,
+  0x9d, 0x00, 0x05, 0xf7, 0x48, 0xf5, 0x00, 0x00, 0x7e, 0xfc, 0x50, 0x00, 0x01,
+  0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff,
+  0x27, 0x8d, 0x00, 0x05, 0xf8, 0x00, 0xaa, 0x00, 0x5f, 0x80, 0x00, 0xd7, 0x05,
+  0xf7, 0x00, 0x00, 0xf5, 0x5f, 0x70, 0x00, 0x03, 0xf7, 0xf6, 0x00, 0x00, 0x06,
+  0xff, 0x80, 0x00, 0x00, 0x09, 0xcc, 0xd0, 0x00, 0x00, 0x0c, 0x92, 0xf9, 0x00,
+  0x00, 0x0f, 0x60, 0x5f, 0x40, 0x00, 0x1f, 0x30, 0x0a, 0xe1, 0x00, 0x4f, 0x00,
+  0x00, 0xdb, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0x10, 0x6e, 0x05, 0x00, 0x10, 0x9b, 0x05, 0x00, 0x10, 0xc9,
+  0x05, 0x00, 0xff, 0x18, 0xf6, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x00,
+  0x05, 0xf0, 0x00, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0x00,
+  0x00, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x73, 0x33, 0x32, 0x00, 0x3f,
+  0xff, 0xff, 0xfc, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xfe, 0x29, 0xf9, 0x00, 0x00, 0xcf, 0x03, 0xfe, 0x00,
+  0x06, 0xfc, 0x06, 0xff, 0x30, 0x2f, 0xfa, 0x08, 0xcc, 0x80, 0xcb, 0xd7, 0x0b,
+  0x97, 0xd6, 0xe2, 0xf4, 0x0e, 0x62, 0xff, 0x53, 0xf1, 0x1f, 0x30, 0xda, 0x06,
+  0xe0, 0x4f, 0x00, 0x00, 0x09, 0xb0, 0x7d, 0x00, 0x00, 0x0c, 0x80, 0xaa, 0x00,
+  0x00, 0x0f, 0x50, 0xd7, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xfe, 0x29, 0xec, 0x00,
+  0x00, 0x6e, 0x01, 0xff, 0x20, 0x00, 0x9b, 0x04, 0xfd, 0x80, 0x00, 0xc8, 0x07,
+  0xe6, 0xe0, 0x00, 0xf5, 0x0a, 0xb0, 0xf5, 0x02, 0xf2, 0x0c, 0x80, 0x9b, 0x05,
+  0xf0, 0x0f, 0x50, 0x3f, 0x28, 0xc0, 0x2f, 0x20, 0x0c, 0x8a, 0xa0, 0x5f, 0x00,
+  0x06, 0xee, 0x70, 0x8c, 0x00, 0x00, 0xff, 0x40, 0xb9, 0x00, 0x00, 0x9f, 0x10,
+  0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xff, 0x27, 0x04, 0xbf, 0xfa, 0x10, 0x00, 0x7f, 0x95, 0x6e, 0xd0, 0x04,
+  0xf5, 0x00, 0x03, 0xf4, 0x0c, 0xb0, 0x00, 0x00, 0xe7, 0x2f, 0x40, 0x00, 0x00,
+  0xd9, 0x5f, 0x00, 0x00, 0x00, 0xe7, 0x6f, 0x00, 0x00, 0x02, 0xf4, 0x5f, 0x10,
+  0x00, 0x08, 0xe0, 0x2f, 0x60, 0x00, 0x3f, 0x60, 0x0a, 0xf7, 0x48, 0xfa, 0x00,
+  0x00, 0x9e, 0xfc, 0x60, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x24, 0xaf, 0xff, 0xfc, 0x30, 0x00, 0xca,
+  0x44, 0x5c, 0xf1, 0x00, 0xf5, 0x00, 0x02, 0xf4, 0x02, 0xf1, 0x00, 0x03, 0xf3,
+  0x05, 0xe0, 0x01, 0x4d, 0xd0, 0x08, 0xff, 0xff, 0xfa, 0x10, 0x0b, 0xa3, 0x32,
+  0x00, 0x00, 0x0e, 0x60, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x3f,
+  0x10, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x2b, 0x04, 0xbf, 0xfa, 0x10, 0x00,
+  0x7f, 0x95, 0x6e, 0xd0, 0x04, 0xf5, 0x00, 0x03, 0xf4, 0x0c, 0xb0, 0x00, 0x00,
+  0xe7, 0x2f, 0x40, 0x00, 0x00, 0xd9, 0x5f, 0x00, 0x00, 0x00, 0xe7, 0x6f, 0x00,
+  0x00, 0x02, 0xf4, 0x5f, 0x10, 0x00, 0x08, 0xe0, 0x2f, 0x60, 0x00, 0x3f, 0x70,
+  0x0a, 0xf7, 0x48, 0xfa, 0x00, 0x00, 0x9e, 0xff, 0x80, 0x00, 0x00, 0x00, 0x0b,
+  0xd1, 0x3e, 0x00, 0x17, 0xcc, 0x4a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x8f, 0xff, 0xeb, 0x30, 0x00, 0xab, 0x44,
+  0x5c, 0xe0, 0x00, 0xd7, 0x00, 0x02, 0xf4, 0x00, 0xf4, 0x00, 0x03, 0xf3, 0x03,
+  0xf1, 0x01, 0x5d, 0xc0, 0x06, 0xff, 0xff, 0xf9, 0x10, 0x09, 0xc3, 0x3e, 0x70,
+  0x00, 0x0c, 0x80, 0x09, 0xd0, 0x00, 0x0f, 0x60, 0x04, 0xf2, 0x00, 0x1f, 0x30,
+  0x00, 0xf7, 0x00, 0x4f, 0x00, 0x00, 0xad, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x01, 0x06, 0xdf, 0xea,
+  0x10, 0x00, 0x9f, 0x84, 0x6e, 0xc0, 0x00, 0xe8, 0x00, 0x06, 0xf0, 0x00, 0xda,
+  0x14, 0x00, 0xff, 0x13, 0x5f, 0xa2, 0x00, 0x00, 0x00, 0x03, 0xaf, 0xc2, 0x00,
+  0x00, 0x00, 0x01, 0xbf, 0x10, 0x07, 0x20, 0x00, 0x1f, 0x60, 0x0f, 0x70, 0x00,
+  0x3f, 0x50, 0x0a, 0xf7, 0x47, 0xed, 0x00, 0x00, 0x9e, 0xfe, 0x91, 0x00, 0x01,
+  0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0,
+  0x07, 0xbf, 0xff, 0xff, 0xfa, 0x00, 0x34, 0x4e, 0x94, 0x42, 0x00, 0x00, 0x0f,
+  0x50, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x1a, 0x00, 0x10,
+  0x9c, 0x05, 0x00, 0x10, 0xc9, 0x05, 0x00, 0xff, 0x02, 0xe6, 0x00, 0x00, 0x00,
+  0x01, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00,
+  0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0xff, 0x27, 0xe7, 0x00, 0x00, 0x7e, 0x01, 0xf4, 0x00, 0x00, 0xab, 0x04, 0xf1,
+  0x00, 0x00, 0xd8, 0x07, 0xe0, 0x00, 0x00, 0xf5, 0x0a, 0xb0, 0x00, 0x03, 0xf2,
+  0x0d, 0x80, 0x00, 0x06, 0xf0, 0x0f, 0x50, 0x00, 0x09, 0xc0, 0x1f, 0x30, 0x00,
+  0x0d, 0x80, 0x1f, 0x50, 0x00, 0x4f, 0x30, 0x0a, 0xe5, 0x37, 0xf9, 0x00, 0x00,
+  0x9e, 0xfc, 0x60, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0xff, 0x27, 0x03, 0xf3, 0x00, 0x00, 0x5f, 0x01, 0xf5,
+  0x00, 0x00, 0xdb, 0x00, 0xe7, 0x00, 0x05, 0xf3, 0x00, 0xc9, 0x00, 0x0c, 0xb0,
+  0x00, 0xab, 0x00, 0x4f, 0x30, 0x00, 0x7d, 0x00, 0xca, 0x00, 0x00, 0x5f, 0x04,
+  0xf2, 0x00, 0x00, 0x3f, 0x1c, 0xa0, 0x00, 0x00, 0x1f, 0x7f, 0x20, 0x00, 0x00,
+  0x0e, 0xfa, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xff, 0x28, 0x0b, 0x90, 0x0d,
+  0xb0, 0x0a, 0x0b, 0x90, 0x3f, 0xb0, 0x0f, 0x0c, 0x80, 0x9f, 0xb0, 0x4f, 0x0c,
+  0x70, 0xea, 0xc0, 0x9a, 0x0c, 0x74, 0xe6, 0xc0, 0xe5, 0x0d, 0x6a, 0x95, 0xc3,
+  0xf0, 0x0d, 0x6f, 0x36, 0xc8, 0xb0, 0x0d, 0xbd, 0x06, 0xcd, 0x50, 0x0e, 0xf7,
+  0x06, 0xff, 0x00, 0x0e, 0xf2, 0x06, 0xfb, 0x00, 0x0f, 0xc0, 0x06, 0xf5, 0x00,
+  0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00,
+  0x10, 0x31, 0x03, 0x00, 0xfe, 0x29, 0xcb, 0x00, 0x06, 0xf2, 0x00, 0x5f, 0x20,
+  0x1f, 0x70, 0x00, 0x0e, 0x90, 0xac, 0x00, 0x00, 0x07, 0xf5, 0xf2, 0x00, 0x00,
+  0x01, 0xff, 0x70, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x08, 0xef, 0x40,
+  0x00, 0x00, 0x4f, 0x4c, 0xb0, 0x00, 0x01, 0xe9, 0x05, 0xf2, 0x00, 0x0a, 0xe0,
+  0x00, 0xd9, 0x00, 0x5f, 0x40, 0x00, 0x7f, 0x10, 0x00, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xf0, 0x12, 0x01, 0xf6,
+  0x00, 0x00, 0x9e, 0x00, 0xab, 0x00, 0x04, 0xf4, 0x00, 0x5f, 0x10, 0x1e, 0x90,
+  0x00, 0x0e, 0x70, 0xad, 0x00, 0x00, 0x09, 0xc5, 0xf2, 0x00, 0x00, 0x03, 0xff,
+  0x60, 0x00, 0x00, 0x00, 0xeb, 0x25, 0x00, 0x10, 0xf6, 0x29, 0x00, 0xcf, 0xf3,
+  0x00, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x01, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27,
+  0xaf, 0xff, 0xff, 0xfa, 0x00, 0x34, 0x44, 0x49, 0xf3, 0x00, 0x00, 0x00, 0x3f,
+  0x50, 0x00, 0x00, 0x01, 0xe7, 0x00, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00,
+  0xac, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x00, 0x00, 0x00, 0x5f, 0x20, 0x00, 0x00,
+  0x03, 0xf4, 0x00, 0x00, 0x00, 0x1e, 0xa4, 0x44, 0x44, 0x00, 0x8f, 0xff, 0xff,
+  0xfe, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf0, 0x19, 0x7f, 0xff, 0x40, 0x00, 0x00, 0xf7, 0x33, 0x00, 0x00,
+  0x02, 0xf2, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x00,
+  0x00, 0x00, 0x0b, 0x90, 0x00, 0x00, 0x00, 0x0e, 0x60, 0x00, 0x00, 0x00, 0x1f,
+  0x30, 0x00, 0x00, 0x00, 0x4f, 0x2c, 0x00, 0x10, 0x7d, 0x05, 0x00, 0x10, 0xaa,
+  0x05, 0x00, 0x10, 0xd7, 0x05, 0x00, 0x23, 0xf4, 0x00, 0x36, 0x00, 0xf0, 0x00,
+  0x02, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x13, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x10,
+  0x7d, 0x05, 0x00, 0xc0, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00,
+  0x00, 0x05, 0xf1, 0x10, 0x00, 0x10, 0xe6, 0x05, 0x00, 0x10, 0x8d, 0x05, 0x00,
+  0x20, 0x2f, 0x30, 0x1a, 0x00, 0x10, 0x90, 0x1a, 0x00, 0x15, 0xf0, 0x1a, 0x00,
+  0x11, 0x9c, 0x1a, 0x00, 0x2a, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xc0, 0xbf, 0xfd, 0x00, 0x00, 0x00, 0x23,
+  0x5f, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x10, 0x00, 0x10, 0x7d, 0x05, 0x00, 0x10,
+  0xaa, 0x05, 0x00, 0x10, 0xd7, 0x05, 0x00, 0xf0, 0x0f, 0xf4, 0x00, 0x00, 0x00,
+  0x03, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xe0, 0x00, 0x00, 0x00, 0x09, 0xb0, 0x00,
+  0x00, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x2f,
+  0x36, 0x00, 0xf0, 0x03, 0x6f, 0x00, 0x00, 0x04, 0xff, 0xf9, 0x00, 0x00, 0x01,
+  0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xff, 0x09, 0x1e, 0xe0, 0x00, 0x00, 0x00, 0xca, 0xe6, 0x00, 0x00, 0x0a, 0xc0,
+  0x7d, 0x00, 0x00, 0x8e, 0x10, 0x0e, 0x50, 0x05, 0xf2, 0x00, 0x07, 0xd0, 0x00,
+  0x01, 0x00, 0x1e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x2d, 0x97, 0x9f, 0xff, 0xff, 0xf9, 0x00, 0x23, 0x33, 0x33, 0x31, 0x14, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10, 0x41, 0x05,
+  0x00, 0x70, 0xae, 0x50, 0x00, 0x00, 0x00, 0x06, 0xe6, 0x0b, 0x00, 0x2f, 0x01,
+  0x00, 0x01, 0x00, 0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x06, 0xff, 0x18, 0x4c, 0xfe, 0x7a, 0xa0, 0x05, 0xfb, 0x57, 0xef, 0x70,
+  0x0e, 0x90, 0x00, 0x6f, 0x50, 0x3f, 0x20, 0x00, 0x3f, 0x20, 0x5f, 0x10, 0x00,
+  0x5f, 0x00, 0x3f, 0x40, 0x00, 0xcc, 0x00, 0x0d, 0xe6, 0x6c, 0xec, 0x30, 0x02,
+  0xcf, 0xe6, 0x7f, 0xa0, 0x3b, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0x10, 0x7d, 0x05, 0x00, 0x10, 0xaa, 0x05, 0x00, 0x10,
+  0xd7, 0x05, 0x00, 0xff, 0x18, 0xf7, 0xcf, 0xd5, 0x00, 0x03, 0xfe, 0x64, 0xaf,
+  0x30, 0x06, 0xf2, 0x00, 0x0e, 0x80, 0x09, 0xa0, 0x00, 0x0b, 0xa0, 0x0c, 0x80,
+  0x00, 0x0d, 0x80, 0x0f, 0xb0, 0x00, 0x4f, 0x30, 0x2f, 0xd8, 0x47, 0xf9, 0x00,
+  0x5c, 0x3d, 0xfd, 0x70, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x17, 0x08, 0xdf, 0xd6, 0x00, 0x00,
+  0xce, 0x74, 0x9f, 0x40, 0x07, 0xf2, 0x00, 0x07, 0x50, 0x0c, 0xa0, 0x00, 0x00,
+  0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x49, 0x00, 0x05, 0xf9,
+  0x47, 0xf8, 0x00, 0x00, 0x6d, 0xfd, 0x70, 0x3b, 0x00, 0x02, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xfe, 0x26, 0xf4, 0x00, 0x00, 0x00,
+  0x03, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xe0, 0x00, 0x4c, 0xfe, 0x79, 0xb0, 0x05,
+  0xfb, 0x57, 0xef, 0x80, 0x0e, 0x90, 0x00, 0x6f, 0x50, 0x3f, 0x20, 0x00, 0x3f,
+  0x20, 0x5f, 0x10, 0x00, 0x5f, 0x00, 0x3f, 0x40, 0x00, 0xcc, 0x00, 0x0d, 0xe6,
+  0x6c, 0xec, 0x30, 0x02, 0xcf, 0xe6, 0x7f, 0xa0, 0x00, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x17, 0x18,
+  0xef, 0xd6, 0x00, 0x01, 0xdc, 0x64, 0x8f, 0x40, 0x09, 0xc0, 0x00, 0x0b, 0xa0,
+  0x0e, 0xff, 0xff, 0xff, 0x90, 0x0f, 0x73, 0x33, 0x33, 0x10, 0x0e, 0x90, 0x00,
+  0x48, 0x00, 0x07, 0xf8, 0x47, 0xf6, 0x00, 0x00, 0x7e, 0xfd, 0x60, 0x3b, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf0, 0x2d,
+  0x09, 0xef, 0xf1, 0x00, 0x00, 0x5f, 0x64, 0x40, 0x00, 0x00, 0xab, 0x00, 0x00,
+  0x00, 0xcf, 0xff, 0xff, 0x70, 0x00, 0x34, 0xf8, 0x44, 0x10, 0x00, 0x02, 0xf2,
+  0x00, 0x00, 0x00, 0x05, 0xf0, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x00,
+  0x0b, 0x90, 0x00, 0x00, 0x00, 0x0e, 0x60, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x00,
+  0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x24, 0xcc, 0x31, 0x00, 0x14, 0xc2, 0x49,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xf0,
+  0x31, 0x07, 0xdf, 0xff, 0xfc, 0x00, 0x8e, 0x74, 0x9f, 0x62, 0x00, 0xe6, 0x00,
+  0x0f, 0x40, 0x00, 0xca, 0x12, 0x9f, 0x10, 0x00, 0xcf, 0xff, 0xd4, 0x00, 0x09,
+  0xc0, 0x22, 0x00, 0x00, 0x0e, 0x94, 0x43, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf4,
+  0x00, 0x6e, 0x10, 0x01, 0xcb, 0x00, 0x8f, 0x74, 0x48, 0xf6, 0x00, 0x09, 0xef,
+  0xfc, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0x10, 0x5f, 0x05, 0x00, 0x10, 0x8d, 0x05, 0x00, 0x10,
+  0xba, 0x05, 0x00, 0xff, 0x18, 0xd8, 0x9f, 0xe8, 0x00, 0x00, 0xfe, 0x84, 0x8f,
+  0x50, 0x03, 0xf6, 0x00, 0x0d, 0x90, 0x06, 0xe0, 0x00, 0x0c, 0x80, 0x09, 0xb0,
+  0x00, 0x0f, 0x60, 0x0c, 0x80, 0x00, 0x2f, 0x30, 0x0f, 0x50, 0x00, 0x4f, 0x00,
+  0x2f, 0x30, 0x00, 0x7d, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xf0, 0x06, 0x1e, 0xb0, 0x00, 0x00, 0x00, 0x1f,
+  0xd0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0xfb, 0x00, 0x00, 0x00,
+  0x34, 0x9e, 0x19, 0x00, 0x10, 0x8c, 0x05, 0x00, 0x10, 0xb9, 0x05, 0x00, 0x10,
+  0xe6, 0x1d, 0x00, 0xb0, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf5, 0x43, 0x00, 0x00,
+  0x01, 0xef, 0x24, 0x00, 0x0e, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x01, 0x00, 0x10, 0xcd, 0x05, 0x00, 0x13, 0xee, 0x0d, 0x00, 0xf0,
+  0x03, 0x0c, 0xff, 0xd0, 0x00, 0x00, 0x03, 0x47, 0xf0, 0x00, 0x00, 0x00, 0x06,
+  0xe0, 0x00, 0x00, 0x00, 0x09, 0xb0, 0x15, 0x00, 0xf0, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x29,
+  0x00, 0xb3, 0x9c, 0x00, 0x00, 0x34, 0x44, 0xd9, 0x00, 0x00, 0xef, 0xff, 0xe3,
+  0x3b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xb0,
+  0x0f, 0x40, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x00, 0x00, 0x00, 0x6e, 0x0f, 0x00,
+  0xff, 0x18, 0x9b, 0x00, 0x9e, 0x30, 0x00, 0xc8, 0x0a, 0xe2, 0x00, 0x00, 0xf6,
+  0xcc, 0x10, 0x00, 0x02, 0xfe, 0xc0, 0x00, 0x00, 0x05, 0xf7, 0xf2, 0x00, 0x00,
+  0x08, 0xc0, 0xad, 0x00, 0x00, 0x0b, 0xa0, 0x0d, 0xa0, 0x00, 0x0e, 0x70, 0x03,
+  0xf6, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xd0, 0x1f, 0xff, 0x60, 0x00, 0x00, 0x04, 0x4d, 0x80, 0x00, 0x00,
+  0x00, 0x0e, 0x60, 0x10, 0x00, 0x50, 0x30, 0x00, 0x00, 0x00, 0x4f, 0x1a, 0x00,
+  0x10, 0x8c, 0x05, 0x00, 0x10, 0xb9, 0x05, 0x00, 0xff, 0x03, 0xe6, 0x00, 0x00,
+  0x00, 0x01, 0xf3, 0x00, 0x00, 0x00, 0x03, 0xf5, 0x43, 0x00, 0x00, 0x02, 0xef,
+  0xfb, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x05, 0xff, 0x19, 0x2f, 0x8a, 0xfb, 0x7f, 0xd2, 0x1c, 0xf6, 0x9f,
+  0xb5, 0xf8, 0x0c, 0x90, 0x4f, 0x10, 0xd7, 0x0f, 0x60, 0x7d, 0x00, 0xf5, 0x2f,
+  0x30, 0xaa, 0x02, 0xf2, 0x4f, 0x00, 0xd7, 0x05, 0xf0, 0x7d, 0x00, 0xf4, 0x08,
+  0xc0, 0xaa, 0x02, 0xf1, 0x0b, 0x90, 0x3c, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0xff, 0x18, 0x0f, 0xf4, 0x9e, 0xfa,
+  0x00, 0x04, 0xff, 0x95, 0x8f, 0x80, 0x01, 0xf9, 0x00, 0x0c, 0xa0, 0x04, 0xf2,
+  0x00, 0x0b, 0x90, 0x07, 0xe0, 0x00, 0x0e, 0x60, 0x09, 0xb0, 0x00, 0x1f, 0x40,
+  0x0c, 0x80, 0x00, 0x4f, 0x10, 0x0f, 0x50, 0x00, 0x7e, 0x3c, 0x00, 0x02, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x17, 0x19,
+  0xef, 0xc4, 0x00, 0x01, 0xec, 0x55, 0xbf, 0x20, 0x0a, 0xc0, 0x00, 0x0e, 0x90,
+  0x0f, 0x50, 0x00, 0x0b, 0xb0, 0x1f, 0x40, 0x00, 0x0c, 0x90, 0x0f, 0x70, 0x00,
+  0x3f, 0x40, 0x08, 0xf7, 0x47, 0xf9, 0x00, 0x00, 0x8e, 0xfd, 0x60, 0x3b, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0xf0,
+  0x1a, 0x4f, 0xd3, 0xcf, 0xd5, 0x00, 0x18, 0xfd, 0x65, 0xaf, 0x30, 0x06, 0xf2,
+  0x00, 0x0d, 0x90, 0x09, 0xb0, 0x00, 0x0b, 0xb0, 0x0c, 0x90, 0x00, 0x0d, 0x90,
+  0x0f, 0xc0, 0x00, 0x3f, 0x40, 0x2f, 0xfa, 0x47, 0xfb, 0x00, 0x5f, 0x3c, 0xfe,
+  0x80, 0x00, 0x8d, 0x2d, 0x00, 0x10, 0xba, 0x05, 0x00, 0x15, 0xe7, 0x3c, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xf0, 0x17,
+  0x1a, 0xef, 0x93, 0xf0, 0x01, 0xec, 0x55, 0xcd, 0xc0, 0x0a, 0xd0, 0x00, 0x1f,
+  0x90, 0x0f, 0x70, 0x00, 0x0e, 0x60, 0x1f, 0x50, 0x00, 0x1f, 0x30, 0x0f, 0x80,
+  0x00, 0x8f, 0x00, 0x09, 0xf7, 0x49, 0xfd, 0x00, 0x00, 0xaf, 0xe9, 0xba, 0x2a,
+  0x00, 0x10, 0xd7, 0x05, 0x00, 0x10, 0xf7, 0x05, 0x00, 0xc0, 0xdf, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x06, 0xff, 0x16, 0xff, 0xe4, 0xcf, 0xf0, 0x00, 0x47, 0xfc, 0x54, 0x30, 0x00,
+  0x05, 0xf1, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x00, 0x0b, 0x90, 0x00,
+  0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x4f,
+  0x10, 0x3b, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x06, 0xff, 0x17, 0x2a, 0xef, 0xc3, 0x00, 0x00, 0xdc, 0x55, 0xce, 0x00,
+  0x00, 0xf6, 0x00, 0x16, 0x00, 0x00, 0x7f, 0xb7, 0x30, 0x00, 0x00, 0x01, 0x48,
+  0xf7, 0x00, 0x08, 0x50, 0x00, 0xab, 0x00, 0x09, 0xf6, 0x47, 0xf7, 0x00, 0x00,
+  0x9e, 0xfd, 0x70, 0x3b, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x01, 0x00, 0xf0, 0x15, 0x79, 0x00, 0x00, 0x00, 0x01, 0xe6, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x60, 0x00, 0x47, 0xf5, 0x44, 0x10, 0x00, 0x06, 0xe0,
+  0x00, 0x00, 0x00, 0x09, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x00,
+  0x0f, 0x60, 0x05, 0x00, 0x8f, 0xb4, 0x41, 0x00, 0x00, 0x06, 0xef, 0xf3, 0x00,
+  0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x05, 0xff, 0x19, 0x06, 0xe0, 0x00, 0x0e, 0x60, 0x09, 0xb0, 0x00, 0x1f, 0x30,
+  0x0c, 0x80, 0x00, 0x4f, 0x10, 0x0f, 0x60, 0x00, 0x7e, 0x00, 0x2f, 0x30, 0x00,
+  0xbb, 0x00, 0x3f, 0x30, 0x02, 0xf8, 0x00, 0x1f, 0xb4, 0x6d, 0xf9, 0x10, 0x05,
+  0xdf, 0xc3, 0xbf, 0x60, 0x3c, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x05, 0xff, 0x17, 0x0a, 0xd0, 0x00, 0x09, 0xc0, 0x06,
+  0xf1, 0x00, 0x0c, 0x90, 0x01, 0xf4, 0x00, 0x4f, 0x30, 0x00, 0xd8, 0x00, 0xda,
+  0x00, 0x00, 0x9c, 0x07, 0xf1, 0x00, 0x00, 0x5f, 0x2f, 0x60, 0x00, 0x00, 0x1f,
+  0xec, 0x00, 0x00, 0x00, 0x0d, 0xf3, 0x3c, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0xff, 0x18, 0x0f, 0x30, 0x7f, 0x30,
+  0x8a, 0x0f, 0x30, 0xef, 0x40, 0xc7, 0x0f, 0x44, 0xed, 0x51, 0xf3, 0x0e, 0x4b,
+  0x8b, 0x67, 0xc0, 0x0e, 0x6f, 0x1a, 0x7d, 0x60, 0x0d, 0xdb, 0x09, 0xce, 0x00,
+  0x0c, 0xf4, 0x08, 0xf8, 0x00, 0x0b, 0xe0, 0x07, 0xf2, 0x3c, 0x00, 0x02, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0xff, 0x19, 0x0c,
+  0xf6, 0x00, 0x0c, 0xc0, 0x02, 0x7f, 0x10, 0xbd, 0x10, 0x00, 0x0d, 0x89, 0xe2,
+  0x00, 0x00, 0x05, 0xff, 0x30, 0x00, 0x00, 0x08, 0xfe, 0x00, 0x00, 0x00, 0x6f,
+  0x4f, 0x60, 0x00, 0x04, 0xf5, 0x07, 0xe2, 0x10, 0x2f, 0x70, 0x00, 0xcf, 0x70,
+  0x3c, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x05, 0xf4, 0x25, 0x09, 0xc0, 0x00, 0x06, 0xf0, 0x04, 0xf1, 0x00, 0x0a, 0xb0,
+  0x00, 0xf6, 0x00, 0x2f, 0x50, 0x00, 0xaa, 0x00, 0xcc, 0x00, 0x00, 0x5f, 0x07,
+  0xf1, 0x00, 0x00, 0x1f, 0x7f, 0x50, 0x00, 0x00, 0x0b, 0xfa, 0x00, 0x00, 0x00,
+  0x08, 0xe1, 0x00, 0x00, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00,
+  0x00, 0x0a, 0xd0, 0x3c, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x06, 0xf8, 0x02, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x34, 0x44, 0xce,
+  0x20, 0x00, 0x00, 0x09, 0xe2, 0x00, 0x00, 0x00, 0x9e, 0x09, 0x00, 0x9f, 0x08,
+  0xf7, 0x44, 0x41, 0x00, 0x0f, 0xff, 0xff, 0xf5, 0x3b, 0x00, 0x02, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x02, 0x03, 0xcf, 0xf5,
+  0x00, 0x00, 0x0e, 0xb4, 0x30, 0x00, 0x00, 0x2f, 0x30, 0x00, 0x00, 0x00, 0x2f,
+  0x10, 0x05, 0x00, 0xf0, 0x05, 0x4f, 0x10, 0x00, 0x00, 0x02, 0xcc, 0x00, 0x00,
+  0x00, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x37, 0xf2, 0x00, 0x00, 0x00, 0x01, 0x05,
+  0x00, 0xc0, 0x05, 0xe0, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x0f,
+  0x50, 0x05, 0x00, 0x00, 0x0a, 0x00, 0xe0, 0x09, 0xff, 0xb0, 0x00, 0x00, 0x00,
+  0x23, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf0,
+  0x06, 0x0a, 0xb0, 0x00, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x0f, 0x50,
+  0x00, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x00, 0x5f, 0x19, 0x00, 0x10, 0x8c,
+  0x05, 0x00, 0x10, 0xba, 0x05, 0x00, 0xf0, 0x05, 0xe7, 0x00, 0x00, 0x00, 0x01,
+  0xf4, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xe0, 0x00, 0x00,
+  0x00, 0x09, 0x36, 0x00, 0x16, 0x0c, 0x36, 0x00, 0x80, 0x30, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xc0, 0x0b, 0xff, 0x60, 0x00,
+  0x00, 0x02, 0x3a, 0xf0, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0xc0, 0x08, 0xb0,
+  0x00, 0x00, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x2f, 0x10, 0x05, 0x00, 0xf4,
+  0x05, 0x40, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xbd, 0x53, 0x00,
+  0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x05, 0x00, 0x10, 0x03, 0x05,
+  0x00, 0xf0, 0x04, 0x19, 0xf0, 0x00, 0x00, 0x5f, 0xfe, 0x50, 0x00, 0x00, 0x13,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x10, 0xdf, 0xbf, 0xd6, 0x1b, 0x80, 0x07, 0xd4, 0x8f, 0xfd, 0x10, 0x02, 0x10,
+  0x00, 0x20, 0x31, 0x00, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xff, 0x0d, 0xaf, 0xd2, 0x00, 0x00, 0x06, 0xd4, 0x9c, 0x00, 0x00,
+  0x0a, 0x60, 0x0f, 0x00, 0x00, 0x08, 0xb1, 0x6e, 0x00, 0x00, 0x01, 0xdf, 0xf5,
+  0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x01, 0x00, 0x1f, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x06, 0x2f, 0x10, 0x00, 0x00,
+  0x00, 0x5e, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xb0, 0x02, 0x33, 0xc9, 0x33,
+  0x20, 0x00, 0x00, 0xe5, 0x19, 0x00, 0xcf, 0x30, 0x00, 0x00, 0x14, 0x44, 0x44,
+  0x43, 0x00, 0x6f, 0xff, 0xff, 0xfc, 0x3a, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0c, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x02,
+  0xfe, 0x00, 0x00, 0x00, 0x01, 0xec, 0x00, 0x01, 0x00, 0x16, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x2c, 0x1f, 0x06, 0x15, 0x00, 0x01,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x6f,
+  0xfe, 0xa2, 0x00, 0x00, 0x9c, 0x47, 0xdf, 0x20, 0x00, 0xc8, 0x00, 0x0e, 0xb0,
+  0x00, 0xf6, 0x00, 0x07, 0xf0, 0x02, 0xf3, 0x00, 0x04, 0xf2, 0x9f, 0xff, 0xf4,
+  0x04, 0xf1, 0x29, 0xd3, 0x30, 0x07, 0xe0, 0x0a, 0xa0, 0x00, 0x0d, 0x90, 0x0d,
+  0x70, 0x00, 0xae, 0x10, 0x0f, 0x85, 0x7d, 0xe3, 0x00, 0x3f, 0xfe, 0xc7, 0x10,
+  0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x01, 0xff, 0x13, 0x77, 0x00, 0x07, 0x90, 0x00, 0x5f, 0x40, 0x9f, 0x40,
+  0x00, 0x07, 0xfc, 0xe3, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00, 0x00, 0x3e, 0xbc,
+  0xc0, 0x00, 0x05, 0xf8, 0x01, 0xda, 0x00, 0x04, 0x60, 0x00, 0x26, 0x00, 0x01,
+  0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x41,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x60, 0xab, 0x00,
+  0x00, 0x01, 0x00, 0xc8, 0x0a, 0x00, 0xff, 0x1a, 0xff, 0xff, 0xf9, 0x00, 0x02,
+  0xf5, 0x33, 0x7f, 0x80, 0x05, 0xf0, 0x00, 0x09, 0xd0, 0x08, 0xd0, 0x00, 0x08,
+  0xe0, 0x0b, 0xa0, 0x00, 0x0c, 0xc0, 0x0e, 0x80, 0x02, 0x9f, 0x40, 0x1f, 0xff,
+  0xff, 0xe5, 0x00, 0x3f, 0x53, 0x32, 0x00, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x04,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x36, 0x10, 0x15,
+  0x05, 0x00, 0xb0, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x28, 0x4c, 0xfe, 0x70, 0x00, 0x04, 0xf9,
+  0x48, 0xf4, 0x00, 0x0b, 0xb0, 0x01, 0xf4, 0x00, 0x02, 0xbf, 0x9f, 0x9e, 0xc0,
+  0x0d, 0xc5, 0xef, 0xa5, 0xf5, 0x4f, 0x10, 0x9e, 0x00, 0xd6, 0x9b, 0x00, 0xaf,
+  0xff, 0xf4, 0xb9, 0x00, 0xc8, 0x22, 0x20, 0xb9, 0x02, 0xf7, 0x05, 0x70, 0x8e,
+  0x5c, 0xfc, 0x5e, 0x60, 0x1c, 0xeb, 0xeb, 0xf9, 0x00, 0xd0, 0x3b, 0x00, 0x10,
+  0x90, 0x05, 0x00, 0x15, 0x10, 0x4a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0xff, 0x26, 0x06, 0xf6, 0x85, 0x00, 0x00, 0x4b, 0xef,
+  0x70, 0x00, 0x00, 0x42, 0x0c, 0x80, 0x00, 0x1a, 0xef, 0xb8, 0xe0, 0x01, 0xed,
+  0x64, 0x9f, 0xf1, 0x0a, 0xd0, 0x00, 0x0a, 0xf1, 0x0f, 0x60, 0x00, 0x06, 0xf1,
+  0x1f, 0x50, 0x00, 0x08, 0xd0, 0x0f, 0x90, 0x00, 0x2f, 0x70, 0x08, 0xf8, 0x47,
+  0xec, 0x00, 0x00, 0x7d, 0xfd, 0x80, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x10, 0x01, 0x05, 0x00, 0x77, 0x5f,
+  0xb0, 0x00, 0x00, 0x00, 0x4f, 0x90, 0x17, 0x00, 0xd0, 0x08, 0xff, 0xff, 0xff,
+  0xb0, 0x02, 0x33, 0x33, 0x33, 0x20, 0x00, 0x00, 0x10, 0x10, 0x00, 0x7f, 0xf8,
+  0x00, 0x00, 0x00, 0x06, 0xf6, 0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x05, 0xff, 0x17, 0x01, 0xae, 0xfc, 0x8e, 0x30, 0x2e,
+  0xc5, 0x5d, 0xf4, 0x00, 0xac, 0x00, 0x5e, 0xe8, 0x00, 0xf5, 0x05, 0xe2, 0xba,
+  0x00, 0xf4, 0x6e, 0x20, 0xc9, 0x00, 0xfc, 0xe2, 0x03, 0xf4, 0x00, 0xbf, 0x94,
+  0x7f, 0xa0, 0x00, 0xd8, 0xef, 0xd6, 0x3c, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf0, 0x2d, 0x09, 0xef, 0xf1, 0x00, 0x00,
+  0x5f, 0x64, 0x40, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0x70,
+  0x00, 0x34, 0xf8, 0x44, 0x10, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x00, 0x05, 0xf0,
+  0x00, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x00, 0x0b, 0x90, 0x00, 0x00, 0x00,
+  0x0e, 0x60, 0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00,
+  0x00, 0x24, 0xcc, 0x31, 0x00, 0x14, 0xc3, 0x49, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10, 0x41, 0x05, 0x00, 0x70, 0xae, 0x50,
+  0x00, 0x00, 0x00, 0x06, 0xe6, 0x0b, 0x00, 0x2f, 0x01, 0x00, 0x01, 0x00, 0x29,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xff, 0x01, 0x05,
+  0x00, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x00, 0x00, 0xeb, 0x40, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x01, 0x00, 0x2a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x7e, 0xe5, 0x00, 0x00, 0x06, 0xa2,
+  0x4d, 0x00, 0x01, 0x00, 0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xef, 0x03, 0xec, 0x2b, 0x40, 0x00, 0x0a, 0x79, 0xfd, 0x00, 0x00,
+  0x02, 0x00, 0x20, 0x00, 0x01, 0x00, 0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11,
+  0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef,
+  0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x01, 0x00, 0x9f, 0x06, 0xf3, 0x6f, 0x10, 0x00, 0x00, 0x20,
+  0x02, 0x00, 0x01, 0x00, 0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xff, 0x03, 0x4e, 0xe3, 0x00, 0x00, 0x00, 0xa7, 0x89, 0x00, 0x00,
+  0x00, 0x6f, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x01, 0x00, 0x29, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xdf, 0x02, 0x02, 0x00,
+  0x00, 0x00, 0xb7, 0x4d, 0x00, 0x00, 0x05, 0xb0, 0xd3, 0x00, 0x01, 0x00, 0x2e,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x29, 0x10, 0x02,
+  0x05, 0x00, 0x10, 0x2c, 0x05, 0x00, 0xf0, 0x04, 0x2f, 0xe3, 0x00, 0x00, 0x00,
+  0x04, 0xd7, 0x00, 0x00, 0x05, 0xff, 0xe2, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xfe, 0x28, 0x0c, 0xf1, 0x00, 0x00, 0x00, 0x4f,
+  0xf3, 0x00, 0x00, 0x00, 0xc8, 0xe6, 0x00, 0x00, 0x04, 0xf1, 0xc8, 0x00, 0x00,
+  0x0c, 0x90, 0xaa, 0x00, 0x00, 0x4f, 0x10, 0x8c, 0x00, 0x00, 0xca, 0x00, 0x6e,
+  0x00, 0x04, 0xff, 0xff, 0xff, 0x10, 0x0c, 0xb2, 0x22, 0x4f, 0x30, 0x4f, 0x30,
+  0x00, 0x0f, 0x50, 0xcc, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0xcf, 0xff,
+  0xea, 0x10, 0x00, 0xe8, 0x44, 0x6f, 0xb0, 0x01, 0xf3, 0x00, 0x08, 0xf0, 0x04,
+  0xf1, 0x00, 0x08, 0xd0, 0x07, 0xe0, 0x01, 0x5f, 0x60, 0x0a, 0xff, 0xff, 0xf5,
+  0x00, 0x0d, 0xa3, 0x34, 0xbe, 0x10, 0x0f, 0x50, 0x00, 0x0f, 0x60, 0x0f, 0x20,
+  0x00, 0x2f, 0x50, 0x0f, 0x44, 0x47, 0xed, 0x00, 0x0f, 0xff, 0xfd, 0x81, 0x00,
+  0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xf0, 0x14, 0x7b, 0xbb, 0xbb, 0x00, 0x00, 0xda, 0x77, 0x77, 0x00, 0x01, 0xf2,
+  0x00, 0x00, 0x00, 0x04, 0xe0, 0x00, 0x00, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x00,
+  0x0c, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x27, 0x00,
+  0x10, 0x7c, 0x05, 0x00, 0x10, 0xa8, 0x05, 0x00, 0x2f, 0xb4, 0x00, 0x01, 0x00,
+  0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xfe, 0x27,
+  0xa7, 0x00, 0x00, 0x00, 0x07, 0xeb, 0x00, 0x00, 0x00, 0x1e, 0x6d, 0x00, 0x00,
+  0x00, 0x88, 0x3e, 0x00, 0x00, 0x02, 0xe1, 0x2f, 0x00, 0x00, 0x0a, 0x80, 0x1f,
+  0x10, 0x00, 0x3e, 0x00, 0x0f, 0x20, 0x00, 0xc7, 0x00, 0x0f, 0x40, 0x05, 0xe0,
+  0x00, 0x0e, 0x50, 0x0d, 0xa5, 0x55, 0x5d, 0x70, 0x3d, 0xdd, 0xdd, 0xdd, 0x50,
+  0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xb0, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x9c, 0x44, 0x44, 0x41, 0x00, 0xc8,
+  0x0f, 0x00, 0xff, 0x18, 0xf6, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0xff, 0xff, 0x30, 0x08, 0xd3, 0x33, 0x33, 0x00, 0x0b, 0xa0, 0x00,
+  0x00, 0x00, 0x0e, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x74, 0x44, 0x43, 0x00, 0x3f,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0xaf, 0xff, 0xff, 0xfa, 0x00, 0x34, 0x44,
+  0x49, 0xf3, 0x00, 0x00, 0x00, 0x3f, 0x50, 0x00, 0x00, 0x01, 0xe7, 0x00, 0x00,
+  0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x00,
+  0x00, 0x00, 0x5f, 0x20, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x00, 0x1e, 0xa4,
+  0x44, 0x44, 0x00, 0x8f, 0xff, 0xff, 0xfe, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xfe, 0x2a, 0x01, 0xf4, 0x00,
+  0x00, 0x4f, 0x03, 0xf1, 0x00, 0x00, 0x7d, 0x06, 0xf0, 0x00, 0x00, 0xab, 0x09,
+  0xc0, 0x00, 0x00, 0xc8, 0x0c, 0x90, 0x00, 0x00, 0xf5, 0x0f, 0xff, 0xff, 0xff,
+  0xf2, 0x2f, 0x53, 0x33, 0x37, 0xf0, 0x5f, 0x00, 0x00, 0x08, 0xc0, 0x8d, 0x00,
+  0x00, 0x0b, 0x90, 0xaa, 0x00, 0x00, 0x0e, 0x60, 0xd7, 0x00, 0x00, 0x1f, 0x30,
+  0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+  0x00, 0xff, 0x26, 0x18, 0xcc, 0x50, 0x00, 0x01, 0xdb, 0x59, 0xf3, 0x00, 0x0c,
+  0x90, 0x00, 0xc9, 0x00, 0x5e, 0x00, 0x00, 0x9b, 0x00, 0xb8, 0x24, 0x41, 0xa9,
+  0x00, 0xf4, 0xad, 0xd2, 0xd7, 0x03, 0xf1, 0x00, 0x01, 0xf2, 0x04, 0xf0, 0x00,
+  0x08, 0xc0, 0x03, 0xf3, 0x00, 0x2f, 0x30, 0x00, 0xdc, 0x36, 0xe7, 0x00, 0x00,
+  0x3c, 0xfc, 0x50, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xd0, 0x3f, 0xff, 0xff, 0xf3, 0x00, 0x14, 0x4e, 0x94,
+  0x40, 0x00, 0x00, 0x0f, 0x50, 0x10, 0x00, 0x50, 0x20, 0x00, 0x00, 0x00, 0x6f,
+  0x1a, 0x00, 0x10, 0x9c, 0x05, 0x00, 0x10, 0xc9, 0x05, 0x00, 0xf0, 0x01, 0xf6,
+  0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x03, 0x47, 0xf4, 0x42, 0x00, 0x0f,
+  0xff, 0xff, 0x10, 0x00, 0x0e, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x8d, 0x00, 0x05, 0xf8, 0x00, 0xaa, 0x00,
+  0x5f, 0x80, 0x00, 0xd7, 0x05, 0xf7, 0x00, 0x00, 0xf5, 0x5f, 0x70, 0x00, 0x03,
+  0xf7, 0xf6, 0x00, 0x00, 0x06, 0xff, 0x80, 0x00, 0x00, 0x09, 0xcc, 0xd0, 0x00,
+  0x00, 0x0c, 0x92, 0xf9, 0x00, 0x00, 0x0f, 0x60, 0x5f, 0x40, 0x00, 0x1f, 0x30,
+  0x0a, 0xe1, 0x00, 0x4f, 0x00, 0x00, 0xdb, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xfe, 0x27, 0xa7, 0x00, 0x00,
+  0x00, 0x07, 0xfb, 0x00, 0x00, 0x00, 0x0e, 0x7c, 0x00, 0x00, 0x00, 0x79, 0x5d,
+  0x00, 0x00, 0x01, 0xe2, 0x4e, 0x00, 0x00, 0x08, 0x90, 0x3f, 0x00, 0x00, 0x1f,
+  0x20, 0x3f, 0x00, 0x00, 0x99, 0x00, 0x2f, 0x10, 0x02, 0xf2, 0x00, 0x1f, 0x20,
+  0x0a, 0x90, 0x00, 0x0f, 0x30, 0x1c, 0x10, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xfe, 0x29,
+  0xf9, 0x00, 0x00, 0xcf, 0x03, 0xfe, 0x00, 0x06, 0xfc, 0x06, 0xff, 0x30, 0x2f,
+  0xfa, 0x08, 0xcc, 0x80, 0xcb, 0xd7, 0x0b, 0x97, 0xd6, 0xe2, 0xf4, 0x0e, 0x62,
+  0xff, 0x53, 0xf1, 0x1f, 0x30, 0xda, 0x06, 0xe0, 0x4f, 0x00, 0x00, 0x09, 0xb0,
+  0x7d, 0x00, 0x00, 0x0c, 0x80, 0xaa, 0x00, 0x00, 0x0f, 0x50, 0xd7, 0x00, 0x00,
+  0x2f, 0x20, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0xfe, 0x29, 0xec, 0x00, 0x00, 0x6e, 0x01, 0xff, 0x20, 0x00,
+  0x9b, 0x04, 0xfd, 0x80, 0x00, 0xc8, 0x07, 0xe6, 0xe0, 0x00, 0xf5, 0x0a, 0xb0,
+  0xf5, 0x02, 0xf2, 0x0c, 0x80, 0x9b, 0x05, 0xf0, 0x0f, 0x50, 0x3f, 0x28, 0xc0,
+  0x2f, 0x20, 0x0c, 0x8a, 0xa0, 0x5f, 0x00, 0x06, 0xee, 0x70, 0x8c, 0x00, 0x00,
+  0xff, 0x40, 0xb9, 0x00, 0x00, 0x9f, 0x10, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x97, 0x04, 0xbb, 0xbb, 0xbb,
+  0x00, 0x04, 0x77, 0x77, 0x76, 0x14, 0x00, 0x9b, 0x01, 0x44, 0x44, 0x00, 0x00,
+  0x07, 0xdd, 0xdd, 0x00, 0x01, 0x00, 0xaf, 0x03, 0x55, 0x55, 0x55, 0x00, 0x0a,
+  0xdd, 0xdd, 0xdc, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x04, 0xbf, 0xfa, 0x10, 0x00, 0x7f, 0x95,
+  0x6e, 0xd0, 0x04, 0xf5, 0x00, 0x03, 0xf4, 0x0c, 0xb0, 0x00, 0x00, 0xe7, 0x2f,
+  0x40, 0x00, 0x00, 0xd9, 0x5f, 0x00, 0x00, 0x00, 0xe7, 0x6f, 0x00, 0x00, 0x02,
+  0xf4, 0x5f, 0x10, 0x00, 0x08, 0xe0, 0x2f, 0x60, 0x00, 0x3f, 0x60, 0x0a, 0xf7,
+  0x48, 0xfa, 0x00, 0x00, 0x9e, 0xfc, 0x60, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x27, 0x05, 0xbb, 0xbb,
+  0xbb, 0x00, 0x0a, 0xb7, 0x77, 0xae, 0x00, 0x0e, 0x50, 0x00, 0x8a, 0x00, 0x1f,
+  0x20, 0x00, 0xc7, 0x00, 0x5e, 0x00, 0x00, 0xf3, 0x00, 0x9a, 0x00, 0x03, 0xf0,
+  0x00, 0xc7, 0x00, 0x07, 0xc0, 0x00, 0xf3, 0x00, 0x0b, 0x80, 0x04, 0xf0, 0x00,
+  0x0e, 0x40, 0x07, 0xc0, 0x00, 0x2f, 0x10, 0x09, 0x70, 0x00, 0x4b, 0x00, 0x01,
+  0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff,
+  0x24, 0xaf, 0xff, 0xfc, 0x30, 0x00, 0xca, 0x44, 0x5c, 0xf1, 0x00, 0xf5, 0x00,
+  0x02, 0xf4, 0x02, 0xf1, 0x00, 0x03, 0xf3, 0x05, 0xe0, 0x01, 0x4d, 0xd0, 0x08,
+  0xff, 0xff, 0xfa, 0x10, 0x0b, 0xa3, 0x32, 0x00, 0x00, 0x0e, 0x60, 0x00, 0x00,
+  0x00, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x00, 0x00, 0x00, 0x6e, 0x00,
+  0x01, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0xc0, 0x05, 0xbb, 0xbb, 0xb9, 0x00, 0x05, 0xf7, 0x77, 0x74, 0x00, 0x00, 0xd7,
+  0x10, 0x00, 0xff, 0x17, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x4d, 0x20, 0x00, 0x00, 0x04, 0xd2, 0x00,
+  0x00, 0x00, 0x3e, 0x20, 0x00, 0x00, 0x03, 0xf8, 0x55, 0x55, 0x00, 0x09, 0xdd,
+  0xdd, 0xdc, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0xf0, 0x07, 0xbf, 0xff, 0xff, 0xfa, 0x00, 0x34, 0x4e, 0x94,
+  0x42, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x00,
+  0x6f, 0x1a, 0x00, 0x10, 0x9c, 0x05, 0x00, 0x10, 0xc9, 0x05, 0x00, 0xff, 0x02,
+  0xe6, 0x00, 0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00,
+  0x00, 0x07, 0xd0, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0xf0, 0x12, 0x01, 0xf6, 0x00, 0x00, 0x9e, 0x00, 0xab,
+  0x00, 0x04, 0xf4, 0x00, 0x5f, 0x10, 0x1e, 0x90, 0x00, 0x0e, 0x70, 0xad, 0x00,
+  0x00, 0x09, 0xc5, 0xf2, 0x00, 0x00, 0x03, 0xff, 0x60, 0x00, 0x00, 0x00, 0xeb,
+  0x25, 0x00, 0x10, 0xf6, 0x29, 0x00, 0xcf, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf0,
+  0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf0, 0x23, 0xb6, 0x00, 0x00, 0x00, 0x38,
+  0xfc, 0x40, 0x00, 0x09, 0xda, 0xf8, 0xf6, 0x00, 0x7c, 0x06, 0xb0, 0x7d, 0x00,
+  0xf3, 0x09, 0x80, 0x4e, 0x05, 0xd0, 0x0d, 0x40, 0x6c, 0x07, 0xb0, 0x1f, 0x10,
+  0xb7, 0x06, 0xd0, 0x4d, 0x05, 0xe0, 0x01, 0xfa, 0xde, 0x9e, 0x30, 0x00, 0x29,
+  0xff, 0x71, 0x00, 0x00, 0x00, 0xf2, 0x36, 0x00, 0x2c, 0x20, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x10, 0x31, 0x03,
+  0x00, 0xfe, 0x29, 0xcb, 0x00, 0x06, 0xf2, 0x00, 0x5f, 0x20, 0x1f, 0x70, 0x00,
+  0x0e, 0x90, 0xac, 0x00, 0x00, 0x07, 0xf5, 0xf2, 0x00, 0x00, 0x01, 0xff, 0x70,
+  0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x08, 0xef, 0x40, 0x00, 0x00, 0x4f,
+  0x4c, 0xb0, 0x00, 0x01, 0xe9, 0x05, 0xf2, 0x00, 0x0a, 0xe0, 0x00, 0xd9, 0x00,
+  0x5f, 0x40, 0x00, 0x7f, 0x10, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x16, 0x0a, 0x20, 0x84, 0x06, 0x00,
+  0x2f, 0x00, 0xf4, 0x0b, 0x00, 0x6c, 0x03, 0xf0, 0x0f, 0x00, 0x99, 0x07, 0xc0,
+  0x4f, 0x00, 0xb9, 0x0a, 0x90, 0xb9, 0x00, 0x8e, 0x5f, 0x99, 0xd1, 0x00, 0x08,
+  0xff, 0xe8, 0x10, 0x00, 0x00, 0x5e, 0x29, 0x00, 0x10, 0x9a, 0x05, 0x00, 0x10,
+  0xd6, 0x05, 0x00, 0x2f, 0xc2, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xfe, 0x28, 0x18, 0xcc, 0x60, 0x00, 0x01,
+  0xda, 0x58, 0xf4, 0x00, 0x0c, 0x90, 0x00, 0xca, 0x00, 0x5e, 0x00, 0x00, 0x9b,
+  0x00, 0xb9, 0x00, 0x00, 0xaa, 0x00, 0xf4, 0x00, 0x00, 0xd6, 0x02, 0xf1, 0x00,
+  0x02, 0xf1, 0x01, 0xf2, 0x00, 0x09, 0x90, 0x00, 0xd5, 0x00, 0x4d, 0x00, 0x04,
+  0x9c, 0x03, 0xe6, 0x20, 0x4d, 0xda, 0x08, 0xdd, 0x60, 0x00, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xff, 0x16,
+  0x7b, 0x70, 0x85, 0x00, 0x1d, 0xb6, 0xc8, 0xb6, 0x00, 0xaa, 0x00, 0x4f, 0x61,
+  0x01, 0xf1, 0x00, 0x3f, 0x00, 0x06, 0xd0, 0x00, 0x8a, 0x00, 0x07, 0xc0, 0x01,
+  0xe4, 0x00, 0x05, 0xf4, 0x3b, 0xf4, 0x00, 0x00, 0xaf, 0xb2, 0xce, 0x3a, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x37,
+  0x07, 0xba, 0x20, 0x00, 0x00, 0xab, 0x5b, 0xc0, 0x00, 0x05, 0xd0, 0x05, 0xe0,
+  0x00, 0x0b, 0x70, 0x08, 0xa0, 0x00, 0x0f, 0x20, 0x3d, 0x20, 0x00, 0x3e, 0x09,
+  0xe3, 0x00, 0x00, 0x6a, 0x07, 0xbe, 0x10, 0x00, 0xa6, 0x00, 0x0d, 0x60, 0x00,
+  0xe3, 0x00, 0x0d, 0x50, 0x02, 0xf0, 0x00, 0x3f, 0x10, 0x05, 0xf9, 0x24, 0xe7,
+  0x00, 0x09, 0x89, 0xfe, 0x70, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x1f, 0x10,
+  0x00, 0x00, 0x00, 0x2a, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x06, 0xf3, 0x25, 0x5e, 0x00, 0x01, 0xe1, 0x00, 0x1f,
+  0x30, 0x07, 0xa0, 0x00, 0x0d, 0x60, 0x0e, 0x20, 0x00, 0x0a, 0x80, 0x89, 0x00,
+  0x00, 0x07, 0x93, 0xd0, 0x00, 0x00, 0x07, 0xac, 0x40, 0x00, 0x00, 0x06, 0xf8,
+  0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x09, 0x70, 0x00, 0x00, 0x00,
+  0x0c, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x10, 0x3b, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xb0, 0x19, 0xba, 0x82, 0x00, 0x00, 0xc9,
+  0x46, 0xa8, 0x00, 0x01, 0xf1, 0x0f, 0x00, 0x10, 0xcb, 0x05, 0x00, 0xff, 0x17,
+  0x2f, 0xc0, 0x00, 0x00, 0x03, 0xcb, 0xdb, 0x00, 0x00, 0x4d, 0x20, 0x2f, 0x40,
+  0x00, 0xe4, 0x00, 0x0c, 0x60, 0x04, 0xe0, 0x00, 0x0e, 0x30, 0x05, 0xd0, 0x00,
+  0x5d, 0x00, 0x02, 0xf7, 0x25, 0xf3, 0x00, 0x00, 0x6e, 0xfc, 0x30, 0x00, 0x01,
+  0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07,
+  0xff, 0x16, 0x6a, 0xb8, 0x00, 0x00, 0x0b, 0xb5, 0x5a, 0x70, 0x00, 0x1f, 0x10,
+  0x00, 0x00, 0x00, 0x0a, 0xc8, 0x40, 0x00, 0x00, 0x5c, 0x97, 0x30, 0x00, 0x01,
+  0xf1, 0x00, 0x00, 0x00, 0x03, 0xf5, 0x12, 0x66, 0x00, 0x00, 0x8e, 0xfd, 0x81,
+  0x3a, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf0, 0x14, 0x39, 0x99, 0x98, 0x00, 0x00, 0x37, 0x67, 0xf7, 0x00, 0x00, 0x00,
+  0x3c, 0x40, 0x00, 0x00, 0x05, 0xd2, 0x00, 0x00, 0x00, 0x4d, 0x10, 0x00, 0x00,
+  0x02, 0xe2, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x00, 0x3e, 0x27, 0x00,
+  0x10, 0x9a, 0x05, 0x00, 0x10, 0xaa, 0x05, 0x00, 0xd0, 0x7f, 0x71, 0x00, 0x00,
+  0x00, 0x08, 0xef, 0xb0, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x05, 0x00, 0x00, 0x0a,
+  0x00, 0xd0, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xf0, 0x21, 0x08, 0x06, 0xb9, 0x00,
+  0x00, 0x2f, 0xa9, 0x7f, 0x50, 0x00, 0x5f, 0x30, 0x0c, 0x50, 0x00, 0x99, 0x00,
+  0x0e, 0x20, 0x00, 0xc5, 0x00, 0x2e, 0x00, 0x00, 0xf2, 0x00, 0x6b, 0x00, 0x04,
+  0xe0, 0x00, 0xa7, 0x00, 0x07, 0x90, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x00, 0x05, 0xc0, 0x05, 0x00, 0xc0, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xff, 0x2c,
+  0x07, 0xba, 0x30, 0x00, 0x00, 0xad, 0x58, 0xf4, 0x00, 0x03, 0xf1, 0x00, 0x8d,
+  0x00, 0x08, 0xb0, 0x00, 0x2f, 0x20, 0x0b, 0x80, 0x00, 0x0f, 0x50, 0x0d, 0xe7,
+  0x77, 0x7f, 0x60, 0x0e, 0xf8, 0x88, 0x8f, 0x60, 0x0c, 0x80, 0x00, 0x0e, 0x50,
+  0x09, 0xa0, 0x00, 0x1f, 0x30, 0x05, 0xe0, 0x00, 0x6e, 0x00, 0x00, 0xda, 0x24,
+  0xe7, 0x00, 0x00, 0x1b, 0xfe, 0x70, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xb0, 0x59, 0x00, 0x00, 0x00,
+  0x02, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x5c, 0x0f, 0x00, 0x10, 0x88, 0x05, 0x00,
+  0x10, 0xc4, 0x05, 0x00, 0x10, 0xf1, 0x14, 0x00, 0x7f, 0xf4, 0x21, 0x00, 0x00,
+  0x00, 0xbf, 0xd3, 0x3a, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x06, 0xfc, 0x1c, 0x4a, 0x00, 0x05, 0xd1, 0x02, 0x4f, 0x20,
+  0xaf, 0xa0, 0x01, 0x3e, 0x0b, 0xb2, 0x00, 0x00, 0x7b, 0xaf, 0x10, 0x00, 0x00,
+  0xbe, 0x7d, 0x50, 0x00, 0x00, 0xe9, 0x07, 0xc0, 0x00, 0x02, 0xf1, 0x01, 0xf4,
+  0x30, 0x04, 0x90, 0x00, 0x9d, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xd0, 0x04, 0xba, 0x00,
+  0x00, 0x00, 0x03, 0x6e, 0x70, 0x00, 0x00, 0x00, 0x07, 0xb0, 0x10, 0x00, 0xff,
+  0x1b, 0xd0, 0x00, 0x00, 0x00, 0x0a, 0xe0, 0x00, 0x00, 0x00, 0x4d, 0xf0, 0x00,
+  0x00, 0x00, 0xd3, 0xf1, 0x00, 0x00, 0x08, 0x90, 0xe3, 0x00, 0x00, 0x2e, 0x10,
+  0xd4, 0x00, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0xd0, 0x00, 0xb7, 0x00, 0x0c,
+  0x40, 0x00, 0x87, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x06, 0xf0, 0x17, 0x18, 0x00, 0x04, 0x50, 0x00, 0x5d,
+  0x00, 0x0b, 0x60, 0x00, 0x99, 0x00, 0x0f, 0x20, 0x00, 0xc6, 0x00, 0x3e, 0x00,
+  0x00, 0xf2, 0x00, 0x6a, 0x00, 0x04, 0xf0, 0x00, 0xc7, 0x00, 0x07, 0xf5, 0x3a,
+  0xe5, 0x00, 0x0b, 0xae, 0xc3, 0xba, 0x1b, 0x00, 0x30, 0x00, 0x00, 0x2e, 0x31,
+  0x00, 0x15, 0x59, 0x3b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x06, 0xff, 0x16, 0x47, 0x00, 0x00, 0x2b, 0x00, 0x5f, 0x00, 0x00,
+  0xcf, 0x00, 0x0f, 0x30, 0x08, 0x82, 0x00, 0x0c, 0x60, 0x4c, 0x00, 0x00, 0x09,
+  0x81, 0xd2, 0x00, 0x00, 0x07, 0x9a, 0x60, 0x00, 0x00, 0x07, 0xda, 0x00, 0x00,
+  0x00, 0x05, 0xb0, 0x3b, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x00, 0x01, 0x00, 0xc0, 0x01, 0x99, 0x99, 0x98, 0x00, 0x01, 0x7c, 0xd8, 0x75,
+  0x00, 0x00, 0x5d, 0x10, 0x00, 0x10, 0xc6, 0x05, 0x00, 0x10, 0xb9, 0x05, 0x00,
+  0xf0, 0x00, 0x2f, 0xc9, 0x00, 0x00, 0x03, 0xc8, 0x54, 0x00, 0x00, 0x2e, 0x20,
+  0x00, 0x00, 0x00, 0x99, 0x13, 0x00, 0x10, 0xc8, 0x05, 0x00, 0xd0, 0xaf, 0x61,
+  0x00, 0x00, 0x00, 0x18, 0xef, 0xc1, 0x00, 0x00, 0x00, 0x04, 0xf3, 0x05, 0x00,
+  0x50, 0xc0, 0x00, 0x00, 0x00, 0x07, 0x24, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xff, 0x16, 0x6b, 0xa3,
+  0x00, 0x00, 0x0b, 0xb5, 0x9f, 0x20, 0x00, 0x9b, 0x00, 0x0d, 0x60, 0x00, 0xf3,
+  0x00, 0x0c, 0x60, 0x04, 0xe0, 0x00, 0x1f, 0x30, 0x05, 0xe0, 0x00, 0x7c, 0x00,
+  0x02, 0xf7, 0x26, 0xe2, 0x00, 0x00, 0x6e, 0xfb, 0x20, 0x3a, 0x00, 0x02, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x17, 0x78,
+  0x99, 0x99, 0x95, 0x00, 0x8e, 0xa8, 0x8f, 0x83, 0x00, 0x0f, 0x10, 0x3e, 0x00,
+  0x00, 0x4d, 0x00, 0x7a, 0x00, 0x00, 0x89, 0x00, 0xb6, 0x00, 0x00, 0xc5, 0x00,
+  0xe2, 0x00, 0x01, 0xf1, 0x01, 0xf2, 0x00, 0x04, 0xb0, 0x00, 0xdb, 0x3b, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf5,
+  0x22, 0x4a, 0xb7, 0x00, 0x00, 0x07, 0xd6, 0x7f, 0x50, 0x00, 0x3e, 0x10, 0x0b,
+  0x80, 0x00, 0x98, 0x00, 0x0c, 0x70, 0x00, 0xe3, 0x00, 0x0f, 0x40, 0x02, 0xf0,
+  0x00, 0x6d, 0x00, 0x05, 0xf7, 0x26, 0xf3, 0x00, 0x09, 0x9b, 0xfc, 0x30, 0x00,
+  0x0d, 0x40, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x29, 0x3a, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xff, 0x16,
+  0x48, 0x99, 0x95, 0x00, 0x0b, 0xc8, 0xdb, 0x74, 0x00, 0x9b, 0x00, 0x2e, 0x00,
+  0x01, 0xf2, 0x00, 0x0f, 0x00, 0x05, 0xd0, 0x00, 0x4e, 0x00, 0x06, 0xd0, 0x00,
+  0xb9, 0x00, 0x03, 0xf6, 0x29, 0xd1, 0x00, 0x00, 0x7e, 0xfa, 0x10, 0x3a, 0x00,
+  0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xc0,
+  0x38, 0x99, 0x99, 0x80, 0x00, 0x48, 0x8f, 0x98, 0x70, 0x00, 0x00, 0x2f, 0x10,
+  0x00, 0x10, 0x6b, 0x05, 0x00, 0x10, 0xa7, 0x05, 0x00, 0x10, 0xd3, 0x05, 0x00,
+  0x7f, 0xf4, 0x10, 0x00, 0x00, 0x00, 0xcf, 0x60, 0x3b, 0x00, 0x02, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x17, 0x8a, 0x00,
+  0x07, 0x80, 0x04, 0x6c, 0x00, 0x0b, 0x90, 0x00, 0x88, 0x00, 0x0b, 0x70, 0x00,
+  0xc4, 0x00, 0x0d, 0x50, 0x00, 0xf0, 0x00, 0x1f, 0x10, 0x03, 0xe0, 0x00, 0x9a,
+  0x00, 0x02, 0xf6, 0x27, 0xe1, 0x00, 0x00, 0x8e, 0xfa, 0x10, 0x3b, 0x00, 0x02,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf3, 0x32, 0x20,
+  0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x06, 0xb0, 0x00, 0x00, 0x01,
+  0x7f, 0xf6, 0x00, 0x00, 0x2e, 0x8f, 0x9e, 0x60, 0x00, 0xd6, 0x1f, 0x08, 0xb0,
+  0x04, 0xe0, 0x5c, 0x07, 0xb0, 0x09, 0x90, 0x98, 0x09, 0x80, 0x0d, 0x60, 0xd5,
+  0x0d, 0x40, 0x0f, 0x20, 0xf1, 0x0f, 0x23, 0x4e, 0x04, 0xd0, 0x1f, 0x80, 0x00,
+  0x08, 0xa0, 0x01, 0x00, 0x00, 0x0b, 0x60, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x48,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xf0,
+  0x31, 0x6a, 0x00, 0x03, 0xa0, 0x03, 0x5f, 0x30, 0x1d, 0x44, 0x01, 0x0d, 0x80,
+  0xa7, 0x01, 0x00, 0x07, 0xc6, 0xb0, 0x00, 0x00, 0x02, 0xfd, 0x10, 0x00, 0x00,
+  0x00, 0xf6, 0x00, 0x00, 0x00, 0x0a, 0xda, 0x00, 0x00, 0x00, 0x6b, 0x2f, 0x00,
+  0x00, 0x03, 0xd1, 0x0d, 0x50, 0x00, 0x1d, 0x30, 0x08, 0xb0, 0x00, 0x77, 0x00,
+  0x03, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x01, 0x00, 0xf3, 0x32, 0x20, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x00,
+  0x00, 0x00, 0x06, 0xb0, 0x00, 0x02, 0xa3, 0x0a, 0x71, 0x90, 0x05, 0xc6, 0x0d,
+  0x43, 0xe0, 0x10, 0xe3, 0x1f, 0x04, 0xd0, 0x02, 0xf0, 0x5c, 0x06, 0xb0, 0x06,
+  0xb0, 0x99, 0x09, 0x70, 0x09, 0x70, 0xc5, 0x0d, 0x40, 0x0d, 0x30, 0xf1, 0x0f,
+  0x13, 0x1f, 0x04, 0xd0, 0x1f, 0x70, 0x00, 0x07, 0xa0, 0x01, 0x00, 0x00, 0x0b,
+  0x60, 0x00, 0x00, 0x00, 0x09, 0x20, 0x48, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x17, 0x0c, 0x40, 0x06, 0xb0, 0x00,
+  0x8b, 0x00, 0x04, 0xe0, 0x01, 0xf2, 0x01, 0x03, 0xf0, 0x06, 0xb0, 0x5c, 0x05,
+  0xd0, 0x0b, 0x70, 0x87, 0x08, 0xa0, 0x0d, 0x40, 0xc4, 0x0d, 0x50, 0x0c, 0x86,
+  0xf6, 0x7d, 0x00, 0x05, 0xfb, 0x3e, 0xc2, 0x3b, 0x00, 0x02, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70,
+  0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b,
+  0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee,
+  0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12,
+  0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70,
+  0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x07, 0x10,
+  0x14, 0x05, 0x00, 0x10, 0xf4, 0x05, 0x00, 0xab, 0xd4, 0xfe, 0xee, 0xef, 0x70,
+  0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x02, 0xf0, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x06, 0xd1,
+  0x00, 0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x07, 0xc1, 0x00, 0x00, 0x00, 0x6f,
+  0xdc, 0xcc, 0xcc, 0xc1, 0x2e, 0xa5, 0x55, 0x55, 0x50, 0x02, 0xd6, 0x22, 0x00,
+  0x7f, 0x1d, 0x70, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x3f, 0x00, 0x03, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02, 0xf8, 0x12, 0x51, 0x00,
+  0x00, 0x00, 0x05, 0xfd, 0x10, 0x00, 0x00, 0x5d, 0xdb, 0xd1, 0x00, 0x04, 0xe2,
+  0xc5, 0x6c, 0x10, 0x3e, 0x20, 0xc5, 0x08, 0xc0, 0x02, 0x00, 0xc5, 0x00, 0x20,
+  0x00, 0x00, 0xc5, 0x00, 0x00, 0x05, 0x00, 0x1d, 0x21, 0x3f, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02, 0x10, 0x21, 0x05, 0x00,
+  0x70, 0x6d, 0x10, 0x00, 0x00, 0x00, 0x06, 0xd2, 0x0b, 0x00, 0xff, 0x0a, 0x5d,
+  0x20, 0x6c, 0xcc, 0xcc, 0xce, 0xe1, 0x25, 0x55, 0x55, 0x5e, 0x90, 0x00, 0x00,
+  0x00, 0xb9, 0x00, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x00,
+  0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02, 0x10,
+  0x73, 0x05, 0x00, 0x18, 0xc5, 0x05, 0x00, 0xff, 0x08, 0x28, 0x00, 0xc5, 0x01,
+  0x90, 0x0c, 0x70, 0xc5, 0x1d, 0x70, 0x00, 0xc6, 0xc6, 0xc7, 0x00, 0x00, 0x1c,
+  0xee, 0x70, 0x00, 0x00, 0x01, 0xd8, 0x3f, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x01, 0xf0, 0x0a, 0x02, 0xd9, 0x00, 0x00, 0x00, 0x4d,
+  0xec, 0xb0, 0x00, 0x45, 0xd2, 0xc5, 0x7d, 0x00, 0xd1, 0x10, 0xc5, 0x03, 0x00,
+  0xe0, 0x00, 0xc5, 0x00, 0x00, 0xc0, 0x05, 0x00, 0xfd, 0x03, 0xc5, 0x60, 0xc5,
+  0x09, 0x00, 0x11, 0xc8, 0xc7, 0xc7, 0x00, 0x00, 0x0a, 0xff, 0x50, 0x00, 0x00,
+  0x00, 0x73, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x05, 0xf0, 0x13, 0x02, 0x55, 0x55, 0x43, 0x00, 0x07, 0xfc, 0x9a, 0xa7,
+  0x00, 0x07, 0xcf, 0x30, 0x00, 0x00, 0x06, 0x85, 0xe3, 0x00, 0x00, 0x06, 0x80,
+  0x5e, 0x30, 0x00, 0x06, 0x90, 0x05, 0xe3, 0x00, 0x04, 0x70, 0x00, 0x5e, 0x26,
+  0x00, 0x1f, 0x01, 0x3c, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x06, 0xff, 0x12, 0x44, 0x55, 0x55, 0x00, 0x01, 0xba, 0xa9,
+  0xff, 0x00, 0x00, 0x00, 0x0a, 0xce, 0x00, 0x00, 0x00, 0xac, 0x1e, 0x00, 0x00,
+  0x0a, 0xc1, 0x0e, 0x00, 0x00, 0xac, 0x10, 0x1e, 0x00, 0x07, 0xc1, 0x00, 0x1a,
+  0x3b, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x05, 0xff, 0x14, 0x02, 0x50, 0x00, 0x02, 0x00, 0x03, 0xf6, 0x00, 0x0f, 0x00,
+  0x00, 0x3e, 0x60, 0x0f, 0x00, 0x00, 0x03, 0xe6, 0x0f, 0x00, 0x00, 0x00, 0x3e,
+  0x6e, 0x00, 0x00, 0x21, 0x13, 0xef, 0x00, 0x01, 0xdd, 0xee, 0xee, 0x00, 0x01,
+  0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06,
+  0xff, 0x12, 0x20, 0x00, 0x07, 0x00, 0x04, 0xb0, 0x00, 0xac, 0x00, 0x04, 0xa0,
+  0x0a, 0xc0, 0x00, 0x04, 0xa0, 0xac, 0x00, 0x00, 0x05, 0x9a, 0xc0, 0x00, 0x00,
+  0x05, 0xfc, 0x10, 0x11, 0x00, 0x05, 0xee, 0xee, 0xea, 0x3b, 0x00, 0x07, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02, 0xf0, 0x04, 0x30,
+  0x00, 0x00, 0x00, 0x06, 0xd1, 0x00, 0x00, 0x00, 0x8f, 0x31, 0x11, 0x10, 0x07,
+  0xfd, 0xcc, 0xcc, 0xc1, 0x6c, 0x17, 0x00, 0xff, 0x03, 0x2d, 0x63, 0x33, 0x33,
+  0x30, 0x02, 0xff, 0xaa, 0xaa, 0xa1, 0x00, 0x1d, 0x60, 0x00, 0x00, 0x00, 0x01,
+  0xc1, 0x3f, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x02, 0xf7, 0x12, 0x51, 0x00, 0x00, 0x00, 0x05, 0xdd, 0x10, 0x00, 0x00,
+  0x5f, 0x17, 0xf1, 0x00, 0x04, 0xfe, 0x02, 0xfc, 0x10, 0x3e, 0x4c, 0x02, 0xb7,
+  0xc0, 0x02, 0x1c, 0x02, 0xb0, 0x20, 0x00, 0x1c, 0x02, 0xb0, 0x00, 0x05, 0x00,
+  0x3c, 0x02, 0x00, 0x20, 0x3f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x02, 0x10, 0x21, 0x05, 0x00, 0xff, 0x15, 0x6d, 0x10, 0x00,
+  0x01, 0x11, 0x17, 0xf2, 0x00, 0x6c, 0xcc, 0xcc, 0xff, 0x20, 0x00, 0x00, 0x00,
+  0x04, 0xe1, 0x13, 0x33, 0x33, 0x3b, 0x90, 0x5a, 0xaa, 0xab, 0xfb, 0x00, 0x00,
+  0x00, 0x1c, 0x80, 0x00, 0x00, 0x00, 0x78, 0x3f, 0x00, 0x03, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x87, 0x07, 0x01, 0x60, 0x00,
+  0x00, 0x1c, 0x02, 0xb0, 0x05, 0x00, 0xff, 0x09, 0x28, 0x1c, 0x02, 0xb1, 0x90,
+  0x0c, 0x9c, 0x02, 0xcd, 0x70, 0x00, 0xef, 0x03, 0xf7, 0x00, 0x00, 0x1e, 0x6c,
+  0x90, 0x00, 0x00, 0x01, 0xd8, 0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04,
+  0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe,
+  0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10, 0x02, 0x05, 0x00, 0x70, 0x3f,
+  0x90, 0x00, 0x00, 0x00, 0x03, 0xe9, 0x0b, 0x00, 0xf0, 0x13, 0x2f, 0x30, 0x00,
+  0x09, 0xde, 0xab, 0x90, 0x01, 0xdb, 0x32, 0x8f, 0xc0, 0x09, 0xc0, 0x00, 0x0a,
+  0xd0, 0x0f, 0x60, 0x00, 0x09, 0xc0, 0x0f, 0x50, 0x00, 0x0c, 0x90, 0x0e, 0x70,
+  0x00, 0x3f, 0x30, 0x08, 0xe3, 0x28, 0x00, 0x8c, 0x9f, 0xfe, 0x70, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70,
+  0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00,
+  0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a,
+  0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70,
+  0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11,
+  0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef,
+  0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1,
+  0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee,
+  0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf0, 0x07, 0x9f, 0xff, 0xff, 0xf5, 0x00,
+  0x9e, 0x32, 0x22, 0x20, 0x00, 0x2f, 0x70, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x00,
+  0x00, 0x00, 0x01, 0xe8, 0x1a, 0x00, 0x60, 0x6f, 0x10, 0x00, 0x00, 0x00, 0x1f,
+  0x15, 0x00, 0x60, 0xcd, 0x10, 0x00, 0x00, 0x0a, 0xe2, 0x2d, 0x00, 0x50, 0x30,
+  0x00, 0x00, 0x08, 0xf4, 0x1c, 0x00, 0xe6, 0x50, 0x00, 0x00, 0x00, 0xcf, 0xff,
+  0xff, 0xf8, 0x00, 0x22, 0x22, 0x22, 0x21, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xfd, 0x28, 0x01, 0xff, 0x00, 0x00,
+  0x00, 0x09, 0xe2, 0x00, 0x00, 0x00, 0x1f, 0x60, 0x00, 0x00, 0x00, 0xad, 0x00,
+  0x00, 0x00, 0x02, 0xf4, 0x00, 0x08, 0x20, 0x0a, 0xc0, 0x00, 0x0e, 0x70, 0x3f,
+  0x30, 0x00, 0x0b, 0xb0, 0xbb, 0x00, 0x00, 0x07, 0xe4, 0xf2, 0x00, 0x00, 0x03,
+  0xfd, 0x90, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xff,
+  0x0a, 0x0a, 0xfc, 0x14, 0xdf, 0x80, 0x7b, 0x18, 0xde, 0x41, 0xd4, 0xa6, 0x00,
+  0xda, 0x00, 0x97, 0x8b, 0x05, 0xef, 0x41, 0xd4, 0x0a, 0xfd, 0x24, 0xde, 0x80,
+  0x37, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00,
+  0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0,
+  0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11,
+  0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
+  0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04,
+  0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11,
+  0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xb0, 0x07, 0xef, 0xf1, 0x00, 0x00, 0x3f, 0x63, 0x30, 0x00, 0x00,
+  0x8d, 0x0f, 0x00, 0x10, 0xba, 0x05, 0x00, 0x10, 0xe7, 0x05, 0x00, 0xf0, 0x1d,
+  0xf4, 0x00, 0x00, 0x00, 0x03, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xe0, 0x00, 0x00,
+  0x00, 0x09, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0x90, 0x00, 0x00, 0x00, 0x0e, 0x60,
+  0x00, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x4f, 0x10, 0x00, 0x00, 0x00,
+  0xad, 0x00, 0x00, 0x00, 0xbf, 0x2c, 0x00, 0xa0, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xff, 0x0e, 0x6f,
+  0xf9, 0x25, 0xf0, 0x01, 0xf6, 0x5d, 0xff, 0x60, 0x00, 0x30, 0x00, 0x21, 0x00,
+  0x02, 0xdf, 0xc4, 0x2e, 0x50, 0x0b, 0xa4, 0xaf, 0xfb, 0x00, 0x03, 0x00, 0x01,
+  0x20, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x01, 0x00, 0xf0, 0x05, 0x06, 0x60, 0x00, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00,
+  0x00, 0xab, 0x00, 0x01, 0xcc, 0xcd, 0xfc, 0xb0, 0x00, 0x00, 0x1f, 0x0e, 0x00,
+  0xd1, 0x9c, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x0a, 0xce, 0xec, 0xcc,
+  0x40, 0x0e, 0x00, 0x20, 0x03, 0xf3, 0x05, 0x00, 0x2f, 0x40, 0x00, 0x01, 0x00,
+  0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04,
+  0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a,
+  0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x03,
+  0xf2, 0x10, 0x44, 0x10, 0x00, 0x00, 0x2c, 0xe5, 0x00, 0x00, 0x07, 0xfa, 0x10,
+  0x00, 0x01, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x00, 0x00, 0x00, 0x03,
+  0xec, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x90, 0x25, 0x00, 0x9c, 0x6f, 0xff, 0xff,
+  0xfd, 0x00, 0x13, 0x33, 0x33, 0x32, 0x3e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x70, 0x04, 0x40, 0x00, 0x00, 0x00, 0x05,
+  0xfb, 0x0b, 0x00, 0xf3, 0x06, 0x2d, 0xd2, 0x00, 0x00, 0x00, 0x01, 0xee, 0x20,
+  0x00, 0x00, 0x2c, 0xe5, 0x00, 0x00, 0x08, 0xfa, 0x10, 0x00, 0x00, 0x8b, 0x40,
+  0x27, 0x00, 0x9c, 0x6f, 0xff, 0xff, 0xfd, 0x00, 0x13, 0x33, 0x33, 0x32, 0x40,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04,
+  0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a,
+  0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef,
+  0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00,
+  0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00,
+  0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0,
+  0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11, 0x11,
+  0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
+  0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70, 0x04,
+  0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00, 0x11,
+  0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a, 0x70,
+  0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70, 0x00,
+  0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11, 0x1a,
+  0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef, 0x70,
+  0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1, 0x11,
+  0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee, 0xef,
+  0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04, 0xd1,
+  0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe, 0xee,
+  0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xef, 0x04, 0xee, 0xee, 0xee, 0x70, 0x04,
+  0xd1, 0x11, 0x1a, 0x70, 0x04, 0xd0, 0x00, 0x0a, 0x05, 0x00, 0x12, 0x9b, 0xfe,
+  0xee, 0xef, 0x70, 0x00, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateItalicLargeFont(tableLength, table, glyphWidth, glyphHeight, glyphDataOffset, glyphData);
@@ -0,0 +1,695 @@
+/* This file is auto-generated by the rasterizer */
+
+#include <kandinsky/font.h>
+
+static constexpr KDFont::CodePointIndexPair table[] = {
+  KDFont::CodePointIndexPair(0x20, 0),
+  KDFont::CodePointIndexPair(0xb0, 95),
+  KDFont::CodePointIndexPair(0xb7, 97),
+  KDFont::CodePointIndexPair(0xc6, 98),
+  KDFont::CodePointIndexPair(0xd0, 99),
+  KDFont::CodePointIndexPair(0xd7, 100),
+  KDFont::CodePointIndexPair(0xde, 102),
+  KDFont::CodePointIndexPair(0xe6, 104),
+  KDFont::CodePointIndexPair(0xf0, 105),
+  KDFont::CodePointIndexPair(0xf7, 106),
+  KDFont::CodePointIndexPair(0xfe, 108),
+  KDFont::CodePointIndexPair(0x192, 109),
+  KDFont::CodePointIndexPair(0x300, 110),
+  KDFont::CodePointIndexPair(0x305, 114),
+  KDFont::CodePointIndexPair(0x308, 115),
+  KDFont::CodePointIndexPair(0x30a, 116),
+  KDFont::CodePointIndexPair(0x327, 118),
+  KDFont::CodePointIndexPair(0x391, 119),
+  KDFont::CodePointIndexPair(0x3a3, 136),
+  KDFont::CodePointIndexPair(0x3b1, 143),
+  KDFont::CodePointIndexPair(0x3c3, 160),
+  KDFont::CodePointIndexPair(0x454, 167),
+  KDFont::CodePointIndexPair(0x1d07, 168),
+  KDFont::CodePointIndexPair(0x2026, 169),
+  KDFont::CodePointIndexPair(0x212f, 170),
+  KDFont::CodePointIndexPair(0x2190, 171),
+  KDFont::CodePointIndexPair(0x21d0, 181),
+  KDFont::CodePointIndexPair(0x2200, 185),
+  KDFont::CodePointIndexPair(0x2202, 186),
+  KDFont::CodePointIndexPair(0x2208, 189),
+  KDFont::CodePointIndexPair(0x2211, 191),
+  KDFont::CodePointIndexPair(0x221a, 192),
+  KDFont::CodePointIndexPair(0x221e, 193),
+  KDFont::CodePointIndexPair(0x2229, 194),
+  KDFont::CodePointIndexPair(0x2248, 197),
+  KDFont::CodePointIndexPair(0x2260, 198),
+  KDFont::CodePointIndexPair(0x2264, 200),
+  KDFont::CodePointIndexPair(0x2282, 202),
+  KDFont::CodePointIndexPair(0x2284, 203),
+  KDFont::CodePointIndexPair(0x22c2, 204),
+  KDFont::CodePointIndexPair(0x2505, 206),
+  KDFont::CodePointIndexPair(0x27e6, 207),
+  KDFont::CodePointIndexPair(0xfffd, 209),
+  KDFont::CodePointIndexPair(0x1d422, 210),
+};
+
+static constexpr size_t tableLength = 44;
+
+static constexpr KDCoordinate glyphWidth = 7;
+
+static constexpr KDCoordinate glyphHeight = 14;
+
+static constexpr uint16_t glyphDataOffset[212] = {
+  0x0000, 0x000b, 0x0035, 0x0056, 0x007f, 0x00b2, 0x00dd, 0x010a, 0x0129,
+  0x0156, 0x0183, 0x01a5, 0x01c6, 0x01e1, 0x01f6, 0x0209, 0x023a, 0x0264,
+  0x0285, 0x02b0, 0x02db, 0x0305, 0x0330, 0x035a, 0x0384, 0x03af, 0x03d9,
+  0x03ed, 0x040f, 0x0434, 0x044c, 0x0472, 0x049d, 0x04cc, 0x04f6, 0x0521,
+  0x054e, 0x0579, 0x05a0, 0x05c5, 0x05f2, 0x0616, 0x0634, 0x0656, 0x0681,
+  0x069b, 0x06c6, 0x06f1, 0x071e, 0x0747, 0x0779, 0x07a4, 0x07d1, 0x07ee,
+  0x0811, 0x083b, 0x0866, 0x0891, 0x08bb, 0x08e6, 0x0903, 0x0934, 0x0950,
+  0x0973, 0x0987, 0x099c, 0x09c1, 0x09ef, 0x0a14, 0x0a40, 0x0a65, 0x0a8c,
+  0x0ab7, 0x0ae4, 0x0b07, 0x0b2d, 0x0b5a, 0x0b7e, 0x0ba1, 0x0bc5, 0x0bea,
+  0x0c15, 0x0c40, 0x0c62, 0x0c87, 0x0cb0, 0x0cd3, 0x0cf5, 0x0d18, 0x0d3b,
+  0x0d64, 0x0d87, 0x0db1, 0x0dc5, 0x0df3, 0x0e08, 0x0e23, 0x0e48, 0x0e5d,
+  0x0e68, 0x0e93, 0x0eb6, 0x0ee3, 0x0f0c, 0x0f3a, 0x0f60, 0x0f8e, 0x0fb0,
+  0x0fd5, 0x1006, 0x1034, 0x1049, 0x105e, 0x1073, 0x1088, 0x1099, 0x10ae,
+  0x10c3, 0x10d8, 0x10ef, 0x1119, 0x1144, 0x1161, 0x118b, 0x11b2, 0x11dd,
+  0x1201, 0x122e, 0x124c, 0x1277, 0x12a1, 0x12cc, 0x12f7, 0x1319, 0x1346,
+  0x1364, 0x138d, 0x13b8, 0x13d5, 0x13ff, 0x142f, 0x145a, 0x1484, 0x14b1,
+  0x14d6, 0x1509, 0x1532, 0x1560, 0x1585, 0x15b8, 0x15e3, 0x1611, 0x162c,
+  0x164f, 0x167d, 0x16a3, 0x16c5, 0x16f8, 0x171d, 0x1740, 0x176b, 0x178e,
+  0x17b1, 0x17d4, 0x1803, 0x182c, 0x1859, 0x187c, 0x18a1, 0x18c3, 0x18d8,
+  0x18fd, 0x1921, 0x1948, 0x196a, 0x198e, 0x1999, 0x19c1, 0x19e4, 0x1a05,
+  0x1a28, 0x1a4b, 0x1a6f, 0x1a9a, 0x1abe, 0x1ae3, 0x1b0d, 0x1b39, 0x1b60,
+  0x1b8e, 0x1bb4, 0x1bde, 0x1c0e, 0x1c41, 0x1c5e, 0x1c81, 0x1ca0, 0x1cce,
+  0x1ce6, 0x1d0a, 0x1d2c, 0x1d4f, 0x1d73, 0x1d93, 0x1db7, 0x1dda, 0x1dfd,
+  0x1e15, 0x1e32, 0x1e4e, 0x1e7c, 0x1ea7
+};
+
+/* Rasterized  = 20678 bytes (211 glyphs x 98 pixels)
+ * Downsampled = 10339 bytes (1/2 of rasterized)
+ * Compressed  =  7847 bytes (37.95% of rasterized) */
+static constexpr uint8_t glyphData[7847] = {
+  0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0xf1, 0x04, 0x20, 0x00, 0x00, 0x0d, 0x10, 0x00, 0x00, 0xd0, 0x00,
+  0x00, 0x0d, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x65,
+  0x1b, 0x30, 0x00, 0x01, 0xe4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x25, 0x04, 0x30, 0x06, 0xd0, 0xa9,
+  0x00, 0x5c, 0x09, 0x80, 0x03, 0xa0, 0x76, 0x00, 0x15, 0x03, 0x30, 0x00, 0x01,
+  0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf5,
+  0x0c, 0x63, 0x27, 0x00, 0x08, 0x14, 0x50, 0x08, 0xfb, 0xfe, 0x20, 0x0a, 0x08,
+  0x10, 0x04, 0xe4, 0xe4, 0x00, 0x6f, 0x6f, 0x60, 0x02, 0x80, 0xa0, 0x00, 0x35,
+  0x08, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x4f, 0x71, 0x00, 0x5b, 0x47, 0x90,
+  0x09, 0x70, 0x00, 0x00, 0x1c, 0xb5, 0x00, 0x00, 0x04, 0xba, 0x00, 0x00, 0x00,
+  0xe1, 0x0b, 0xa6, 0x8c, 0x00, 0x04, 0xf5, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x2a, 0xa2, 0x00, 0x59, 0x22, 0x90, 0xa4, 0x92, 0x28, 0x65, 0x02,
+  0xaa, 0x20, 0x00, 0x00, 0x10, 0xaa, 0x40, 0x48, 0x55, 0x0b, 0x4a, 0x05, 0x50,
+  0xb2, 0x00, 0x0a, 0xa4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0xf4, 0x10, 0x10, 0x00, 0x02, 0xcb, 0x60, 0x00, 0x75,
+  0x2a, 0x00, 0x06, 0x7a, 0x40, 0x00, 0x3f, 0x50, 0x04, 0x1d, 0xa9, 0x06, 0x86,
+  0x80, 0xa8, 0xc1, 0x5b, 0x00, 0xff, 0x10, 0x9d, 0xd7, 0x6a, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xff, 0x01, 0x61,
+  0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x01, 0x00, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0xf2, 0x03, 0x04, 0x60, 0x00, 0x02, 0xc0, 0x00, 0x00, 0xc2, 0x00,
+  0x00, 0x2b, 0x00, 0x00, 0x06, 0x70, 0x00, 0x00, 0x76, 0x07, 0x00, 0x21, 0x3b,
+  0x00, 0x15, 0x00, 0xd0, 0x03, 0xc0, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00,
+  0x00, 0xa5, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x49,
+  0x00, 0x00, 0x03, 0xa0, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x42, 0xd1, 0x00, 0x00,
+  0x96, 0x23, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+  0x00, 0xf8, 0x05, 0x80, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x8b, 0xea, 0x90, 0x00,
+  0x4e, 0x80, 0x00, 0x0b, 0x1b, 0x20, 0x01, 0x20, 0x12, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf9, 0x04, 0xa0, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x77, 0xe7, 0x71, 0x04, 0x4d, 0x44, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x09, 0xf0, 0x05, 0x2f, 0x70, 0x00, 0x01, 0xed, 0x00, 0x00,
+  0x04, 0x90, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x01, 0x00, 0x8e, 0x77, 0x77, 0x71, 0x04, 0x44, 0x44, 0x00, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x09,
+  0x56, 0x3f, 0x60, 0x00, 0x03, 0xf5, 0x0f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x00, 0x01, 0x00, 0xf0, 0x1c, 0x90, 0x00, 0x00, 0x59, 0x00, 0x00,
+  0x0b, 0x30, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x77, 0x00, 0x00, 0x0c, 0x10, 0x00,
+  0x03, 0xb0, 0x00, 0x00, 0x95, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x05, 0x80, 0x00,
+  0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf4, 0x0d, 0xac, 0xb2, 0x00, 0x96, 0x03, 0xc0, 0x0e, 0x00, 0x0c,
+  0x21, 0xc0, 0xc2, 0x94, 0x1c, 0x09, 0x19, 0x40, 0xe0, 0x00, 0xc2, 0x0a, 0x60,
+  0x3d, 0x00, 0x1b, 0xcc, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xd8, 0x01, 0x6b, 0x40, 0x00, 0x26, 0xc5, 0x00,
+  0x00, 0x0a, 0x50, 0x00, 0x00, 0xa5, 0x07, 0x00, 0x44, 0xad, 0xdd, 0xd4, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4,
+  0x0e, 0x04, 0xcd, 0xb1, 0x00, 0x81, 0x06, 0xa0, 0x00, 0x00, 0x2c, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x04, 0xc0, 0x00, 0x03, 0xc1, 0x00, 0x04, 0xc1, 0x00, 0x01,
+  0xdd, 0xdd, 0xd3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf4, 0x0e, 0x05, 0xcc, 0xb2, 0x00, 0x61, 0x04, 0xd0, 0x00,
+  0x00, 0x3d, 0x00, 0x04, 0x9b, 0x20, 0x00, 0x25, 0xa8, 0x00, 0x00, 0x00, 0xd2,
+  0x17, 0x00, 0x2f, 0x10, 0x7c, 0xdc, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x01, 0xb4, 0x00, 0x00,
+  0xbc, 0x50, 0x00, 0x88, 0x95, 0x00, 0x4b, 0x09, 0x50, 0x2d, 0x10, 0xa6, 0x06,
+  0xcc, 0xcf, 0xf6, 0x00, 0x00, 0x95, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x06,
+  0xcc, 0xcb, 0x00, 0x86, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0xac, 0xbc, 0x50,
+  0x01, 0x00, 0x2e, 0x10, 0x00, 0x00, 0xc3, 0x16, 0x00, 0x3e, 0x00, 0x8d, 0xdc,
+  0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0xf4, 0x0d, 0x6c, 0xc9, 0x00, 0x6b, 0x00, 0x40, 0x0d, 0x20, 0x00, 0x00,
+  0xe4, 0xbc, 0x50, 0x0f, 0x60, 0x1d, 0x30, 0xe0, 0x00, 0x96, 0x08, 0x70, 0x0d,
+  0x20, 0x09, 0xcd, 0x50, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x1c, 0xcc, 0xcc, 0x40, 0x00, 0x02, 0xb0,
+  0x00, 0x00, 0xb2, 0x00, 0x00, 0x49, 0x00, 0x00, 0x0b, 0x30, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0x2d, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x01, 0xab, 0xb3, 0x00,
+  0x96, 0x01, 0xd0, 0x09, 0x50, 0x0d, 0x00, 0x1d, 0x99, 0x50, 0x07, 0x74, 0xb9,
+  0x01, 0xc0, 0x00, 0xb4, 0x1e, 0x10, 0x0c, 0x40, 0x4c, 0xcc, 0x70, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d,
+  0x03, 0xcc, 0xa1, 0x00, 0xe2, 0x05, 0xb0, 0x2c, 0x00, 0x0c, 0x10, 0xe2, 0x03,
+  0xf3, 0x04, 0xbb, 0x7b, 0x30, 0x00, 0x00, 0xe1, 0x03, 0x00, 0x7a, 0x00, 0x8c,
+  0xda, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0x5f, 0x3f, 0x60, 0x00, 0x03, 0xf5, 0x0e, 0x00, 0x04, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x55, 0x3f, 0x60, 0x00, 0x03,
+  0xf5, 0x0e, 0x00, 0xf0, 0x05, 0x2f, 0x70, 0x00, 0x01, 0xed, 0x00, 0x00, 0x04,
+  0x90, 0x00, 0x03, 0xc1, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x01, 0x00, 0xf8, 0x08, 0x03, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x3c, 0x50,
+  0x00, 0x6b, 0x10, 0x00, 0x03, 0xc4, 0x00, 0x00, 0x01, 0xa9, 0x10, 0x00, 0x00,
+  0x5c, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0x73, 0x07, 0x77, 0x77, 0x10, 0x44, 0x44, 0x40, 0x07, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf9,
+  0x09, 0x03, 0x00, 0x00, 0x00, 0x7b, 0x10, 0x00, 0x00, 0x3c, 0x50, 0x00, 0x00,
+  0x09, 0x90, 0x00, 0x03, 0xc6, 0x00, 0x07, 0xc2, 0x00, 0x09, 0x70, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x41, 0x00, 0x05, 0xc8, 0xd5, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0xa6,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0x0d, 0x00, 0x01, 0x00, 0x65, 0x2b, 0x20, 0x00,
+  0x03, 0xe2, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf0, 0x1a, 0x4a, 0xa5, 0x00, 0x69, 0x00, 0xa3, 0x0c, 0x00, 0x03,
+  0x74, 0x80, 0x28, 0xb8, 0x66, 0x2c, 0x23, 0x85, 0x63, 0x90, 0x78, 0x38, 0x08,
+  0xa4, 0x50, 0xc0, 0x00, 0x00, 0x04, 0xb3, 0x26, 0x00, 0x02, 0x78, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x2f,
+  0x50, 0x00, 0x07, 0x8a, 0x00, 0x00, 0xc1, 0xd0, 0x00, 0x2c, 0x09, 0x50, 0x08,
+  0xc5, 0xac, 0x00, 0xe9, 0x77, 0xf0, 0x2d, 0x00, 0x0a, 0x56, 0x70, 0x00, 0x59,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x0d, 0xdd, 0xd6, 0x00, 0xd3, 0x01, 0xf1, 0x0d, 0x30, 0x1e, 0x00,
+  0xdc, 0xbe, 0x50, 0x0d, 0x42, 0x4c, 0x30, 0xd3, 0x00, 0x78, 0x0d, 0x30, 0x2c,
+  0x50, 0xbd, 0xdb, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0xf4, 0x10, 0x01, 0x00, 0x00, 0x9d, 0xcd, 0x20, 0x99,
+  0x00, 0x20, 0x0f, 0x10, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0x07, 0xb1, 0x04, 0x40, 0x07, 0xee, 0xb1, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f,
+  0xcd, 0xb3, 0x00, 0xf0, 0x04, 0xe1, 0x0f, 0x00, 0x09, 0x70, 0xf0, 0x00, 0x69,
+  0x0f, 0x00, 0x07, 0x90, 0xf0, 0x00, 0xb6, 0x0f, 0x00, 0x7d, 0x00, 0xdd, 0xc9,
+  0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf3, 0x03, 0x0a, 0xed, 0xdd, 0x30, 0xa6, 0x00, 0x00, 0x0a, 0x60, 0x00,
+  0x00, 0xad, 0xbb, 0x70, 0x0a, 0x72, 0x21, 0x00, 0x0e, 0x00, 0x44, 0x8d, 0xdd,
+  0xd4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf3, 0x03, 0x06, 0xed, 0xdd, 0x50, 0x69, 0x00, 0x00, 0x06, 0x90, 0x00,
+  0x00, 0x6c, 0x88, 0x60, 0x06, 0xb5, 0x54, 0x00, 0x0e, 0x00, 0x26, 0x58, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf4,
+  0x10, 0x11, 0x00, 0x01, 0xbd, 0xcc, 0x10, 0xc7, 0x00, 0x30, 0x2e, 0x00, 0x00,
+  0x05, 0xb0, 0x03, 0x31, 0x4b, 0x00, 0x9d, 0x62, 0xe0, 0x00, 0x86, 0x0a, 0x90,
+  0x0a, 0x60, 0x09, 0xee, 0xa1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0x70, 0x0f, 0x00, 0x0c, 0x40, 0xf0, 0x00, 0xc4,
+  0x07, 0x00, 0x64, 0xfb, 0xbb, 0xe4, 0x0f, 0x22, 0x2c, 0x0e, 0x00, 0x44, 0xd0,
+  0x00, 0xa3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xab, 0x0b, 0xdf, 0xdd, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x0e, 0x10,
+  0x07, 0x00, 0x44, 0xbd, 0xdd, 0xd0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xa7, 0x04, 0xdd, 0xde, 0x00, 0x00, 0x01,
+  0xe0, 0x00, 0x00, 0x1e, 0x07, 0x00, 0x84, 0x09, 0x20, 0x7a, 0x00, 0x4d, 0xec,
+  0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf4, 0x0e, 0x0d, 0x30, 0x0d, 0x40, 0xd3, 0x0b, 0x60, 0x0d, 0x39, 0x90,
+  0x00, 0xd9, 0xf7, 0x00, 0x0d, 0xd2, 0xe1, 0x00, 0xd3, 0x07, 0x90, 0x0d, 0x30,
+  0x0e, 0x30, 0xb2, 0x00, 0x59, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0x5f, 0x06, 0x90, 0x00, 0x00, 0x69, 0x07, 0x00,
+  0x01, 0x44, 0x5d, 0xdd, 0xd6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x2f, 0x40, 0x1f, 0x52, 0xe9, 0x06,
+  0xe5, 0x2b, 0xd0, 0xba, 0x52, 0xc9, 0x4b, 0x95, 0x2c, 0x3d, 0x6a, 0x52, 0xc0,
+  0xb1, 0xa5, 0x2c, 0x00, 0x0a, 0x51, 0xa0, 0x00, 0x84, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0x50,
+  0x0c, 0x30, 0xed, 0x00, 0xc3, 0x0e, 0x95, 0x0c, 0x30, 0xe2, 0xd0, 0xc3, 0x0f,
+  0x09, 0x6b, 0x30, 0xf0, 0x1d, 0xb3, 0x0f, 0x00, 0x9e, 0x30, 0xc0, 0x01, 0xd3,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0xf4, 0x10, 0x10, 0x00, 0x03, 0xdc, 0xe5, 0x00, 0xe3, 0x01, 0xe2, 0x4c, 0x00,
+  0x09, 0x76, 0xa0, 0x00, 0x69, 0x6a, 0x00, 0x07, 0x93, 0xd0, 0x00, 0xa6, 0x0c,
+  0x60, 0x3e, 0x10, 0x1b, 0xec, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf6, 0x0c, 0x0c, 0xdc, 0xc9, 0x00, 0xc3,
+  0x00, 0xb5, 0x0c, 0x30, 0x08, 0x70, 0xc4, 0x14, 0xd3, 0x0c, 0xcb, 0xa3, 0x00,
+  0xc3, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xa3, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x10, 0x00, 0x03,
+  0xdc, 0xe5, 0x00, 0xe3, 0x01, 0xe2, 0x4c, 0x00, 0x09, 0x76, 0xa0, 0x00, 0x69,
+  0x6a, 0x00, 0x07, 0x93, 0xd0, 0x00, 0xa6, 0x0c, 0x50, 0x3e, 0x10, 0x1b, 0xfd,
+  0x30, 0x00, 0x09, 0xa1, 0x00, 0x00, 0x08, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0c, 0xdc, 0xc8, 0x00, 0xc3,
+  0x00, 0xc4, 0x0c, 0x30, 0x0a, 0x50, 0xc6, 0x48, 0xe1, 0x0c, 0xae, 0xf1, 0x00,
+  0xc3, 0x0d, 0x40, 0x0c, 0x30, 0x4d, 0x00, 0xa2, 0x00, 0xa5, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf4, 0x10, 0x21,
+  0x00, 0x02, 0xdc, 0xda, 0x00, 0xb5, 0x00, 0x30, 0x0b, 0x80, 0x00, 0x00, 0x1b,
+  0xd6, 0x00, 0x00, 0x03, 0xbd, 0x10, 0x00, 0x00, 0xb5, 0x0a, 0x20, 0x0c, 0x40,
+  0x5d, 0xed, 0x70, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xbb, 0x6d, 0xdf, 0xdd, 0x90, 0x00, 0xe1, 0x00, 0x00, 0x0e,
+  0x10, 0x00, 0x07, 0x00, 0x25, 0xc1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x76, 0x0f, 0x00, 0x0b, 0x40, 0xf0, 0x00,
+  0xb4, 0x07, 0x00, 0xc4, 0x30, 0xf0, 0x00, 0xc2, 0x0b, 0x60, 0x3e, 0x00, 0x2c,
+  0xed, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf5, 0x0d, 0x5b, 0x00, 0x07, 0x80, 0xe0, 0x00, 0xc3, 0x0a, 0x50,
+  0x1e, 0x00, 0x59, 0x06, 0x90, 0x01, 0xe0, 0xa4, 0x00, 0x0b, 0x3d, 0x00, 0x00,
+  0x6c, 0x90, 0x00, 0x01, 0xd4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0xc4, 0x00, 0x00, 0xfa, 0x60, 0x00,
+  0x2d, 0x78, 0x0f, 0x44, 0xb5, 0xa3, 0xe8, 0x68, 0x3c, 0x77, 0xc8, 0x60, 0xeb,
+  0x1d, 0xa4, 0x0d, 0xc0, 0xae, 0x10, 0xa8, 0x05, 0xd0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0d, 0x30,
+  0x0d, 0x20, 0x5b, 0x07, 0x80, 0x00, 0xb5, 0xd0, 0x00, 0x03, 0xf6, 0x00, 0x00,
+  0x6d, 0x90, 0x00, 0x1d, 0x1d, 0x20, 0x09, 0x70, 0x4c, 0x01, 0xc0, 0x00, 0xa4,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf5, 0x0d, 0x4c, 0x00, 0x08, 0x70, 0xc4, 0x01, 0xd0, 0x03, 0xc0, 0x86, 0x00,
+  0x0b, 0x5d, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x0e, 0x10,
+  0x00, 0x00, 0xc1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0a, 0xdd, 0xdf, 0x50, 0x00, 0x04, 0xc0, 0x00,
+  0x01, 0xd2, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x1d, 0x10, 0x00,
+  0x0b, 0x50, 0x00, 0x02, 0xdd, 0xdd, 0xd6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x03, 0x99, 0x90, 0x00, 0x47,
+  0x00, 0x00, 0x04, 0x70, 0x00, 0x07, 0x00, 0x06, 0xa0, 0x03, 0xa9, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x72,
+  0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00,
+  0x03, 0xa0, 0x0b, 0x00, 0xf0, 0x08, 0x76, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00,
+  0x0b, 0x20, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x79, 0x95, 0x00, 0x00, 0x04,
+  0x80, 0x00, 0x00, 0x48, 0x07, 0x00, 0x07, 0xa0, 0x79, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xfe, 0x06, 0x20, 0x00,
+  0x00, 0x1f, 0x40, 0x00, 0x08, 0x6b, 0x00, 0x00, 0xc0, 0xb1, 0x00, 0x48, 0x05,
+  0x70, 0x04, 0x20, 0x05, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0f, 0xe0, 0x15, 0x55, 0x55, 0x22, 0x88, 0x88,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x30, 0x00, 0x00,
+  0x0a, 0x70, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf5, 0x08, 0x10, 0x00, 0x05, 0xcb,
+  0xe6, 0x00, 0x20, 0x01, 0xe1, 0x00, 0x59, 0xae, 0x20, 0xa7, 0x10, 0xc3, 0x0f,
+  0x10, 0x3e, 0x30, 0x6d, 0xc8, 0x92, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x0e, 0x10, 0x00,
+  0x00, 0xe1, 0x01, 0x00, 0x0e, 0x9c, 0xd9, 0x00, 0xe5, 0x00, 0xd4, 0x0e, 0x10,
+  0x09, 0x70, 0xe1, 0x00, 0xa6, 0x0e, 0x40, 0x2e, 0x10, 0xb8, 0xcd, 0x50, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf5,
+  0x08, 0x01, 0x00, 0x01, 0xad, 0xcc, 0x10, 0xb8, 0x00, 0x20, 0x0f, 0x00, 0x00,
+  0x00, 0xf1, 0x00, 0x00, 0x0a, 0x90, 0x03, 0x10, 0x09, 0xdd, 0xa1, 0x20, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf4, 0x0f, 0x90,
+  0x00, 0x00, 0x0e, 0x10, 0x00, 0x10, 0xe1, 0x04, 0xdb, 0xbe, 0x10, 0xe3, 0x01,
+  0xf1, 0x3d, 0x00, 0x0e, 0x13, 0xc0, 0x00, 0xe1, 0x0e, 0x30, 0x3f, 0x10, 0x4d,
+  0xd9, 0xb1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xf5, 0x08, 0x10, 0x00, 0x02, 0xcb, 0xc8, 0x00, 0xd4, 0x00, 0xb3,
+  0x2f, 0x88, 0x8c, 0x61, 0xf3, 0x33, 0x31, 0x0c, 0x70, 0x02, 0x00, 0x1a, 0xdc,
+  0xa0, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0xf4, 0x05, 0x3b, 0xc8, 0x00, 0x0d, 0x30, 0x10, 0x01, 0xe0, 0x00, 0x09, 0xef,
+  0xcc, 0x40, 0x01, 0xe0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x07, 0x00, 0x25, 0xc0,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xf0, 0x16, 0x10, 0x00, 0x02, 0xca, 0xed, 0x90, 0xb4, 0x04, 0x90, 0x0a, 0x40,
+  0x5a, 0x00, 0x4d, 0xbb, 0x10, 0x0b, 0x20, 0x00, 0x00, 0x6e, 0xdd, 0xc4, 0x0c,
+  0x00, 0x04, 0xb0, 0xd5, 0x34, 0xc5, 0x01, 0x68, 0x72, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00,
+  0xe1, 0x01, 0x00, 0x0e, 0x6c, 0xda, 0x00, 0xe7, 0x00, 0xd2, 0x0e, 0x10, 0x0b,
+  0x40, 0xe1, 0x00, 0xb4, 0x07, 0x00, 0x44, 0xc1, 0x00, 0x93, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x50, 0x48, 0x00,
+  0x00, 0x05, 0x90, 0x09, 0x00, 0x96, 0x0b, 0xcd, 0xc0, 0x00, 0x00, 0x3c, 0x00,
+  0x00, 0x03, 0x07, 0x00, 0x25, 0x2a, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x50, 0x48, 0x00, 0x00, 0x05, 0x90, 0x09,
+  0x00, 0x99, 0x0b, 0xcd, 0xc0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x03, 0x07, 0x00,
+  0xd0, 0x04, 0xb0, 0x01, 0x75, 0xc5, 0x00, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x00,
+  0xb4, 0x07, 0x00, 0xf4, 0x05, 0x2c, 0x20, 0xb4, 0x2c, 0x20, 0x0b, 0x6f, 0x80,
+  0x00, 0xbe, 0x3d, 0x20, 0x0b, 0x40, 0x3d, 0x00, 0xa3, 0x00, 0x77, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xbb, 0xa0, 0x00, 0x01, 0x2f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x07,
+  0x00, 0x74, 0x0e, 0x10, 0x00, 0x00, 0x6d, 0xc3, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf0, 0x00, 0x10, 0x4b, 0xcc,
+  0x9e, 0x64, 0xc0, 0xd4, 0x5a, 0x4b, 0x0c, 0x24, 0xb4, 0xb0, 0xc2, 0x4b, 0x07,
+  0x00, 0x35, 0x90, 0xa2, 0x39, 0x1f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0xf0, 0x01, 0x01, 0x00, 0x0d, 0x5c, 0xda, 0x00, 0xe7,
+  0x00, 0xd2, 0x0e, 0x10, 0x0b, 0x40, 0xe1, 0x00, 0xb4, 0x07, 0x00, 0x35, 0xc1,
+  0x00, 0x93, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+  0x00, 0xf5, 0x08, 0x10, 0x00, 0x03, 0xdb, 0xd6, 0x00, 0xe3, 0x01, 0xe2, 0x3d,
+  0x00, 0x0a, 0x63, 0xd0, 0x00, 0xa6, 0x0d, 0x40, 0x2e, 0x10, 0x2c, 0xdc, 0x40,
+  0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf0,
+  0x16, 0x01, 0x00, 0x0d, 0x8c, 0xd9, 0x00, 0xe5, 0x00, 0xd4, 0x0e, 0x10, 0x09,
+  0x70, 0xe1, 0x00, 0xa6, 0x0e, 0x40, 0x2e, 0x10, 0xe9, 0xcd, 0x40, 0x0e, 0x10,
+  0x00, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xf0, 0x16, 0x10, 0x00, 0x04, 0xdb, 0xbd, 0x10, 0xe3, 0x01,
+  0xf1, 0x3d, 0x00, 0x0e, 0x13, 0xc0, 0x00, 0xe1, 0x0e, 0x30, 0x3f, 0x10, 0x4d,
+  0xd8, 0xe1, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf7, 0x05, 0x10, 0x03, 0x97, 0xdc,
+  0x40, 0x4e, 0x70, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x04, 0xb0,
+  0x00, 0x00, 0x3a, 0x1f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xf5, 0x08, 0x10, 0x00, 0x04, 0xda, 0xc8, 0x00, 0xb4, 0x00, 0x10,
+  0x04, 0xda, 0x61, 0x00, 0x00, 0x38, 0xe1, 0x05, 0x00, 0x0c, 0x30, 0x6c, 0xcc,
+  0x80, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xf0, 0x02, 0x56, 0x00, 0x00, 0x07, 0x70, 0x00, 0x2c, 0xee, 0xcc, 0x40, 0x08,
+  0x70, 0x00, 0x00, 0x87, 0x00, 0x00, 0x07, 0x00, 0x74, 0x6a, 0x00, 0x00, 0x00,
+  0xbd, 0xc5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x1e, 0x00, 0x0e, 0x01, 0xe0, 0x00, 0xe1, 0x1e, 0x00,
+  0x0e, 0x11, 0xe0, 0x00, 0xe1, 0x0f, 0x20, 0x6f, 0x10, 0x6e, 0xd5, 0xa0, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf6, 0x05,
+  0x2c, 0x00, 0x08, 0x60, 0xc3, 0x00, 0xd0, 0x05, 0x90, 0x59, 0x00, 0x0d, 0x0c,
+  0x20, 0x00, 0x88, 0xb0, 0x00, 0x01, 0xd4, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0xc2, 0x09, 0x10, 0xd9, 0x62,
+  0xe6, 0x1c, 0x59, 0x59, 0x95, 0x92, 0xc9, 0x3d, 0x85, 0x0e, 0xc0, 0xcc, 0x20,
+  0x9a, 0x07, 0xd0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x0a, 0x50, 0x2c, 0x00, 0x1d, 0x2c, 0x30, 0x00, 0x4e,
+  0x70, 0x00, 0x08, 0xca, 0x00, 0x03, 0xc0, 0xb6, 0x00, 0xb2, 0x01, 0xb1, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14,
+  0x2c, 0x00, 0x08, 0x60, 0xb3, 0x00, 0xd0, 0x04, 0xa0, 0x49, 0x00, 0x0c, 0x2a,
+  0x30, 0x00, 0x59, 0xc0, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x7c,
+  0x50, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf5, 0x06, 0x08, 0xcc, 0xdf, 0x20, 0x00, 0x0b, 0x60, 0x00, 0x0a, 0x80, 0x00,
+  0x08, 0xa0, 0x00, 0x06, 0xb0, 0x00, 0x01, 0xdd, 0xdd, 0xd4, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xc0, 0x28, 0x90, 0x00,
+  0x0c, 0x10, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x55, 0x05,
+  0xd7, 0x00, 0x00, 0x01, 0x0e, 0x00, 0xe0, 0x00, 0x0d, 0x10, 0x00, 0x00, 0x39,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0xd0, 0x00, 0x00, 0x0d, 0x07, 0x00, 0x0f, 0x60, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf1, 0x09, 0x00, 0x00, 0x00, 0x00, 0x79, 0x40, 0x00, 0x00, 0x0d,
+  0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00,
+  0x04, 0xe8, 0x07, 0x00, 0x11, 0x0b, 0x15, 0x00, 0x00, 0x1c, 0x00, 0xa0, 0x79,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00,
+  0x8e, 0x7c, 0x90, 0x91, 0x08, 0x04, 0xb6, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xdf, 0x41, 0x00, 0x00, 0x94,
+  0xa0, 0x00, 0x0a, 0x09, 0x00, 0x00, 0x38, 0x50, 0x00, 0x01, 0x00, 0x07, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf5, 0x08, 0xa0, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x88, 0xe8, 0x81, 0x03, 0x3d, 0x33, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0xbc, 0xcc, 0xc2, 0x20, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x8e, 0x03, 0xf6, 0x00, 0x00, 0x3f,
+  0x50, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x0f, 0xcd, 0xb3, 0x00, 0xf0, 0x04, 0xe1, 0x0f, 0x00, 0x09, 0x78,
+  0xfa, 0x80, 0x79, 0x1f, 0x21, 0x07, 0x90, 0xf0, 0x00, 0xb6, 0x0f, 0x00, 0x7d,
+  0x00, 0xdd, 0xc9, 0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x01, 0x00, 0xf8, 0x06, 0x30, 0x00, 0x40, 0x05, 0xb0, 0x87, 0x00,
+  0x05, 0xd8, 0x00, 0x00, 0x8b, 0xa0, 0x00, 0x78, 0x05, 0xa0, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0xf4, 0x10, 0x10, 0x02, 0x03, 0xdc, 0xee, 0x60, 0xe3, 0x06, 0xf2, 0x4c, 0x00,
+  0xca, 0x76, 0xa0, 0x95, 0x69, 0x6a, 0x4a, 0x07, 0x93, 0xec, 0x10, 0xa6, 0x0f,
+  0xa0, 0x3e, 0x14, 0xbb, 0xec, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf6, 0x0c, 0x0c, 0x30, 0x00, 0x00, 0xcc,
+  0xb9, 0x40, 0x0c, 0x52, 0x4d, 0x40, 0xc3, 0x00, 0x88, 0x0c, 0x30, 0x0b, 0x60,
+  0xcd, 0xcd, 0x90, 0x0c, 0x40, 0x00, 0x00, 0xa3, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xc8, 0x00,
+  0x0b, 0x70, 0xb5, 0x00, 0xe1, 0x0a, 0x40, 0x0f, 0x03, 0xb0, 0x00, 0xf0, 0x87,
+  0x00, 0x0f, 0x02, 0xd8, 0x00, 0xf0, 0x00, 0x98, 0x0f, 0x01, 0x04, 0xa0, 0xc0,
+  0x9c, 0xc3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xf5, 0x09, 0x01, 0x00, 0x10, 0x5c, 0xd6, 0xbc, 0x70, 0x00, 0xf4,
+  0x0c, 0x05, 0x9f, 0x88, 0xe8, 0x80, 0xd4, 0x33, 0xc3, 0x0f, 0x60, 0x05, 0xeb,
+  0x3b, 0xca, 0x21, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x41, 0x80, 0x00, 0x2f, 0xf3, 0x00, 0x0a, 0x39, 0x70,
+  0x00, 0x57, 0x4d, 0x00, 0xba, 0x58, 0xe4, 0x2c, 0x00, 0x09, 0x63, 0xb0, 0x00,
+  0xa5, 0x0d, 0x30, 0x2e, 0x10, 0x3c, 0xdc, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf8, 0x05, 0xc1, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x77, 0x77, 0x71, 0x04, 0x44, 0x44, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xf5, 0x08, 0x10, 0x10, 0x03, 0xdb, 0xdf, 0x20, 0xe3, 0x0c,
+  0xf2, 0x3d, 0x08, 0x7a, 0x63, 0xd5, 0x90, 0xa6, 0x0f, 0xf0, 0x2e, 0x11, 0xed,
+  0xcc, 0x40, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0xe1, 0x01, 0x00,
+  0x0e, 0x9c, 0xd9, 0x00, 0xe5, 0x00, 0xd4, 0x0e, 0x10, 0x09, 0x70, 0xe1, 0x00,
+  0xa6, 0x0e, 0x40, 0x2e, 0x10, 0xe9, 0xcd, 0x40, 0x1c, 0x00, 0x90, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf2, 0x10,
+  0x20, 0x00, 0x02, 0xeb, 0x40, 0x00, 0x96, 0x00, 0x00, 0x0d, 0x20, 0x00, 0x2b,
+  0xfb, 0x90, 0x00, 0x0e, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x00, 0x4a, 0x00, 0x00,
+  0x08, 0x70, 0x00, 0x4d, 0xc0, 0x25, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0x00, 0x30, 0x00, 0x00, 0x0a, 0x70, 0x00, 0x00, 0x0a, 0x20, 0x00,
+  0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x30,
+  0x00, 0x00, 0x4d, 0x00, 0x00, 0x0b, 0x10, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe8, 0x00, 0x01,
+  0xa0, 0x83, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x60, 0x60, 0x05, 0x46, 0xc4, 0x00, 0x01, 0x00,
+  0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x3f, 0xaa,
+  0xa2, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x05, 0x10, 0x01, 0xa0, 0x93, 0x00, 0x01, 0x00, 0x0e,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x03, 0x00, 0x00, 0x09, 0x4a,
+  0x00, 0x00, 0x78, 0x90, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0x00, 0x01, 0x01, 0x00, 0x00, 0xc3, 0xa0, 0x00, 0x64, 0x91, 0x00,
+  0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x0d, 0xf0, 0x01, 0x20, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x2f,
+  0x50, 0x00, 0x07, 0x8a, 0x00, 0x00, 0xc1, 0xd0, 0x00, 0x2c, 0x09, 0x50, 0x08,
+  0xc5, 0xac, 0x00, 0xe9, 0x77, 0xf0, 0x2d, 0x00, 0x0a, 0x56, 0x70, 0x00, 0x59,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x0d, 0xdd, 0xd6, 0x00, 0xd3, 0x01, 0xf1, 0x0d, 0x30, 0x1e, 0x00,
+  0xdc, 0xbe, 0x50, 0x0d, 0x42, 0x4c, 0x30, 0xd3, 0x00, 0x78, 0x0d, 0x30, 0x2c,
+  0x50, 0xbd, 0xdb, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xba, 0x06, 0xed, 0xdd, 0x50, 0x69, 0x00, 0x00, 0x06,
+  0x90, 0x00, 0x00, 0x07, 0x00, 0x26, 0x58, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x2f, 0x50, 0x00, 0x07,
+  0x8b, 0x00, 0x00, 0xd1, 0xd1, 0x00, 0x3c, 0x09, 0x60, 0x08, 0x60, 0x3b, 0x00,
+  0xd1, 0x00, 0xe1, 0x3c, 0x00, 0x09, 0x66, 0xdd, 0xdd, 0xd9, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf3, 0x03, 0x0a,
+  0xed, 0xdd, 0x30, 0xa6, 0x00, 0x00, 0x0a, 0x60, 0x00, 0x00, 0xad, 0xbb, 0x70,
+  0x0a, 0x72, 0x21, 0x00, 0x0e, 0x00, 0x44, 0x8d, 0xdd, 0xd4, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0a,
+  0xdd, 0xdf, 0x50, 0x00, 0x04, 0xc0, 0x00, 0x01, 0xd2, 0x00, 0x00, 0xa6, 0x00,
+  0x00, 0x5b, 0x00, 0x00, 0x1d, 0x10, 0x00, 0x0b, 0x50, 0x00, 0x02, 0xdd, 0xdd,
+  0xd6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0x70, 0x0f, 0x00, 0x0c, 0x40, 0xf0, 0x00, 0xc4, 0x07, 0x00, 0x64, 0xfb,
+  0xbb, 0xe4, 0x0f, 0x22, 0x2c, 0x0e, 0x00, 0x44, 0xd0, 0x00, 0xa3, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf4, 0x10,
+  0x10, 0x00, 0x03, 0xdc, 0xe5, 0x00, 0xe4, 0x01, 0xe2, 0x4c, 0x00, 0x09, 0x76,
+  0xa6, 0xb8, 0x69, 0x6a, 0x12, 0x17, 0x93, 0xd0, 0x00, 0xa6, 0x0c, 0x60, 0x3e,
+  0x10, 0x1b, 0xec, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xab, 0x0b, 0xdf, 0xdd, 0x00, 0x00, 0xe1, 0x00, 0x00,
+  0x0e, 0x10, 0x07, 0x00, 0x44, 0xbd, 0xdd, 0xd0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0d, 0x30, 0x0d,
+  0x40, 0xd3, 0x0b, 0x60, 0x0d, 0x39, 0x90, 0x00, 0xd9, 0xf7, 0x00, 0x0d, 0xd2,
+  0xe1, 0x00, 0xd3, 0x07, 0x90, 0x0d, 0x30, 0x0e, 0x30, 0xb2, 0x00, 0x59, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4,
+  0x0d, 0x2f, 0x50, 0x00, 0x07, 0xaa, 0x00, 0x00, 0xc2, 0xe0, 0x00, 0x1d, 0x0a,
+  0x40, 0x06, 0x80, 0x69, 0x00, 0xb3, 0x01, 0xe0, 0x1e, 0x00, 0x0c, 0x44, 0x90,
+  0x00, 0x67, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf4, 0x0e, 0x2f, 0x40, 0x1f, 0x52, 0xe9, 0x06, 0xe5, 0x2b, 0xd0,
+  0xba, 0x52, 0xc9, 0x4b, 0x95, 0x2c, 0x3d, 0x6a, 0x52, 0xc0, 0xb1, 0xa5, 0x2c,
+  0x00, 0x0a, 0x51, 0xa0, 0x00, 0x84, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0x50, 0x0c, 0x30, 0xed,
+  0x00, 0xc3, 0x0e, 0x95, 0x0c, 0x30, 0xe2, 0xd0, 0xc3, 0x0f, 0x09, 0x6b, 0x30,
+  0xf0, 0x1d, 0xb3, 0x0f, 0x00, 0x9e, 0x30, 0xc0, 0x01, 0xd3, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x43, 0x0d, 0xdd,
+  0xdd, 0x30, 0x0b, 0x00, 0x63, 0x2b, 0xbb, 0x50, 0x00, 0x22, 0x21, 0x0d, 0x00,
+  0x54, 0x02, 0xdd, 0xdd, 0xd4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x00, 0xf4, 0x10, 0x10, 0x00, 0x03, 0xdc, 0xe5, 0x00,
+  0xe3, 0x01, 0xe2, 0x4c, 0x00, 0x09, 0x76, 0xa0, 0x00, 0x69, 0x6a, 0x00, 0x07,
+  0x93, 0xd0, 0x00, 0xa6, 0x0c, 0x60, 0x3e, 0x10, 0x1b, 0xec, 0x30, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xab, 0x0f,
+  0xdd, 0xdf, 0x40, 0xf0, 0x00, 0xc4, 0x0f, 0x00, 0x0c, 0x07, 0x00, 0x44, 0xd0,
+  0x00, 0xa3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf6, 0x0c, 0x0c, 0xdc, 0xc9, 0x00, 0xc3, 0x00, 0xb5, 0x0c, 0x30,
+  0x08, 0x70, 0xc4, 0x14, 0xd3, 0x0c, 0xcb, 0xa3, 0x00, 0xc3, 0x00, 0x00, 0x0c,
+  0x30, 0x00, 0x00, 0xa3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0xed, 0xdd, 0x00, 0x4b, 0x00, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x0b, 0x50,
+  0x00, 0x07, 0x80, 0x00, 0x01, 0xdd, 0xdd, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xbb, 0x6d, 0xdf, 0xdd, 0x90,
+  0x00, 0xe1, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x07, 0x00, 0x25, 0xc1, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d,
+  0x4c, 0x00, 0x08, 0x70, 0xc4, 0x01, 0xd0, 0x03, 0xc0, 0x86, 0x00, 0x0b, 0x5d,
+  0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00,
+  0xc1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01,
+  0x00, 0xf1, 0x11, 0x30, 0x00, 0x00, 0x1f, 0x30, 0x00, 0xab, 0xfb, 0xc1, 0x6a,
+  0x0d, 0x17, 0x9a, 0x50, 0xd1, 0x2d, 0x96, 0x0d, 0x13, 0xd5, 0xc0, 0xd1, 0xa8,
+  0x07, 0xdf, 0xd9, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x01, 0x25, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0d,
+  0x30, 0x0d, 0x20, 0x5b, 0x07, 0x80, 0x00, 0xb5, 0xd0, 0x00, 0x03, 0xf6, 0x00,
+  0x00, 0x6d, 0x90, 0x00, 0x1d, 0x1d, 0x20, 0x09, 0x70, 0x4c, 0x01, 0xc0, 0x00,
+  0xa4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf5, 0x0d, 0x77, 0x0e, 0x14, 0xa7, 0x70, 0xe1, 0x4a, 0x68, 0x0e, 0x15,
+  0x92, 0xd1, 0xe2, 0xb5, 0x05, 0xcf, 0xe7, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x0e,
+  0x10, 0x00, 0x00, 0xc1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0xf4, 0x10, 0x10, 0x00, 0x03, 0xdc, 0xe5, 0x00, 0xe3,
+  0x01, 0xe2, 0x4c, 0x00, 0x09, 0x76, 0xa0, 0x00, 0x79, 0x5b, 0x00, 0x08, 0x81,
+  0xd0, 0x00, 0xb3, 0x07, 0x70, 0x4a, 0x07, 0xdd, 0x0a, 0xd9, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf5, 0x08, 0x10,
+  0x00, 0x04, 0xeb, 0x98, 0x60, 0xe3, 0x05, 0xe3, 0x4c, 0x00, 0x0f, 0x04, 0xc0,
+  0x01, 0xd0, 0x1e, 0x20, 0x9c, 0x00, 0x5d, 0xd5, 0xca, 0x20, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc9, 0x00,
+  0x09, 0x90, 0x7a, 0x00, 0xd2, 0x03, 0xc0, 0x0e, 0x10, 0xa5, 0x00, 0xe0, 0xbd,
+  0x40, 0x0e, 0x00, 0x0c, 0x30, 0xe0, 0x00, 0x87, 0x0e, 0x50, 0x0c, 0x50, 0xe8,
+  0xce, 0x80, 0x0e, 0x10, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x2e, 0x10, 0x09, 0x50,
+  0x88, 0x00, 0xd1, 0x01, 0xe0, 0x3b, 0x00, 0x09, 0x5b, 0x40, 0x00, 0x4c, 0xb0,
+  0x00, 0x00, 0xf2, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xcb,
+  0x81, 0x08, 0x80, 0x15, 0x00, 0x3d, 0x30, 0x00, 0x00, 0x4f, 0x80, 0x00, 0x5b,
+  0x38, 0xb0, 0x1e, 0x00, 0x0b, 0x42, 0xc0, 0x00, 0x96, 0x0e, 0x40, 0x1e, 0x20,
+  0x3c, 0xdd, 0x50, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xf5, 0x08, 0x10, 0x00, 0x03, 0xdb, 0xbb, 0x00, 0x97, 0x00,
+  0x10, 0x02, 0xc9, 0x70, 0x00, 0x98, 0x32, 0x00, 0x0d, 0x30, 0x03, 0x10, 0x4c,
+  0xcc, 0xa1, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x2b, 0xbb, 0xb3, 0x00, 0x11, 0x8a, 0x00, 0x00, 0xa7, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x87, 0x00,
+  0x00, 0x05, 0xd2, 0x00, 0x00, 0x07, 0xdd, 0x80, 0x00, 0x00, 0x1c, 0x30, 0x00,
+  0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xf0, 0x01, 0x01, 0x00, 0x0d, 0x5c, 0xda, 0x00, 0xc9, 0x00, 0xe1, 0x0c, 0x30,
+  0x0c, 0x20, 0xc3, 0x00, 0xc2, 0x07, 0x00, 0xf0, 0x02, 0xa2, 0x00, 0xc2, 0x00,
+  0x00, 0x0c, 0x20, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc9, 0x10, 0x07, 0x90, 0x7a, 0x00,
+  0xe1, 0x00, 0xe1, 0x1e, 0x00, 0x0b, 0x42, 0xfb, 0xbb, 0xf5, 0x1e, 0x00, 0x0b,
+  0x40, 0xe0, 0x00, 0xd2, 0x09, 0x70, 0x4c, 0x00, 0x1b, 0xdc, 0x20, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x96, 0x0c,
+  0xce, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x25, 0x7d, 0xc2,
+  0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5,
+  0x06, 0x0b, 0x30, 0x2c, 0x60, 0xb4, 0x4c, 0x40, 0x0b, 0x7f, 0x70, 0x00, 0xbd,
+  0x2d, 0x10, 0x0b, 0x60, 0x5b, 0x00, 0x93, 0x00, 0x88, 0x1e, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x10, 0x00,
+  0x01, 0x6c, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x0e, 0x90, 0x00, 0x05, 0x9e,
+  0x00, 0x00, 0xd2, 0xa5, 0x00, 0x4c, 0x04, 0xb0, 0x0b, 0x50, 0x0e, 0x21, 0xd0,
+  0x00, 0x86, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0x72, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0x00, 0xf0,
+  0x07, 0xe0, 0x0f, 0x30, 0x7e, 0x00, 0xeb, 0xd6, 0xa7, 0x0e, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0xf6, 0x05, 0x2e, 0x00, 0x09, 0x50, 0x97, 0x00, 0xd1, 0x01, 0xe0, 0x3c,
+  0x00, 0x09, 0x59, 0x50, 0x00, 0x4b, 0xc0, 0x00, 0x00, 0xd4, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xbb,
+  0xb3, 0x01, 0xa8, 0x21, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x04,
+  0xec, 0x60, 0x04, 0xb0, 0x00, 0x00, 0x96, 0x00, 0x00, 0x07, 0xc1, 0x00, 0x00,
+  0x07, 0xdd, 0x80, 0x00, 0x00, 0x1c, 0x40, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf5, 0x08, 0x10, 0x00, 0x03,
+  0xdb, 0xd5, 0x00, 0xe3, 0x01, 0xe2, 0x2d, 0x00, 0x0a, 0x62, 0xe0, 0x00, 0xb5,
+  0x0d, 0x50, 0x2e, 0x10, 0x2c, 0xdc, 0x40, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x8e, 0xed, 0xde, 0xb0, 0x77,
+  0x03, 0xb0, 0x08, 0x60, 0x3b, 0x00, 0x86, 0x03, 0xb0, 0x09, 0x50, 0x3b, 0x00,
+  0x94, 0x00, 0xd8, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xf0, 0x16, 0x10, 0x00, 0x01, 0xcc, 0xd8, 0x00, 0xa7, 0x00, 0xd3,
+  0x0d, 0x10, 0x09, 0x60, 0xe1, 0x00, 0xa6, 0x0e, 0x40, 0x2e, 0x10, 0xe9, 0xcd,
+  0x50, 0x0e, 0x10, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x03, 0xcd, 0xfc, 0xb0, 0xe4,
+  0x05, 0xa0, 0x3d, 0x00, 0x0e, 0x13, 0xd0, 0x00, 0xe2, 0x0e, 0x40, 0x4d, 0x00,
+  0x3c, 0xdc, 0x20, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x2c, 0xcf, 0xcc, 0x50, 0x00, 0xe1, 0x00, 0x00, 0x0e,
+  0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0d, 0x10, 0x00, 0x00, 0x8d, 0x60, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06,
+  0x0e, 0x00, 0x0e, 0x00, 0xe0, 0x00, 0xd3, 0x0e, 0x00, 0x0b, 0x40, 0xe0, 0x00,
+  0xc3, 0x0d, 0x40, 0x3e, 0x00, 0x3c, 0xdc, 0x30, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf0, 0x1a, 0x08, 0x00, 0x00, 0x00,
+  0xe1, 0x00, 0x06, 0xdf, 0xe8, 0x02, 0xe1, 0xe1, 0xc5, 0x69, 0x0e, 0x16, 0x96,
+  0xa0, 0xe1, 0x79, 0x1e, 0x2e, 0x2d, 0x40, 0x4c, 0xfe, 0x60, 0x00, 0x0e, 0x10,
+  0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf0, 0x14, 0x1e, 0x10, 0x0d, 0x10, 0x6a, 0x08, 0x70, 0x00, 0xc6,
+  0xd0, 0x00, 0x02, 0xf5, 0x00, 0x00, 0x3e, 0x80, 0x00, 0x0c, 0x3d, 0x20, 0x06,
+  0x90, 0x3c, 0x01, 0xe1, 0x00, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0xf1, 0x0e, 0x08, 0x10, 0x00, 0x00, 0xd1, 0x00, 0x59,
+  0x0d, 0x1a, 0x44, 0xa0, 0xd1, 0x68, 0x4a, 0x0d, 0x15, 0x94, 0xa0, 0xd1, 0x68,
+  0x1e, 0x1d, 0x2c, 0x40, 0x5d, 0xfe, 0x70, 0x00, 0x0d, 0x1c, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x0d,
+  0x20, 0x0d, 0x24, 0xb0, 0x00, 0x88, 0x87, 0x0b, 0x04, 0xb9, 0x60, 0xd0, 0x3c,
+  0x69, 0x0f, 0x27, 0x90, 0xbd, 0x6c, 0xc2, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf5, 0x08, 0x01, 0x00, 0x01, 0xbc, 0xbc,
+  0x10, 0xb6, 0x00, 0x10, 0x0f, 0x88, 0x80, 0x00, 0xf3, 0x33, 0x00, 0x0a, 0x70,
+  0x02, 0x10, 0x1a, 0xdc, 0xa2, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf6, 0x05, 0x06, 0xbb, 0xb0, 0x00, 0x92, 0x00, 0x00,
+  0x09, 0xa9, 0x20, 0x00, 0x94, 0x20, 0x00, 0x09, 0x20, 0x00, 0x00, 0x9c, 0xbb,
+  0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x08,
+  0x75, 0x49, 0x0b, 0x27, 0x76, 0xd1, 0xe4, 0xa9, 0x10, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf3, 0x08, 0x01, 0x9a, 0x91, 0x00,
+  0xb3, 0x02, 0xb2, 0x38, 0x01, 0x4a, 0x83, 0xcb, 0x95, 0x10, 0x0c, 0x20, 0x04,
+  0x40, 0x2c, 0xab, 0xa0, 0x00, 0x01, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xf6, 0x07, 0x20, 0x00, 0x00, 0x69, 0x00, 0x00,
+  0x79, 0x00, 0x00, 0x7e, 0x99, 0x99, 0x73, 0xd4, 0x33, 0x33, 0x03, 0xb1, 0x00,
+  0x00, 0x02, 0xa0, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xf3, 0x0a, 0x30, 0x00, 0x00, 0x6f, 0x80, 0x00, 0x59, 0xd7, 0x80,
+  0x4a, 0x0d, 0x07, 0x71, 0x00, 0xd0, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd0,
+  0x00, 0x00, 0x02, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0x50, 0x20, 0x00, 0x00, 0x06, 0x90, 0x04, 0x00, 0xd6, 0x69, 0x99,
+  0x9d, 0xa2, 0x33, 0x34, 0xc5, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x84, 0x20, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf6, 0x07, 0x60,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x32, 0x0d, 0x00, 0x51, 0xc1,
+  0xd0, 0xb3, 0x02, 0xbd, 0xa4, 0x00, 0x02, 0xe4, 0x20, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0xf3, 0x0b, 0x01, 0xa2, 0x00, 0x32, 0xbe, 0xa4,
+  0x0b, 0x81, 0xd0, 0x80, 0xa0, 0x0d, 0x00, 0x08, 0x00, 0xd0, 0x00, 0xba, 0x4d,
+  0x2b, 0x01, 0x09, 0xfb, 0x10, 0x00, 0x05, 0x21, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x07, 0x87, 0x75, 0x00, 0xcd,
+  0x33, 0x30, 0x0b, 0x6b, 0x00, 0x00, 0xb0, 0x6b, 0x00, 0x0b, 0x00, 0x6b, 0x00,
+  0x00, 0x00, 0x30, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf7, 0x04, 0x04, 0x77, 0x77, 0x00, 0x23, 0x3c, 0xe0, 0x00, 0x0a,
+  0x8b, 0x00, 0x0a, 0x80, 0xb0, 0x0a, 0x80, 0x0c, 0x00, 0x30, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x08, 0x10,
+  0x04, 0x00, 0x4c, 0x10, 0xb0, 0x00, 0x4c, 0x1b, 0x00, 0x00, 0x4c, 0xc0, 0x05,
+  0x98, 0xcf, 0x00, 0x12, 0x22, 0x30, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x04, 0x00, 0x08, 0x00, 0xb0, 0x09,
+  0x80, 0x0b, 0x09, 0x80, 0x00, 0xb9, 0x80, 0x00, 0x0c, 0xe8, 0x87, 0x00, 0x23,
+  0x22, 0x10, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01,
+  0x00, 0xf6, 0x07, 0x20, 0x00, 0x00, 0x69, 0x00, 0x00, 0x9f, 0x99, 0x97, 0x78,
+  0x11, 0x11, 0x03, 0xc7, 0x66, 0x65, 0x04, 0xf5, 0x44, 0x30, 0x02, 0xa0, 0x20,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf0, 0x16,
+  0x30, 0x00, 0x00, 0x6b, 0x80, 0x00, 0x5f, 0x0f, 0x80, 0x4a, 0xa0, 0xa8, 0x71,
+  0x0a, 0x0a, 0x01, 0x00, 0xa0, 0xa0, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0xf6, 0x07, 0x20, 0x00, 0x00, 0x06, 0x90, 0x06, 0x99, 0x9f, 0xd0,
+  0x01, 0x11, 0x15, 0xa4, 0x66, 0x66, 0xc5, 0x24, 0x44, 0xe6, 0x00, 0x00, 0x84,
+  0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf6,
+  0x08, 0x04, 0x04, 0x00, 0x00, 0xa0, 0xa0, 0x00, 0x0a, 0x0a, 0x00, 0x32, 0xa0,
+  0xa1, 0x51, 0xcc, 0x0a, 0xb3, 0x02, 0xf1, 0xf4, 0x00, 0x02, 0xd4, 0x21, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x67,
+  0x00, 0x04, 0x92, 0xd0, 0x00, 0xa5, 0x0e, 0xa7, 0x7f, 0x00, 0x8d, 0x59, 0xd0,
+  0x02, 0xc0, 0x95, 0x00, 0x0c, 0x1d, 0x00, 0x00, 0x78, 0xa0, 0x00, 0x02, 0xf5,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0xf5, 0x0f, 0x21, 0x00, 0x00, 0xca, 0xd5, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00,
+  0x0c, 0x30, 0x2c, 0xda, 0xc4, 0x0d, 0x30, 0x1f, 0x31, 0xe0, 0x00, 0xe0, 0x0e,
+  0x20, 0x88, 0x00, 0x4d, 0xd9, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf3, 0x02, 0x0a, 0xaa, 0xac, 0x00, 0x00, 0x00,
+  0xb0, 0x00, 0x00, 0x0b, 0x00, 0x29, 0x99, 0xd0, 0x00, 0x11, 0x1b, 0x0e, 0x00,
+  0x54, 0x01, 0xaa, 0xaa, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x00, 0xf3, 0x11, 0x03, 0x10, 0x0a, 0xaa, 0xfc, 0x00,
+  0x00, 0x17, 0xb0, 0x00, 0x06, 0x1b, 0x00, 0x29, 0xf9, 0xd0, 0x00, 0x47, 0x1b,
+  0x00, 0x08, 0x00, 0xb0, 0x00, 0x80, 0x0b, 0x01, 0xfd, 0xaa, 0xc0, 0x05, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf5,
+  0x09, 0x05, 0x78, 0x83, 0x0a, 0x73, 0x33, 0x11, 0xa0, 0x00, 0x00, 0x33, 0xbb,
+  0xbb, 0x41, 0xa0, 0x00, 0x00, 0x0a, 0x84, 0x44, 0x10, 0x05, 0x77, 0x72, 0x21,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf3, 0x0d,
+  0x61, 0x00, 0x05, 0x7f, 0x83, 0x0a, 0x74, 0xe3, 0x11, 0xa0, 0x38, 0x00, 0x33,
+  0xb9, 0xab, 0x41, 0xa0, 0xa1, 0x00, 0x0a, 0x8f, 0x44, 0x10, 0x06, 0xf7, 0x72,
+  0x00, 0x25, 0x23, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf0, 0x1b, 0x0c, 0xcc, 0xcc, 0x30, 0x98, 0x00, 0x00, 0x00, 0xd3, 0x00,
+  0x00, 0x03, 0xd0, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x97,
+  0x00, 0x00, 0x5b, 0x00, 0x00, 0x1e, 0xa9, 0x99, 0x50, 0x44, 0x44, 0x42, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0xb0, 0x00,
+  0x00, 0x1a, 0x00, 0x00, 0x04, 0x60, 0x00, 0x00, 0x82, 0x00, 0x00, 0x0b, 0x01,
+  0x97, 0x00, 0xa0, 0x01, 0xc0, 0x37, 0x00, 0x09, 0x37, 0x30, 0x00, 0x38, 0xa0,
+  0x00, 0x00, 0xba, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xfb, 0x00, 0x3a, 0x60,
+  0x8b, 0x5a, 0x08, 0xb4, 0x09, 0xa0, 0x7c, 0x40, 0x93, 0x97, 0x1a, 0xb7, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf8,
+  0x06, 0x1b, 0xdc, 0x20, 0x09, 0x50, 0x2c, 0x00, 0xc0, 0x00, 0xc0, 0x0c, 0x00,
+  0x0b, 0x00, 0xc0, 0x00, 0xb0, 0x07, 0x00, 0x07, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x62, 0xc0, 0x00, 0xb0, 0x0c,
+  0x00, 0x0b, 0x07, 0x00, 0x98, 0x0d, 0x00, 0x6a, 0x38, 0x90, 0x00, 0x59, 0x60,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x02, 0x82,
+  0x00, 0x00, 0xb5, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0xf1,
+  0x00, 0xc2, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x85, 0x00, 0x00, 0x07, 0x70,
+  0x00, 0x00, 0x76, 0x0e, 0x00, 0xa0, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x73, 0x07, 0xc9, 0x09, 0x10, 0x80,
+  0x4b, 0x60, 0x07, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x00, 0x01, 0x00, 0xf9, 0x07, 0x03, 0x00, 0x00, 0x05, 0x60, 0x0b,
+  0xcc, 0xec, 0x20, 0x00, 0x83, 0x00, 0x02, 0x4b, 0x33, 0x00, 0x8e, 0x88, 0x81,
+  0x05, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0x70, 0x07, 0x77, 0x77, 0x10, 0x44, 0x44, 0x40, 0x0b, 0x00, 0x6b,
+  0x77, 0x77, 0x71, 0x04, 0x44, 0x44, 0x15, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf0, 0x00, 0x41,
+  0x00, 0x39, 0xd8, 0x10, 0xda, 0x30, 0x00, 0x05, 0xbb, 0x61, 0x00, 0x00, 0x16,
+  0xc2, 0x13, 0x00, 0x35, 0xbc, 0xcc, 0xc2, 0x1f, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf1, 0x01, 0x50, 0x00, 0x00, 0x07, 0xca,
+  0x40, 0x00, 0x00, 0x28, 0xe2, 0x00, 0x5a, 0xc6, 0x00, 0xc7, 0x20, 0x15, 0x00,
+  0x35, 0xbc, 0xcc, 0xc2, 0x21, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x00, 0xf8, 0x03, 0x06, 0xcb, 0xbb, 0x74, 0xa0, 0x00, 0x00, 0x74,
+  0x00, 0x00, 0x02, 0xc4, 0x22, 0x21, 0x02, 0x89, 0x99, 0x60, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf6, 0x07, 0x09, 0x00,
+  0x06, 0xcc, 0xfb, 0x74, 0xa0, 0x29, 0x00, 0x74, 0x04, 0x70, 0x02, 0xc4, 0x87,
+  0x21, 0x02, 0x8f, 0xc9, 0x60, 0x00, 0x41, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf2, 0x00, 0x09, 0xbb, 0x10, 0x07, 0x70,
+  0x3a, 0x00, 0x92, 0x00, 0xb0, 0x0a, 0x10, 0x0b, 0x00, 0xa1, 0x07, 0x00, 0x35,
+  0x10, 0x00, 0x10, 0x21, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0x60, 0xa1, 0x00, 0xb0, 0x0a, 0x10, 0x0b, 0x07, 0x00, 0xd6, 0x09,
+  0x10, 0x0b, 0x00, 0x76, 0x02, 0xa0, 0x00, 0xb9, 0xc2, 0x00, 0x00, 0x20, 0x21,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xbc, 0x06,
+  0xb2, 0xb4, 0x88, 0x9f, 0x3f, 0x6c, 0xc1, 0x30, 0x31, 0x22, 0x1b, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x07, 0x99, 0x90,
+  0x00, 0xa9, 0x00, 0x00, 0x0a, 0x90, 0x00, 0x07, 0x00, 0x06, 0xa0, 0x08, 0xa9,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x99, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00, 0x9a, 0x07, 0x00, 0x07, 0xa0,
+  0x79, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x4f, 0xca, 0xbf, 0x74, 0xba, 0x07, 0xb7,
+  0x48, 0xa4, 0xc5, 0x74, 0x82, 0xf5, 0x57, 0x48, 0x5b, 0x85, 0x74, 0x8c, 0x0c,
+  0x77, 0x4e, 0x60, 0x3e, 0x73, 0xdb, 0xbb, 0xd6, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa3, 0x00, 0x00,
+  0x1c, 0x30, 0x0a, 0x00, 0xc0, 0x02, 0xbf, 0x40, 0x00, 0x67, 0xf5, 0x00, 0x00,
+  0x2f, 0x50, 0x00, 0x02, 0x07, 0x00, 0x64, 0x65, 0x00, 0x00, 0xde, 0x50, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateSmallFont(tableLength, table, glyphWidth, glyphHeight, glyphDataOffset, glyphData);
@@ -0,0 +1,926 @@
+#include <string.h>
+#include "symbols.h"
+
+void quiz_case_ion_crc32();
+void quiz_case_ion_events_from_keyboard();
+void quiz_case_ion_keyboard();
+void quiz_case_ion_storage_records_crc32();
+void quiz_case_ion_storage_store_and_destroy_record();
+void quiz_case_ion_storage_put_record_twice();
+void quiz_case_ion_storage_invalid_renaming();
+void quiz_case_ion_storage_valid_renaming();
+void quiz_case_ion_storage_available_space_moving();
+void quiz_case_ion_utf8_code_point_system_parentheses();
+void quiz_case_ion_utf8_decode_forward();
+void quiz_case_ion_utf8_decode_backwards();
+void quiz_case_ion_utf8_decoder_next_glyph();
+void quiz_case_ion_utf8_decoder_previous_glyph();
+void quiz_case_ion_utf8_helper_count_occurrences();
+void quiz_case_ion_utf8_helper_code_point_search();
+void quiz_case_ion_utf8_helper_not_code_point_search();
+void quiz_case_ion_utf8_copy_and_remove_code_point();
+void quiz_case_ion_utf8_remove_code_point();
+void quiz_case_ion_utf8_move_string_from_index_by_number_of_char();
+void quiz_case_ion_utf8_try_and_replace_pattern_in_string_by_pattern();
+void quiz_case_ion_utf8_helper_copy_until_code_point();
+void quiz_case_ion_utf8_helper_previous_code_point_is();
+void quiz_case_ion_utf8_helper_code_point_is();
+void quiz_case_ion_utf8_helper_remove_previous_glyph();
+void quiz_case_ion_utf8_code_point_at_glyph_offset();
+void quiz_case_ion_utf8_glyph_offset_at_code_point();
+void quiz_case_ion_utf8_helper_string_glyph_length();
+void quiz_case_ion_utf8_helper_beginning_of_word();
+void quiz_case_ion_utf8_helper_end_of_word();
+void quiz_case_kandinsky_color_rgb();
+void quiz_case_kandinsky_color_blend();
+void quiz_case_kandinsky_context_copy_rect();
+void quiz_case_kandinsky_font_index_for_code_point();
+void quiz_case_kandinsky_antialiased_line_aligned();
+void quiz_case_kandinsky_antialiased_line_symmetry();
+void quiz_case_kandinsky_antialiased_line_clipping();
+void quiz_case_kandinsky_rect_intersect();
+void quiz_case_kandinsky_rect_union();
+void quiz_case_kandinsky_rect_empty_union();
+void quiz_case_kandinsky_rect_difference();
+void quiz_case_tree_handle_are_discared_after_block();
+void quiz_case_tree_handle_are_discared_after_function_call();
+void quiz_case_tree_handle_can_be_copied();
+void quiz_case_tree_handle_can_be_moved();
+void quiz_case_tree_handle_can_be_returned();
+void quiz_case_tree_handle_memory_failure();
+void quiz_case_tree_handle_does_not_copy();
+void quiz_case_poincare_approximation_decimal();
+void quiz_case_poincare_approximation_based_integer();
+void quiz_case_poincare_approximation_rational();
+void quiz_case_poincare_approximation_float();
+void quiz_case_poincare_approximation_infinity();
+void quiz_case_poincare_approximation_addition();
+void quiz_case_poincare_approximation_multiplication();
+void quiz_case_poincare_approximation_power();
+void quiz_case_poincare_approximation_subtraction();
+void quiz_case_poincare_approximation_constant();
+void quiz_case_poincare_approximation_division();
+void quiz_case_poincare_approximation_logarithm();
+void quiz_case_poincare_approximation_function();
+void quiz_case_poincare_approximation_trigonometry_functions();
+void quiz_case_poincare_approximation_matrix();
+void quiz_case_poincare_approximation_store();
+void quiz_case_poincare_approximation_store_matrix();
+void quiz_case_poincare_approximation_complex_format();
+void quiz_case_poincare_approximation_mix();
+void quiz_case_poincare_arithmetic_gcd();
+void quiz_case_poincare_arithmetic_lcm();
+void quiz_case_poincare_arithmetic_factorization();
+void quiz_case_poincare_arithmetic_factorization_benchmark();
+void quiz_case_poincare_compiled_expression();
+void quiz_case_poincare_compiled_expression_interval();
+void quiz_case_poincare_compiled_expression_derivative();
+void quiz_case_poincare_context_store_overwrite();
+void quiz_case_poincare_context_store_do_not_overwrite();
+void quiz_case_poincare_context_user_variable_simple();
+void quiz_case_poincare_context_user_variable_2_circular_variables();
+void quiz_case_poincare_context_user_variable_3_circular_variables();
+void quiz_case_poincare_context_user_variable_1_circular_function();
+void quiz_case_poincare_context_user_variable_2_circular_functions();
+void quiz_case_poincare_context_user_variable_3_circular_functions();
+void quiz_case_poincare_context_user_variable_circular_variables_and_functions();
+void quiz_case_poincare_context_user_variable_composed_functions();
+void quiz_case_poincare_context_user_variable_functions_approximation_with_value_for_symbol();
+void quiz_case_poincare_context_user_variable_properties();
+void quiz_case_erf_inv();
+void quiz_case_poincare_dense_polynomial_build();
+void quiz_case_poincare_dense_polynomial_roots();
+void quiz_case_poincare_derivative_formal();
+void quiz_case_poincare_derivative_approximation();
+void quiz_case_poincare_expression_can_start_uninitialized();
+void quiz_case_poincare_expression_can_be_copied_even_if_uninitialized();
+void quiz_case_poincare_expression_cast_does_not_copy();
+void quiz_case_poincare_expression_is_identical_to();
+void quiz_case_poincare_expression_structural_hash();
+void quiz_case_poincare_expression_decimal_constructor();
+void quiz_case_poincare_expression_rational_constructor();
+void quiz_case_poincare_expression_unit_constructor();
+void quiz_case_poincare_expression_order_constant();
+void quiz_case_poincare_expression_order_decimal();
+void quiz_case_poincare_expression_order_rational();
+void quiz_case_poincare_expression_order_float();
+void quiz_case_poincare_expression_order_power();
+void quiz_case_poincare_expression_order_symbol();
+void quiz_case_poincare_expression_order_function();
+void quiz_case_poincare_expression_order_mix();
+void quiz_case_poincare_expression_order_addition_multiplication();
+void quiz_case_poincare_expression_order_stable_sort();
+void quiz_case_poincare_properties_is_number();
+void quiz_case_poincare_properties_is_number_zero();
+void quiz_case_poincare_properties_is_random();
+void quiz_case_poincare_properties_is_parametered_expression();
+void quiz_case_poincare_properties_is_approximate();
+void quiz_case_poincare_properties_is_matrix();
+void quiz_case_poincare_properties_deep_is_matrix();
+void quiz_case_poincare_properties_descendant_properties();
+void quiz_case_poincare_properties_is_infinity();
+void quiz_case_poincare_properties_decimal_sign();
+void quiz_case_poincare_properties_based_integer_sign();
+void quiz_case_poincare_properties_rational_sign();
+void quiz_case_poincare_properties_expression_sign();
+void quiz_case_poincare_properties_sign();
+void quiz_case_poincare_properties_is_real();
+void quiz_case_poincare_properties_polynomial_degree();
+void quiz_case_poincare_properties_get_variables();
+void quiz_case_poincare_properties_get_polynomial_coefficients();
+void quiz_case_poincare_properties_remove_unit();
+void quiz_case_poincare_expression_additional_results();
+void quiz_case_poincare_serialization_based_integer();
+void quiz_case_poincare_serialization_rational();
+void quiz_case_poincare_serialization_decimal();
+void quiz_case_poincare_serialization_float();
+void quiz_case_poincare_serialization_division();
+void quiz_case_poincare_serialization_factorial();
+void quiz_case_poincare_expression_to_layout();
+void quiz_case_poincare_expression_to_layout_multiplication_operator();
+void quiz_case_poincare_expression_to_layout_serializes_to_self();
+void quiz_case_poincare_function_extremum();
+void quiz_case_poincare_function_root();
+void quiz_case_poincare_function_intersection();
+void quiz_case_poincare_function_all_points_of_interest();
+void quiz_case_poincare_helpers_gcd();
+void quiz_case_poincare_helpers_insert_simple_swap();
+void quiz_case_poincare_helpers_rotate();
+void quiz_case_poincare_infinity_symbol();
+void quiz_case_poincare_integer_constructor();
+void quiz_case_poincare_integer_compare();
+void quiz_case_poincare_integer_properties();
+void quiz_case_poincare_integer_addition();
+void quiz_case_poincare_integer_subtraction();
+void quiz_case_poincare_integer_multiplication();
+void quiz_case_poincare_integer_divide();
+void quiz_case_poincare_integer_multiplication_and_division_benchmark();
+void quiz_case_poincare_integer_pow();
+void quiz_case_poincare_integer_factorial();
+void quiz_case_poincare_integer_evaluate();
+void quiz_case_poincare_integer_serialize();
+void quiz_case_poincare_integer_euclidian_division();
+void quiz_case_poincare_integer_mixed_fraction();
+void quiz_case_poincare_layout_constructors();
+void quiz_case_poincare_layout_comparison();
+void quiz_case_poincare_layout_fraction_create();
+void quiz_case_poincare_layout_power();
+void quiz_case_poincare_layout_parentheses_size();
+void quiz_case_poincare_layout_cursor_computation();
+void quiz_case_poincare_layout_cursor_delete();
+void quiz_case_poincare_layout_serialization();
+void quiz_case_poincare_layout_to_expression_unparsable();
+void quiz_case_poincare_layout_to_expression_parsable();
+void quiz_case_poincare_parsing_tokenize_numbers();
+void quiz_case_poincare_parsing_memory_exhaustion();
+void quiz_case_poincare_parsing_parse_numbers();
+void quiz_case_poincare_parsing_parse();
+void quiz_case_poincare_parsing_matrices();
+void quiz_case_poincare_parsing_units();
+void quiz_case_poincare_parsing_identifiers();
+void quiz_case_poincare_parsing_reserved_names();
+void quiz_case_poincare_parsing_parse_store();
+void quiz_case_poincare_parsing_parse_unit_convert();
+void quiz_case_poincare_parsing_implicit_multiplication();
+void quiz_case_poincare_parsing_adding_missing_parentheses();
+void quiz_case_assert_print_floats();
+void quiz_case_poincare_print_int_left();
+void quiz_case_poincare_print_int_right();
+void quiz_case_poincare_rational_order();
+void quiz_case_poincare_rational_specific_properties();
+void quiz_case_poincare_rational_addition();
+void quiz_case_poincare_rational_power();
+void quiz_case_regularized_incomplete_beta_function();
+void quiz_case_poincare_simplification_based_integer();
+void quiz_case_poincare_simplification_decimal();
+void quiz_case_poincare_simplification_rational();
+void quiz_case_poincare_simplification_infinity();
+void quiz_case_poincare_simplification_addition();
+void quiz_case_poincare_simplification_multiplication();
+void quiz_case_poincare_simplification_units();
+void quiz_case_poincare_simplification_power();
+void quiz_case_poincare_simplification_factorial();
+void quiz_case_poincare_simplification_logarithm();
+void quiz_case_poincare_simplification_random();
+void quiz_case_poincare_simplification_randint();
+void quiz_case_poincare_simplification_function();
+void quiz_case_poincare_simplification_trigonometry_functions();
+void quiz_case_poincare_simplification_matrix();
+void quiz_case_poincare_simplification_functions_of_matrices();
+void quiz_case_poincare_simplification_store();
+void quiz_case_poincare_simplification_store_matrix();
+void quiz_case_poincare_simplification_unit_convert();
+void quiz_case_poincare_simplification_complex_format();
+void quiz_case_poincare_simplification_reduction_target();
+void quiz_case_poincare_simplification_unit_conversion();
+void quiz_case_poincare_simplification_user_function();
+void quiz_case_poincare_simplification_user_function_with_convert();
+void quiz_case_poincare_simplification_mix();
+void quiz_case_poincare_hyperbolic_trigonometry();
+void quiz_case_poincare_probability();
+void quiz_case_poincare_zoom_interesting_ranges();
+void quiz_case_poincare_zoom_refined_range();
+void quiz_case_poincare_zoom_range_with_ratio();
+void quiz_case_poincare_zoom_full_range();
+void quiz_case_poincare_zoom_utility();
+void quiz_case_python_basics();
+void quiz_case_python_template();
+void quiz_case_python_ion_import();
+void quiz_case_python_ion_keydown();
+void quiz_case_python_kandinsky_import();
+void quiz_case_python_kandinsky_basics();
+void quiz_case_python_math();
+void quiz_case_python_cmath();
+void quiz_case_python_random();
+void quiz_case_python_time();
+void quiz_case_python_turtle();
+void quiz_case_python_turtle_circle();
+void quiz_case_python_matplotlib_pyplot_import();
+void quiz_case_python_matplotlib_pyplot_arrow();
+void quiz_case_python_matplotlib_pyplot_axis();
+void quiz_case_python_matplotlib_pyplot_bar();
+void quiz_case_python_matplotlib_pyplot_grid();
+void quiz_case_python_matplotlib_pyplot_hist();
+void quiz_case_python_matplotlib_pyplot_plot();
+void quiz_case_python_matplotlib_pyplot_scatter();
+void quiz_case_python_matplotlib_pyplot_text();
+void quiz_case_python_ulab();
+void quiz_case_escher_clipboard_enters_and_exits_python();
+void quiz_case_escher_clipboard_stored_text_is_parseable();
+void quiz_case_escher_layout_field_select_left_right();
+void quiz_case_escher_layout_field_select_up_down();
+void quiz_case_escher_layout_field_unselect();
+void quiz_case_escher_layout_field_delete();
+void quiz_case_alignment_handling();
+void quiz_case_calculation_store();
+void quiz_case_calculation_ans();
+void quiz_case_calculation_significant_digits();
+void quiz_case_calculation_display_exact_approximate();
+void quiz_case_calculation_symbolic_computation();
+void quiz_case_calculation_symbolic_computation_and_parametered_expressions();
+void quiz_case_calculation_complex_format();
+void quiz_case_graph_caching();
+void quiz_case_graph_caching_accuracy();
+void quiz_case_graph_caching_passes();
+void quiz_case_graph_caching_pool();
+void quiz_case_graph_ranges_single_function();
+void quiz_case_graph_ranges_several_functions();
+void quiz_case_graph_ranges_zoom();
+void quiz_case_graph_ranges_orthonormal();
+void quiz_case_graph_stamp_precomputed_masks();
+void quiz_case_graph_stamp_benchmark();
+void quiz_case_variable_box_controller();
+void quiz_case_data_statistics();
+void quiz_case_hypergeometric_function();
+void quiz_case_binomial_distribution();
+void quiz_case_chi_squared_distribution();
+void quiz_case_student_distribution();
+void quiz_case_geometric_distribution();
+void quiz_case_fisher_distribution();
+void quiz_case_regularized_gamma();
+void quiz_case_equation_solve();
+void quiz_case_equation_solve_complex_real();
+void quiz_case_equation_solve_complex_cartesian();
+void quiz_case_equation_solve_complex_polar();
+void quiz_case_equation_and_symbolic_computation();
+void quiz_case_sequence_evaluation();
+void quiz_case_sequence_sum_evaluation();
+void quiz_case_linear_regression();
+void quiz_case_linear_regression2();
+void quiz_case_proportional_regression();
+void quiz_case_proportional_regression2();
+void quiz_case_proportional_regression3();
+void quiz_case_proportional_regression4();
+void quiz_case_proportional_regression5();
+void quiz_case_quadratic_regression();
+void quiz_case_cubic_regression();
+void quiz_case_quartic_regression();
+void quiz_case_logarithmic_regression();
+void quiz_case_exponential_regression();
+void quiz_case_exponential_regression2();
+void quiz_case_exponential_regression3();
+void quiz_case_power_regression();
+void quiz_case_trigonometric_regression1();
+void quiz_case_trigonometric_regression2();
+void quiz_case_logistic_regression();
+void quiz_case_column_calculation();
+void quiz_case_constant_column_calculation();
+void quiz_case_regression_calculation();
+
+QuizCase quiz_cases[] = {
+  quiz_case_ion_crc32,
+  quiz_case_ion_events_from_keyboard,
+  quiz_case_ion_keyboard,
+  quiz_case_ion_storage_records_crc32,
+  quiz_case_ion_storage_store_and_destroy_record,
+  quiz_case_ion_storage_put_record_twice,
+  quiz_case_ion_storage_invalid_renaming,
+  quiz_case_ion_storage_valid_renaming,
+  quiz_case_ion_storage_available_space_moving,
+  quiz_case_ion_utf8_code_point_system_parentheses,
+  quiz_case_ion_utf8_decode_forward,
+  quiz_case_ion_utf8_decode_backwards,
+  quiz_case_ion_utf8_decoder_next_glyph,
+  quiz_case_ion_utf8_decoder_previous_glyph,
+  quiz_case_ion_utf8_helper_count_occurrences,
+  quiz_case_ion_utf8_helper_code_point_search,
+  quiz_case_ion_utf8_helper_not_code_point_search,
+  quiz_case_ion_utf8_copy_and_remove_code_point,
+  quiz_case_ion_utf8_remove_code_point,
+  quiz_case_ion_utf8_move_string_from_index_by_number_of_char,
+  quiz_case_ion_utf8_try_and_replace_pattern_in_string_by_pattern,
+  quiz_case_ion_utf8_helper_copy_until_code_point,
+  quiz_case_ion_utf8_helper_previous_code_point_is,
+  quiz_case_ion_utf8_helper_code_point_is,
+  quiz_case_ion_utf8_helper_remove_previous_glyph,
+  quiz_case_ion_utf8_code_point_at_glyph_offset,
+  quiz_case_ion_utf8_glyph_offset_at_code_point,
+  quiz_case_ion_utf8_helper_string_glyph_length,
+  quiz_case_ion_utf8_helper_beginning_of_word,
+  quiz_case_ion_utf8_helper_end_of_word,
+  quiz_case_kandinsky_color_rgb,
+  quiz_case_kandinsky_color_blend,
+  quiz_case_kandinsky_context_copy_rect,
+  quiz_case_kandinsky_font_index_for_code_point,
+  quiz_case_kandinsky_antialiased_line_aligned,
+  quiz_case_kandinsky_antialiased_line_symmetry,
+  quiz_case_kandinsky_antialiased_line_clipping,
+  quiz_case_kandinsky_rect_intersect,
+  quiz_case_kandinsky_rect_union,
+  quiz_case_kandinsky_rect_empty_union,
+  quiz_case_kandinsky_rect_difference,
+  quiz_case_tree_handle_are_discared_after_block,
+  quiz_case_tree_handle_are_discared_after_function_call,
+  quiz_case_tree_handle_can_be_copied,
+  quiz_case_tree_handle_can_be_moved,
+  quiz_case_tree_handle_can_be_returned,
+  quiz_case_tree_handle_memory_failure,
+  quiz_case_tree_handle_does_not_copy,
+  quiz_case_poincare_approximation_decimal,
+  quiz_case_poincare_approximation_based_integer,
+  quiz_case_poincare_approximation_rational,
+  quiz_case_poincare_approximation_float,
+  quiz_case_poincare_approximation_infinity,
+  quiz_case_poincare_approximation_addition,
+  quiz_case_poincare_approximation_multiplication,
+  quiz_case_poincare_approximation_power,
+  quiz_case_poincare_approximation_subtraction,
+  quiz_case_poincare_approximation_constant,
+  quiz_case_poincare_approximation_division,
+  quiz_case_poincare_approximation_logarithm,
+  quiz_case_poincare_approximation_function,
+  quiz_case_poincare_approximation_trigonometry_functions,
+  quiz_case_poincare_approximation_matrix,
+  quiz_case_poincare_approximation_store,
+  quiz_case_poincare_approximation_store_matrix,
+  quiz_case_poincare_approximation_complex_format,
+  quiz_case_poincare_approximation_mix,
+  quiz_case_poincare_arithmetic_gcd,
+  quiz_case_poincare_arithmetic_lcm,
+  quiz_case_poincare_arithmetic_factorization,
+  quiz_case_poincare_arithmetic_factorization_benchmark,
+  quiz_case_poincare_compiled_expression,
+  quiz_case_poincare_compiled_expression_interval,
+  quiz_case_poincare_compiled_expression_derivative,
+  quiz_case_poincare_context_store_overwrite,
+  quiz_case_poincare_context_store_do_not_overwrite,
+  quiz_case_poincare_context_user_variable_simple,
+  quiz_case_poincare_context_user_variable_2_circular_variables,
+  quiz_case_poincare_context_user_variable_3_circular_variables,
+  quiz_case_poincare_context_user_variable_1_circular_function,
+  quiz_case_poincare_context_user_variable_2_circular_functions,
+  quiz_case_poincare_context_user_variable_3_circular_functions,
+  quiz_case_poincare_context_user_variable_circular_variables_and_functions,
+  quiz_case_poincare_context_user_variable_composed_functions,
+  quiz_case_poincare_context_user_variable_functions_approximation_with_value_for_symbol,
+  quiz_case_poincare_context_user_variable_properties,
+  quiz_case_erf_inv,
+  quiz_case_poincare_dense_polynomial_build,
+  quiz_case_poincare_dense_polynomial_roots,
+  quiz_case_poincare_derivative_formal,
+  quiz_case_poincare_derivative_approximation,
+  quiz_case_poincare_expression_can_start_uninitialized,
+  quiz_case_poincare_expression_can_be_copied_even_if_uninitialized,
+  quiz_case_poincare_expression_cast_does_not_copy,
+  quiz_case_poincare_expression_is_identical_to,
+  quiz_case_poincare_expression_structural_hash,
+  quiz_case_poincare_expression_decimal_constructor,
+  quiz_case_poincare_expression_rational_constructor,
+  quiz_case_poincare_expression_unit_constructor,
+  quiz_case_poincare_expression_order_constant,
+  quiz_case_poincare_expression_order_decimal,
+  quiz_case_poincare_expression_order_rational,
+  quiz_case_poincare_expression_order_float,
+  quiz_case_poincare_expression_order_power,
+  quiz_case_poincare_expression_order_symbol,
+  quiz_case_poincare_expression_order_function,
+  quiz_case_poincare_expression_order_mix,
+  quiz_case_poincare_expression_order_addition_multiplication,
+  quiz_case_poincare_expression_order_stable_sort,
+  quiz_case_poincare_properties_is_number,
+  quiz_case_poincare_properties_is_number_zero,
+  quiz_case_poincare_properties_is_random,
+  quiz_case_poincare_properties_is_parametered_expression,
+  quiz_case_poincare_properties_is_approximate,
+  quiz_case_poincare_properties_is_matrix,
+  quiz_case_poincare_properties_deep_is_matrix,
+  quiz_case_poincare_properties_descendant_properties,
+  quiz_case_poincare_properties_is_infinity,
+  quiz_case_poincare_properties_decimal_sign,
+  quiz_case_poincare_properties_based_integer_sign,
+  quiz_case_poincare_properties_rational_sign,
+  quiz_case_poincare_properties_expression_sign,
+  quiz_case_poincare_properties_sign,
+  quiz_case_poincare_properties_is_real,
+  quiz_case_poincare_properties_polynomial_degree,
+  quiz_case_poincare_properties_get_variables,
+  quiz_case_poincare_properties_get_polynomial_coefficients,
+  quiz_case_poincare_properties_remove_unit,
+  quiz_case_poincare_expression_additional_results,
+  quiz_case_poincare_serialization_based_integer,
+  quiz_case_poincare_serialization_rational,
+  quiz_case_poincare_serialization_decimal,
+  quiz_case_poincare_serialization_float,
+  quiz_case_poincare_serialization_division,
+  quiz_case_poincare_serialization_factorial,
+  quiz_case_poincare_expression_to_layout,
+  quiz_case_poincare_expression_to_layout_multiplication_operator,
+  quiz_case_poincare_expression_to_layout_serializes_to_self,
+  quiz_case_poincare_function_extremum,
+  quiz_case_poincare_function_root,
+  quiz_case_poincare_function_intersection,
+  quiz_case_poincare_function_all_points_of_interest,
+  quiz_case_poincare_helpers_gcd,
+  quiz_case_poincare_helpers_insert_simple_swap,
+  quiz_case_poincare_helpers_rotate,
+  quiz_case_poincare_infinity_symbol,
+  quiz_case_poincare_integer_constructor,
+  quiz_case_poincare_integer_compare,
+  quiz_case_poincare_integer_properties,
+  quiz_case_poincare_integer_addition,
+  quiz_case_poincare_integer_subtraction,
+  quiz_case_poincare_integer_multiplication,
+  quiz_case_poincare_integer_divide,
+  quiz_case_poincare_integer_multiplication_and_division_benchmark,
+  quiz_case_poincare_integer_pow,
+  quiz_case_poincare_integer_factorial,
+  quiz_case_poincare_integer_evaluate,
+  quiz_case_poincare_integer_serialize,
+  quiz_case_poincare_integer_euclidian_division,
+  quiz_case_poincare_integer_mixed_fraction,
+  quiz_case_poincare_layout_constructors,
+  quiz_case_poincare_layout_comparison,
+  quiz_case_poincare_layout_fraction_create,
+  quiz_case_poincare_layout_power,
+  quiz_case_poincare_layout_parentheses_size,
+  quiz_case_poincare_layout_cursor_computation,
+  quiz_case_poincare_layout_cursor_delete,
+  quiz_case_poincare_layout_serialization,
+  quiz_case_poincare_layout_to_expression_unparsable,
+  quiz_case_poincare_layout_to_expression_parsable,
+  quiz_case_poincare_parsing_tokenize_numbers,
+  quiz_case_poincare_parsing_memory_exhaustion,
+  quiz_case_poincare_parsing_parse_numbers,
+  quiz_case_poincare_parsing_parse,
+  quiz_case_poincare_parsing_matrices,
+  quiz_case_poincare_parsing_units,
+  quiz_case_poincare_parsing_identifiers,
+  quiz_case_poincare_parsing_reserved_names,
+  quiz_case_poincare_parsing_parse_store,
+  quiz_case_poincare_parsing_parse_unit_convert,
+  quiz_case_poincare_parsing_implicit_multiplication,
+  quiz_case_poincare_parsing_adding_missing_parentheses,
+  quiz_case_assert_print_floats,
+  quiz_case_poincare_print_int_left,
+  quiz_case_poincare_print_int_right,
+  quiz_case_poincare_rational_order,
+  quiz_case_poincare_rational_specific_properties,
+  quiz_case_poincare_rational_addition,
+  quiz_case_poincare_rational_power,
+  quiz_case_regularized_incomplete_beta_function,
+  quiz_case_poincare_simplification_based_integer,
+  quiz_case_poincare_simplification_decimal,
+  quiz_case_poincare_simplification_rational,
+  quiz_case_poincare_simplification_infinity,
+  quiz_case_poincare_simplification_addition,
+  quiz_case_poincare_simplification_multiplication,
+  quiz_case_poincare_simplification_units,
+  quiz_case_poincare_simplification_power,
+  quiz_case_poincare_simplification_factorial,
+  quiz_case_poincare_simplification_logarithm,
+  quiz_case_poincare_simplification_random,
+  quiz_case_poincare_simplification_randint,
+  quiz_case_poincare_simplification_function,
+  quiz_case_poincare_simplification_trigonometry_functions,
+  quiz_case_poincare_simplification_matrix,
+  quiz_case_poincare_simplification_functions_of_matrices,
+  quiz_case_poincare_simplification_store,
+  quiz_case_poincare_simplification_store_matrix,
+  quiz_case_poincare_simplification_unit_convert,
+  quiz_case_poincare_simplification_complex_format,
+  quiz_case_poincare_simplification_reduction_target,
+  quiz_case_poincare_simplification_unit_conversion,
+  quiz_case_poincare_simplification_user_function,
+  quiz_case_poincare_simplification_user_function_with_convert,
+  quiz_case_poincare_simplification_mix,
+  quiz_case_poincare_hyperbolic_trigonometry,
+  quiz_case_poincare_probability,
+  quiz_case_poincare_zoom_interesting_ranges,
+  quiz_case_poincare_zoom_refined_range,
+  quiz_case_poincare_zoom_range_with_ratio,
+  quiz_case_poincare_zoom_full_range,
+  quiz_case_poincare_zoom_utility,
+  quiz_case_python_basics,
+  quiz_case_python_template,
+  quiz_case_python_ion_import,
+  quiz_case_python_ion_keydown,
+  quiz_case_python_kandinsky_import,
+  quiz_case_python_kandinsky_basics,
+  quiz_case_python_math,
+  quiz_case_python_cmath,
+  quiz_case_python_random,
+  quiz_case_python_time,
+  quiz_case_python_turtle,
+  quiz_case_python_turtle_circle,
+  quiz_case_python_matplotlib_pyplot_import,
+  quiz_case_python_matplotlib_pyplot_arrow,
+  quiz_case_python_matplotlib_pyplot_axis,
+  quiz_case_python_matplotlib_pyplot_bar,
+  quiz_case_python_matplotlib_pyplot_grid,
+  quiz_case_python_matplotlib_pyplot_hist,
+  quiz_case_python_matplotlib_pyplot_plot,
+  quiz_case_python_matplotlib_pyplot_scatter,
+  quiz_case_python_matplotlib_pyplot_text,
+  quiz_case_python_ulab,
+  quiz_case_escher_clipboard_enters_and_exits_python,
+  quiz_case_escher_clipboard_stored_text_is_parseable,
+  quiz_case_escher_layout_field_select_left_right,
+  quiz_case_escher_layout_field_select_up_down,
+  quiz_case_escher_layout_field_unselect,
+  quiz_case_escher_layout_field_delete,
+  quiz_case_alignment_handling,
+  quiz_case_calculation_store,
+  quiz_case_calculation_ans,
+  quiz_case_calculation_significant_digits,
+  quiz_case_calculation_display_exact_approximate,
+  quiz_case_calculation_symbolic_computation,
+  quiz_case_calculation_symbolic_computation_and_parametered_expressions,
+  quiz_case_calculation_complex_format,
+  quiz_case_graph_caching,
+  quiz_case_graph_caching_accuracy,
+  quiz_case_graph_caching_passes,
+  quiz_case_graph_caching_pool,
+  quiz_case_graph_ranges_single_function,
+  quiz_case_graph_ranges_several_functions,
+  quiz_case_graph_ranges_zoom,
+  quiz_case_graph_ranges_orthonormal,
+  quiz_case_graph_stamp_precomputed_masks,
+  quiz_case_graph_stamp_benchmark,
+  quiz_case_variable_box_controller,
+  quiz_case_data_statistics,
+  quiz_case_hypergeometric_function,
+  quiz_case_binomial_distribution,
+  quiz_case_chi_squared_distribution,
+  quiz_case_student_distribution,
+  quiz_case_geometric_distribution,
+  quiz_case_fisher_distribution,
+  quiz_case_regularized_gamma,
+  quiz_case_equation_solve,
+  quiz_case_equation_solve_complex_real,
+  quiz_case_equation_solve_complex_cartesian,
+  quiz_case_equation_solve_complex_polar,
+  quiz_case_equation_and_symbolic_computation,
+  quiz_case_sequence_evaluation,
+  quiz_case_sequence_sum_evaluation,
+  quiz_case_linear_regression,
+  quiz_case_linear_regression2,
+  quiz_case_proportional_regression,
+  quiz_case_proportional_regression2,
+  quiz_case_proportional_regression3,
+  quiz_case_proportional_regression4,
+  quiz_case_proportional_regression5,
+  quiz_case_quadratic_regression,
+  quiz_case_cubic_regression,
+  quiz_case_quartic_regression,
+  quiz_case_logarithmic_regression,
+  quiz_case_exponential_regression,
+  quiz_case_exponential_regression2,
+  quiz_case_exponential_regression3,
+  quiz_case_power_regression,
+  quiz_case_trigonometric_regression1,
+  quiz_case_trigonometric_regression2,
+  quiz_case_logistic_regression,
+  quiz_case_column_calculation,
+  quiz_case_constant_column_calculation,
+  quiz_case_regression_calculation,
+  NULL
+};
+
+char * quiz_case_names[] = {
+  "ion_crc32",
+  "ion_events_from_keyboard",
+  "ion_keyboard",
+  "ion_storage_records_crc32",
+  "ion_storage_store_and_destroy_record",
+  "ion_storage_put_record_twice",
+  "ion_storage_invalid_renaming",
+  "ion_storage_valid_renaming",
+  "ion_storage_available_space_moving",
+  "ion_utf8_code_point_system_parentheses",
+  "ion_utf8_decode_forward",
+  "ion_utf8_decode_backwards",
+  "ion_utf8_decoder_next_glyph",
+  "ion_utf8_decoder_previous_glyph",
+  "ion_utf8_helper_count_occurrences",
+  "ion_utf8_helper_code_point_search",
+  "ion_utf8_helper_not_code_point_search",
+  "ion_utf8_copy_and_remove_code_point",
+  "ion_utf8_remove_code_point",
+  "ion_utf8_move_string_from_index_by_number_of_char",
+  "ion_utf8_try_and_replace_pattern_in_string_by_pattern",
+  "ion_utf8_helper_copy_until_code_point",
+  "ion_utf8_helper_previous_code_point_is",
+  "ion_utf8_helper_code_point_is",
+  "ion_utf8_helper_remove_previous_glyph",
+  "ion_utf8_code_point_at_glyph_offset",
+  "ion_utf8_glyph_offset_at_code_point",
+  "ion_utf8_helper_string_glyph_length",
+  "ion_utf8_helper_beginning_of_word",
+  "ion_utf8_helper_end_of_word",
+  "kandinsky_color_rgb",
+  "kandinsky_color_blend",
+  "kandinsky_context_copy_rect",
+  "kandinsky_font_index_for_code_point",
+  "kandinsky_antialiased_line_aligned",
+  "kandinsky_antialiased_line_symmetry",
+  "kandinsky_antialiased_line_clipping",
+  "kandinsky_rect_intersect",
+  "kandinsky_rect_union",
+  "kandinsky_rect_empty_union",
+  "kandinsky_rect_difference",
+  "tree_handle_are_discared_after_block",
+  "tree_handle_are_discared_after_function_call",
+  "tree_handle_can_be_copied",
+  "tree_handle_can_be_moved",
+  "tree_handle_can_be_returned",
+  "tree_handle_memory_failure",
+  "tree_handle_does_not_copy",
+  "poincare_approximation_decimal",
+  "poincare_approximation_based_integer",
+  "poincare_approximation_rational",
+  "poincare_approximation_float",
+  "poincare_approximation_infinity",
+  "poincare_approximation_addition",
+  "poincare_approximation_multiplication",
+  "poincare_approximation_power",
+  "poincare_approximation_subtraction",
+  "poincare_approximation_constant",
+  "poincare_approximation_division",
+  "poincare_approximation_logarithm",
+  "poincare_approximation_function",
+  "poincare_approximation_trigonometry_functions",
+  "poincare_approximation_matrix",
+  "poincare_approximation_store",
+  "poincare_approximation_store_matrix",
+  "poincare_approximation_complex_format",
+  "poincare_approximation_mix",
+  "poincare_arithmetic_gcd",
+  "poincare_arithmetic_lcm",
+  "poincare_arithmetic_factorization",
+  "poincare_arithmetic_factorization_benchmark",
+  "poincare_compiled_expression",
+  "poincare_compiled_expression_interval",
+  "poincare_compiled_expression_derivative",
+  "poincare_context_store_overwrite",
+  "poincare_context_store_do_not_overwrite",
+  "poincare_context_user_variable_simple",
+  "poincare_context_user_variable_2_circular_variables",
+  "poincare_context_user_variable_3_circular_variables",
+  "poincare_context_user_variable_1_circular_function",
+  "poincare_context_user_variable_2_circular_functions",
+  "poincare_context_user_variable_3_circular_functions",
+  "poincare_context_user_variable_circular_variables_and_functions",
+  "poincare_context_user_variable_composed_functions",
+  "poincare_context_user_variable_functions_approximation_with_value_for_symbol",
+  "poincare_context_user_variable_properties",
+  "erf_inv",
+  "poincare_dense_polynomial_build",
+  "poincare_dense_polynomial_roots",
+  "poincare_derivative_formal",
+  "poincare_derivative_approximation",
+  "poincare_expression_can_start_uninitialized",
+  "poincare_expression_can_be_copied_even_if_uninitialized",
+  "poincare_expression_cast_does_not_copy",
+  "poincare_expression_is_identical_to",
+  "poincare_expression_structural_hash",
+  "poincare_expression_decimal_constructor",
+  "poincare_expression_rational_constructor",
+  "poincare_expression_unit_constructor",
+  "poincare_expression_order_constant",
+  "poincare_expression_order_decimal",
+  "poincare_expression_order_rational",
+  "poincare_expression_order_float",
+  "poincare_expression_order_power",
+  "poincare_expression_order_symbol",
+  "poincare_expression_order_function",
+  "poincare_expression_order_mix",
+  "poincare_expression_order_addition_multiplication",
+  "poincare_expression_order_stable_sort",
+  "poincare_properties_is_number",
+  "poincare_properties_is_number_zero",
+  "poincare_properties_is_random",
+  "poincare_properties_is_parametered_expression",
+  "poincare_properties_is_approximate",
+  "poincare_properties_is_matrix",
+  "poincare_properties_deep_is_matrix",
+  "poincare_properties_descendant_properties",
+  "poincare_properties_is_infinity",
+  "poincare_properties_decimal_sign",
+  "poincare_properties_based_integer_sign",
+  "poincare_properties_rational_sign",
+  "poincare_properties_expression_sign",
+  "poincare_properties_sign",
+  "poincare_properties_is_real",
+  "poincare_properties_polynomial_degree",
+  "poincare_properties_get_variables",
+  "poincare_properties_get_polynomial_coefficients",
+  "poincare_properties_remove_unit",
+  "poincare_expression_additional_results",
+  "poincare_serialization_based_integer",
+  "poincare_serialization_rational",
+  "poincare_serialization_decimal",
+  "poincare_serialization_float",
+  "poincare_serialization_division",
+  "poincare_serialization_factorial",
+  "poincare_expression_to_layout",
+  "poincare_expression_to_layout_multiplication_operator",
+  "poincare_expression_to_layout_serializes_to_self",
+  "poincare_function_extremum",
+  "poincare_function_root",
+  "poincare_function_intersection",
+  "poincare_function_all_points_of_interest",
+  "poincare_helpers_gcd",
+  "poincare_helpers_insert_simple_swap",
+  "poincare_helpers_rotate",
+  "poincare_infinity_symbol",
+  "poincare_integer_constructor",
+  "poincare_integer_compare",
+  "poincare_integer_properties",
+  "poincare_integer_addition",
+  "poincare_integer_subtraction",
+  "poincare_integer_multiplication",
+  "poincare_integer_divide",
+  "poincare_integer_multiplication_and_division_benchmark",
+  "poincare_integer_pow",
+  "poincare_integer_factorial",
+  "poincare_integer_evaluate",
+  "poincare_integer_serialize",
+  "poincare_integer_euclidian_division",
+  "poincare_integer_mixed_fraction",
+  "poincare_layout_constructors",
+  "poincare_layout_comparison",
+  "poincare_layout_fraction_create",
+  "poincare_layout_power",
+  "poincare_layout_parentheses_size",
+  "poincare_layout_cursor_computation",
+  "poincare_layout_cursor_delete",
+  "poincare_layout_serialization",
+  "poincare_layout_to_expression_unparsable",
+  "poincare_layout_to_expression_parsable",
+  "poincare_parsing_tokenize_numbers",
+  "poincare_parsing_memory_exhaustion",
+  "poincare_parsing_parse_numbers",
+  "poincare_parsing_parse",
+  "poincare_parsing_matrices",
+  "poincare_parsing_units",
+  "poincare_parsing_identifiers",
+  "poincare_parsing_reserved_names",
+  "poincare_parsing_parse_store",
+  "poincare_parsing_parse_unit_convert",
+  "poincare_parsing_implicit_multiplication",
+  "poincare_parsing_adding_missing_parentheses",
+  "assert_print_floats",
+  "poincare_print_int_left",
+  "poincare_print_int_right",
+  "poincare_rational_order",
+  "poincare_rational_specific_properties",
+  "poincare_rational_addition",
+  "poincare_rational_power",
+  "regularized_incomplete_beta_function",
+  "poincare_simplification_based_integer",
+  "poincare_simplification_decimal",
+  "poincare_simplification_rational",
+  "poincare_simplification_infinity",
+  "poincare_simplification_addition",
+  "poincare_simplification_multiplication",
+  "poincare_simplification_units",
+  "poincare_simplification_power",
+  "poincare_simplification_factorial",
+  "poincare_simplification_logarithm",
+  "poincare_simplification_random",
+  "poincare_simplification_randint",
+  "poincare_simplification_function",
+  "poincare_simplification_trigonometry_functions",
+  "poincare_simplification_matrix",
+  "poincare_simplification_functions_of_matrices",
+  "poincare_simplification_store",
+  "poincare_simplification_store_matrix",
+  "poincare_simplification_unit_convert",
+  "poincare_simplification_complex_format",
+  "poincare_simplification_reduction_target",
+  "poincare_simplification_unit_conversion",
+  "poincare_simplification_user_function",
+  "poincare_simplification_user_function_with_convert",
+  "poincare_simplification_mix",
+  "poincare_hyperbolic_trigonometry",
+  "poincare_probability",
+  "poincare_zoom_interesting_ranges",
+  "poincare_zoom_refined_range",
+  "poincare_zoom_range_with_ratio",
+  "poincare_zoom_full_range",
+  "poincare_zoom_utility",
+  "python_basics",
+  "python_template",
+  "python_ion_import",
+  "python_ion_keydown",
+  "python_kandinsky_import",
+  "python_kandinsky_basics",
+  "python_math",
+  "python_cmath",
+  "python_random",
+  "python_time",
+  "python_turtle",
+  "python_turtle_circle",
+  "python_matplotlib_pyplot_import",
+  "python_matplotlib_pyplot_arrow",
+  "python_matplotlib_pyplot_axis",
+  "python_matplotlib_pyplot_bar",
+  "python_matplotlib_pyplot_grid",
+  "python_matplotlib_pyplot_hist",
+  "python_matplotlib_pyplot_plot",
+  "python_matplotlib_pyplot_scatter",
+  "python_matplotlib_pyplot_text",
+  "python_ulab",
+  "escher_clipboard_enters_and_exits_python",
+  "escher_clipboard_stored_text_is_parseable",
+  "escher_layout_field_select_left_right",
+  "escher_layout_field_select_up_down",
+  "escher_layout_field_unselect",
+  "escher_layout_field_delete",
+  "alignment_handling",
+  "calculation_store",
+  "calculation_ans",
+  "calculation_significant_digits",
+  "calculation_display_exact_approximate",
+  "calculation_symbolic_computation",
+  "calculation_symbolic_computation_and_parametered_expressions",
+  "calculation_complex_format",
+  "graph_caching",
+  "graph_caching_accuracy",
+  "graph_caching_passes",
+  "graph_caching_pool",
+  "graph_ranges_single_function",
+  "graph_ranges_several_functions",
+  "graph_ranges_zoom",
+  "graph_ranges_orthonormal",
+  "graph_stamp_precomputed_masks",
+  "graph_stamp_benchmark",
+  "variable_box_controller",
+  "data_statistics",
+  "hypergeometric_function",
+  "binomial_distribution",
+  "chi_squared_distribution",
+  "student_distribution",
+  "geometric_distribution",
+  "fisher_distribution",
+  "regularized_gamma",
+  "equation_solve",
+  "equation_solve_complex_real",
+  "equation_solve_complex_cartesian",
+  "equation_solve_complex_polar",
+  "equation_and_symbolic_computation",
+  "sequence_evaluation",
+  "sequence_sum_evaluation",
+  "linear_regression",
+  "linear_regression2",
+  "proportional_regression",
+  "proportional_regression2",
+  "proportional_regression3",
+  "proportional_regression4",
+  "proportional_regression5",
+  "quadratic_regression",
+  "cubic_regression",
+  "quartic_regression",
+  "logarithmic_regression",
+  "exponential_regression",
+  "exponential_regression2",
+  "exponential_regression3",
+  "power_regression",
+  "trigonometric_regression1",
+  "trigonometric_regression2",
+  "logistic_regression",
+  "column_calculation",
+  "constant_column_calculation",
+  "regression_calculation",
+  NULL
+};
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "logo_icon.h"
+
+// Compressed 3680 pixels into 1275 bytes (17.32% compression ratio)/
+const uint8_t compressedPixelData[1275] = {0x0011, 0x00ff, 0x0001, 0x0000, 0x0020, 0x007c, 0x00be, 0x0002, 0x0000, 0x003f, 0x007e, 0x00e7, 0x00ff, 0x0001, 0x0000, 0x0004, 0x0020, 0x003e, 0x00df, 0x0020, 0x0000, 0x003f, 0x00bd, 0x00c6, 0x00ff, 0x0001, 0x0000, 0x0040, 0x0020, 0x00bd, 0x00c6, 0x005c, 0x0000, 0x0022, 0x00bf, 0x00ef, 0x000e, 0x0000, 0x0022, 0x00df, 0x00f7, 0x008c, 0x0000, 0x000f, 0x006a, 0x0000, 0x0041, 0x008f, 0x003a, 0x0085, 0x0019, 0x007d, 0x0019, 0x007d, 0x00fd, 0x00d6, 0x0020, 0x0000, 0x0005, 0x0020, 0x009c, 0x00be, 0x0020, 0x0000, 0x002f, 0x009a, 0x0095, 0x007c, 0x0000, 0x0041, 0x0020, 0x007a, 0x0095, 0x005c, 0x0000, 0x0013, 0x005e, 0x0062, 0x0001, 0x0020, 0x00bf, 0x00ef, 0x000e, 0x0000, 0x002f, 0x003a, 0x0085, 0x00e6, 0x0000, 0x00ff, 0x00ff, 0x008b, 0x000a, 0x0001, 0x0000, 0x000f, 0x00e6, 0x0000, 0x00ff, 0x00ff, 0x0049, 0x0060, 0x003c, 0x00b6, 0x003c, 0x00b6, 0x009c, 0x00c6, 0x00fa, 0x0005, 0x0040, 0x009c, 0x00be, 0x009a, 0x0095, 0x0040, 0x0000, 0x006e, 0x007a, 0x008d, 0x001b, 0x00ae, 0x005e, 0x00e7, 0x003c, 0x0000, 0x0080, 0x009f, 0x00ef, 0x007c, 0x00be, 0x00bb, 0x009d, 0x003a, 0x0085, 0x00bc, 0x0000, 0x006a, 0x007a, 0x0095, 0x003c, 0x00ae, 0x001e, 0x00df, 0x0020, 0x0000, 0x0020, 0x007c, 0x00be, 0x004c, 0x0000, 0x002e, 0x009f, 0x00ef, 0x00e6, 0x0000, 0x000a, 0x00cc, 0x0006, 0x00ec, 0x001b, 0x00ae, 0x007a, 0x008d, 0x0039, 0x0085, 0x0019, 0x007d, 0x005a, 0x008d, 0x00fb, 0x00a5, 0x00dd, 0x00ce, 0x0020, 0x0000, 0x0020, 0x00dd, 0x00ce, 0x0046, 0x0000, 0x0071, 0x00df, 0x00f7, 0x00ff, 0x00ff, 0x005e, 0x00e7, 0x003c, 0x002a, 0x0000, 0x0055, 0x0039, 0x0085, 0x007a, 0x0095, 0x005c, 0x0058, 0x0000, 0x000f, 0x00e6, 0x0000, 0x0023, 0x0000, 0x0010, 0x0000, 0x0088, 0x00bb, 0x009d, 0x007e, 0x00ef, 0x007a, 0x008d, 0x0019, 0x007d, 0x0002, 0x0000, 0x002c, 0x005c, 0x00b6, 0x007e, 0x0000, 0x002a, 0x0039, 0x0085, 0x0022, 0x0000, 0x0000, 0x0038, 0x0000, 0x002f, 0x00bf, 0x00f7, 0x007e, 0x0004, 0x0019, 0x004c, 0x00bf, 0x00f7, 0x00db, 0x009d, 0x0044, 0x0000, 0x0039, 0x007a, 0x008d, 0x003e, 0x002e, 0x0001, 0x0020, 0x001b, 0x00ae, 0x0016, 0x0000, 0x004a, 0x00bf, 0x00f7, 0x007c, 0x00be, 0x0028, 0x0000, 0x004f, 0x0039, 0x0085, 0x00dd, 0x00ce, 0x00e6, 0x0000, 0x002b, 0x0040, 0x007a, 0x008d, 0x007a, 0x008d, 0x0048, 0x0000, 0x0073, 0x003c, 0x00ae, 0x00bd, 0x00ce, 0x009d, 0x00c6, 0x00bb, 0x008a, 0x0000, 0x0026, 0x001b, 0x00ae, 0x0026, 0x0000, 0x0022, 0x001e, 0x00df, 0x0094, 0x0000, 0x0000, 0x00c4, 0x0001, 0x0064, 0x007c, 0x00be, 0x005c, 0x00b6, 0x00bb, 0x009d, 0x00e8, 0x0000, 0x000f, 0x00e6, 0x0000, 0x0017, 0x0033, 0x00bf, 0x00f7, 0x005a, 0x004a, 0x0001, 0x00a2, 0x00ba, 0x0095, 0x005c, 0x00b6, 0x005c, 0x00b6, 0x00fb, 0x00a5, 0x0039, 0x0085, 0x00c0, 0x0000, 0x002c, 0x001d, 0x00d7, 0x00e6, 0x0000, 0x0042, 0x003c, 0x00b6, 0x0019, 0x007d, 0x00ee, 0x0001, 0x0031, 0x00fb, 0x00a5, 0x009a, 0x0058, 0x0000, 0x0008, 0x005c, 0x0000, 0x000f, 0x00e6, 0x0000, 0x0023, 0x0002, 0x00ea, 0x0000, 0x0026, 0x007e, 0x00ef, 0x00c6, 0x0008, 0x002a, 0x0019, 0x007d, 0x0048, 0x0000, 0x0002, 0x006a, 0x0000, 0x0017, 0x009c, 0x0034, 0x0009, 0x0031, 0x00fd, 0x00d6, 0x0019, 0x006c, 0x0000, 0x002f, 0x001d, 0x00d7, 0x00e6, 0x0000, 0x0015, 0x0002, 0x0044, 0x0000, 0x0017, 0x005a, 0x00bc, 0x0001, 0x0042, 0x009f, 0x00ef, 0x00bb, 0x009d, 0x0026, 0x0000, 0x002a, 0x007e, 0x00ef, 0x00e6, 0x0000, 0x0000, 0x00fc, 0x0000, 0x0006, 0x00a2, 0x0009, 0x0022, 0x001d, 0x00d7, 0x00d8, 0x0000, 0x002f, 0x00fb, 0x00a5, 0x00e6, 0x0000, 0x002b, 0x004a, 0x003a, 0x0085, 0x009e, 0x00ef, 0x0064, 0x0003, 0x0008, 0x0028, 0x0000, 0x0022, 0x00bf, 0x00f7, 0x00a0, 0x0000, 0x000a, 0x004c, 0x0000, 0x0022, 0x005c, 0x00b6, 0x0076, 0x0001, 0x000f, 0x00e6, 0x0000, 0x0013, 0x0022, 0x00fd, 0x00ce, 0x00bc, 0x0000, 0x000a, 0x007e, 0x000a, 0x0013, 0x00df, 0x00fc, 0x0000, 0x002c, 0x00fb, 0x00a5, 0x00e6, 0x0000, 0x002a, 0x00fd, 0x00ce, 0x003e, 0x000a, 0x0008, 0x004e, 0x0000, 0x000f, 0x00e6, 0x0000, 0x0025, 0x000c, 0x0070, 0x000a, 0x0013, 0x00df, 0x004a, 0x0000, 0x0022, 0x007e, 0x00ef, 0x0074, 0x0001, 0x0001, 0x00e6, 0x0000, 0x001a, 0x0085, 0x006f, 0x0004, 0x008f, 0x009e, 0x00ef, 0x00dd, 0x00ce, 0x003e, 0x00df, 0x00bf, 0x00f7, 0x00e6, 0x0000, 0x0013, 0x0002, 0x00b6, 0x0001, 0x000e, 0x00d8, 0x000a, 0x0013, 0x005e, 0x000c, 0x0003, 0x0028, 0x00bf, 0x00ef, 0x00e6, 0x0000, 0x002c, 0x007a, 0x008d, 0x00fa, 0x0004, 0x0002, 0x0026, 0x0000, 0x000f, 0x00e6, 0x0000, 0x002b, 0x0006, 0x0032, 0x0002, 0x0005, 0x0054, 0x0001, 0x0010, 0x00a6, 0x0018, 0x0000, 0x0028, 0x009d, 0x00c6, 0x0058, 0x0000, 0x004f, 0x00db, 0x009d, 0x005e, 0x00e7, 0x00fc, 0x0008, 0x0023, 0x0037, 0x00df, 0x00ff, 0x0019, 0x0036, 0x0001, 0x000e, 0x0038, 0x0000, 0x0006, 0x00bc, 0x0001, 0x0004, 0x0098, 0x0003, 0x000c, 0x0026, 0x0000, 0x000f, 0x00e6, 0x0000, 0x002f, 0x000f, 0x00d6, 0x0006, 0x0001, 0x0021, 0x009c, 0x00c6, 0x006e, 0x0000, 0x0018, 0x00ae, 0x009e, 0x0002, 0x0002, 0x00b8, 0x0002, 0x005f, 0x003c, 0x00ae, 0x001d, 0x00d7, 0x00df, 0x00e6, 0x0000, 0x001c, 0x002e, 0x005e, 0x00e7, 0x003e, 0x0007, 0x000a, 0x00a4, 0x0002, 0x0028, 0x005c, 0x00b6, 0x000e, 0x0000, 0x002e, 0x009c, 0x00c6, 0x0024, 0x0007, 0x0006, 0x00e6, 0x0000, 0x0011, 0x005a, 0x000c, 0x0000, 0x000e, 0x0086, 0x0006, 0x000a, 0x0070, 0x0003, 0x0008, 0x001a, 0x0005, 0x000e, 0x0026, 0x0008, 0x0004, 0x003a, 0x0006, 0x0001, 0x00be, 0x0001, 0x0005, 0x0030, 0x0003, 0x0028, 0x00db, 0x00a5, 0x00d8, 0x0005, 0x008f, 0x003a, 0x0085, 0x00fb, 0x00a5, 0x00fd, 0x00ce, 0x00df, 0x00f7, 0x00e6, 0x0000, 0x0015, 0x0022, 0x001e, 0x00df, 0x00a2, 0x0005, 0x000f, 0x0094, 0x0000, 0x0007, 0x0028, 0x003c, 0x00ae, 0x00e6, 0x0000, 0x001f, 0x00bd, 0x00e6, 0x0000, 0x000a, 0x002e, 0x007a, 0x0095, 0x0024, 0x0000, 0x000e, 0x0032, 0x0004, 0x002c, 0x00fb, 0x00a5, 0x0030, 0x0007, 0x000e, 0x002a, 0x0000, 0x002c, 0x00fd, 0x00d6, 0x001a, 0x0000, 0x0024, 0x00fd, 0x00ce, 0x0040, 0x0006, 0x0006, 0x00ec, 0x0000, 0x002f, 0x007c, 0x00be, 0x00e6, 0x0000, 0x0013, 0x0022, 0x00fd, 0x00d6, 0x0042, 0x0006, 0x000f, 0x0060, 0x0002, 0x0007, 0x0019, 0x001b, 0x00e6, 0x0000, 0x000e, 0x00a8, 0x0001, 0x0008, 0x00e6, 0x0000, 0x0002, 0x0088, 0x0000, 0x001e, 0x009c, 0x00bc, 0x000e, 0x0009, 0x001e, 0x0002, 0x002f, 0x001b, 0x00ae, 0x00cc, 0x0001, 0x0015, 0x002c, 0x00fb, 0x00a5, 0x0006, 0x0004, 0x006e, 0x00dd, 0x00ce, 0x00fb, 0x00a5, 0x003a, 0x0085, 0x003e, 0x0008, 0x000f, 0x00cc, 0x0001, 0x000c, 0x001f, 0x00d7, 0x00cc, 0x0001, 0x000d, 0x002f, 0x005c, 0x00b6, 0x00e6, 0x0000, 0x0017, 0x002c, 0x00fb, 0x00a5, 0x00c6, 0x0000, 0x000a, 0x0001, 0x0000, 0x002c, 0x009a, 0x0095, 0x00d8, 0x0008, 0x000e, 0x0024, 0x0006, 0x0009, 0x0048, 0x0002, 0x000d, 0x0006, 0x0004, 0x0004, 0x001a, 0x0005, 0x0023, 0x005c, 0x00b6, 0x00ec, 0x0000, 0x003f, 0x0085, 0x009f, 0x00ef, 0x0098, 0x0003, 0x0031, 0x002f, 0x009c, 0x00be, 0x00e6, 0x0000, 0x0017, 0x002f, 0x007c, 0x00be, 0x00b6, 0x0000, 0x0005, 0x0006, 0x00f8, 0x0006, 0x000a, 0x0044, 0x0000, 0x0003, 0x00c8, 0x0005, 0x001c, 0x00f7, 0x002c, 0x0000, 0x002a, 0x00db, 0x009d, 0x002a, 0x0000, 0x003b, 0x007e, 0x00e7, 0x00bf, 0x0020, 0x0005, 0x002a, 0x007e, 0x00ef, 0x00ec, 0x0004, 0x000f, 0x0064, 0x0005, 0x0012, 0x002e, 0x00e7, 0x00ff, 0x00b6, 0x0004, 0x0018, 0x008d, 0x006a, 0x0000, 0x000f, 0x00e6, 0x0000, 0x0011, 0x002e, 0x003e, 0x00df, 0x00c8, 0x0000, 0x000c, 0x00a0, 0x0001, 0x000a, 0x00d4, 0x0000, 0x002e, 0x0019, 0x007d, 0x00ca, 0x0003, 0x0001, 0x0010, 0x0001, 0x0016, 0x0085, 0x002a, 0x0000, 0x000f, 0x00d8, 0x0001, 0x0005, 0x0019, 0x00bb, 0x000a, 0x0001, 0x000f, 0x0030, 0x0007, 0x0011, 0x000c, 0x001e, 0x000b, 0x0006, 0x00b2, 0x0000, 0x002f, 0x009f, 0x00ef, 0x00e6, 0x0000, 0x0017, 0x0004, 0x001a, 0x0001, 0x002a, 0x005a, 0x0085, 0x0004, 0x000b, 0x0002, 0x00e8, 0x0004, 0x002e, 0x0039, 0x0085, 0x006c, 0x0003, 0x0004, 0x0020, 0x0006, 0x002e, 0x00bf, 0x00f7, 0x002e, 0x0007, 0x0024, 0x00fb, 0x00a5, 0x0062, 0x0009, 0x0002, 0x0024, 0x0000, 0x000a, 0x0054, 0x0005, 0x0013, 0x00df, 0x00d2, 0x0005, 0x002f, 0x005e, 0x00df, 0x00fc, 0x0008, 0x002f, 0x0015, 0x00db, 0x00e6, 0x0004, 0x000f, 0x00e6, 0x0000, 0x0013, 0x0002, 0x0092, 0x0000, 0x0000, 0x0030, 0x0003, 0x0024, 0x001b, 0x00ae, 0x009a, 0x0008, 0x006e, 0x00bf, 0x00f7, 0x001d, 0x00d7, 0x001b, 0x00a6, 0x00cc, 0x0009, 0x0008, 0x00c8, 0x000a, 0x0044, 0x009a, 0x0095, 0x009f, 0x00ef, 0x007a, 0x0000, 0x002c, 0x003c, 0x00ae, 0x0092, 0x0000, 0x0002, 0x003c, 0x0001, 0x0017, 0x00db, 0x0084, 0x000c, 0x0013, 0x00df, 0x0090, 0x0000, 0x002f, 0x009a, 0x0095, 0x00c8, 0x000a, 0x0015, 0x001f, 0x00bb, 0x00c8, 0x000a, 0x0006, 0x0008, 0x006a, 0x0000, 0x000f, 0x00e6, 0x0000, 0x0013, 0x002c, 0x00ff, 0x00ff, 0x00b4, 0x000c, 0x000a, 0x00c0, 0x000c, 0x000c, 0x0016, 0x000e, 0x0004, 0x00fc, 0x0000, 0x0000, 0x001c, 0x0000, 0x008e, 0x00fb, 0x00a5, 0x007c, 0x00be, 0x003c, 0x00ae, 0x005a, 0x008d, 0x00f6, 0x0002, 0x0024, 0x001e, 0x00df, 0x0040, 0x0000, 0x0031, 0x00db, 0x00a5, 0x003c, 0x0050, 0x000c, 0x0013, 0x005a, 0x0050, 0x000c, 0x002f, 0x003e, 0x00df, 0x00e6, 0x0000, 0x0015, 0x002e, 0x009f, 0x00ef, 0x0094, 0x000c, 0x0002, 0x0090, 0x0001, 0x0008, 0x00b4, 0x000a, 0x000f, 0x00e6, 0x0000, 0x0015, 0x0000, 0x009e, 0x0006, 0x001b, 0x005a, 0x002e, 0x000e, 0x0004, 0x00b0, 0x0001, 0x000e, 0x00fe, 0x0003, 0x0002, 0x001a, 0x0000, 0x004a, 0x003e, 0x00df, 0x005a, 0x008d, 0x000a, 0x0007, 0x002c, 0x00fd, 0x00d6, 0x0040, 0x0007, 0x002f, 0x003a, 0x0085, 0x001c, 0x000e, 0x000b, 0x000f, 0x0060, 0x000e, 0x0039, 0x000f, 0x00e6, 0x0000, 0x0011, 0x0002, 0x0096, 0x0000, 0x0022, 0x001b, 0x00ae, 0x00fc, 0x000f, 0x0000, 0x006c, 0x0000, 0x004e, 0x00ba, 0x0095, 0x003c, 0x00b6, 0x00aa, 0x0003, 0x0006, 0x00e6, 0x0000, 0x0020, 0x00df, 0x00f7, 0x0026, 0x0016, 0x00aa, 0x009a, 0x0095, 0x0039, 0x0085, 0x003a, 0x0085, 0x00bb, 0x0095, 0x00bd, 0x00c6, 0x0082, 0x0003, 0x0004, 0x00a4, 0x0000, 0x0070, 0x009d, 0x00c6, 0x00db, 0x009d, 0x005a, 0x008d, 0x0019, 0x00be, 0x000f, 0x0001, 0x00e8, 0x000f, 0x001f, 0x00df, 0x002c, 0x0010, 0x0008, 0x0020, 0x00df, 0x00f7, 0x000e, 0x0000, 0x000f, 0x006e, 0x0004, 0x0001, 0x00c8, 0x003c, 0x00ae, 0x007a, 0x0095, 0x003a, 0x0085, 0x0039, 0x0085, 0x009a, 0x0095, 0x00fb, 0x00a5, 0x005a, 0x000e, 0x0008, 0x002c, 0x0010, 0x002e, 0x003e, 0x00df, 0x00d0, 0x0008, 0x0000, 0x0018, 0x0000, 0x000f, 0x0044, 0x0011, 0x0025, 0x0004, 0x00e6, 0x0000, 0x001f, 0x00ff, 0x0001, 0x0000, 0x00ca, 0x000f, 0x00e6, 0x0000, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x0032, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(115, 32, compressedPixelData, 1275);
+
+const Image * ImageStore::LogoIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calcul4_icon.h"
+
+// Compressed 897 pixels into 346 bytes (19.29% compression ratio)/
+const uint8_t compressedPixelData[346] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x00aa, 0x00bf, 0x00df, 0x00ff, 0x005c, 0x00b6, 0x005a, 0x0085, 0x005a, 0x0085, 0x005c, 0x00b6, 0x00df, 0x004e, 0x0000, 0x0030, 0x00cf, 0x00db, 0x009d, 0x007a, 0x0095, 0x00fd, 0x00d6, 0x00fd, 0x00d6, 0x007a, 0x0095, 0x00db, 0x009d, 0x004c, 0x0000, 0x002d, 0x0060, 0x009d, 0x00c6, 0x007a, 0x008d, 0x00bf, 0x00f7, 0x000a, 0x0000, 0x006f, 0x00bf, 0x00ef, 0x003a, 0x0085, 0x00bd, 0x00c6, 0x00e6, 0x0000, 0x002a, 0x0045, 0x00f7, 0x003a, 0x0085, 0x001e, 0x00e1, 0x0000, 0x004f, 0x00ba, 0x0095, 0x003a, 0x0085, 0x00ee, 0x0000, 0x0029, 0x0028, 0x00bd, 0x00c6, 0x00de, 0x0000, 0x004f, 0x00ba, 0x0095, 0x005a, 0x008d, 0x009e, 0x0000, 0x0029, 0x0048, 0x009a, 0x0095, 0x00fd, 0x00d6, 0x004e, 0x0000, 0x004f, 0x005c, 0x00b6, 0x009a, 0x0095, 0x004c, 0x0000, 0x0025, 0x0068, 0x007e, 0x00ef, 0x003a, 0x0085, 0x00ff, 0x00ff, 0x004e, 0x0000, 0x006f, 0x005e, 0x00e7, 0x003a, 0x0085, 0x009e, 0x00ef, 0x00e8, 0x0000, 0x0025, 0x002a, 0x001b, 0x00ae, 0x004e, 0x0000, 0x004f, 0x007e, 0x00e7, 0x00fb, 0x00a5, 0x00ec, 0x0000, 0x0025, 0x004c, 0x00db, 0x00a5, 0x00dd, 0x00ce, 0x004e, 0x0000, 0x004f, 0x00dd, 0x00ce, 0x00fb, 0x00a5, 0x00b6, 0x0002, 0x0023, 0x004c, 0x003a, 0x0085, 0x00bf, 0x00f7, 0x004e, 0x0000, 0x002f, 0x00bf, 0x00f7, 0x00d8, 0x0001, 0x0023, 0x002c, 0x001e, 0x00d7, 0x0072, 0x0001, 0x0000, 0x004e, 0x0000, 0x0000, 0x009a, 0x0001, 0x001f, 0x001e, 0x004f, 0x0000, 0x0020, 0x004f, 0x00fb, 0x00a5, 0x009d, 0x00c6, 0x004e, 0x0000, 0x0001, 0x002f, 0x009c, 0x00c6, 0x00ec, 0x0000, 0x001f, 0x006f, 0x007e, 0x00e7, 0x003a, 0x0085, 0x00df, 0x00f7, 0x004e, 0x0000, 0x0001, 0x0000, 0x00ec, 0x0000, 0x002f, 0x007e, 0x00e7, 0x004e, 0x0000, 0x001b, 0x002e, 0x00ba, 0x0095, 0x00bc, 0x0001, 0x0002, 0x004e, 0x0000, 0x0000, 0x006e, 0x0003, 0x001f, 0x00bb, 0x00b2, 0x0003, 0x001a, 0x002e, 0x001b, 0x00a6, 0x00e2, 0x0003, 0x0006, 0x004e, 0x0000, 0x0000, 0x000a, 0x0004, 0x002f, 0x001b, 0x00ae, 0x009c, 0x0003, 0x0015, 0x004e, 0x00db, 0x00a5, 0x00db, 0x00a5, 0x0069, 0x0001, 0x0008, 0x004e, 0x0000, 0x006c, 0x00df, 0x00ff, 0x00db, 0x009d, 0x00db, 0x00a5, 0x000a, 0x0001, 0x000e, 0x0001, 0x0000, 0x006f, 0x00dd, 0x00ce, 0x005a, 0x008d, 0x003c, 0x00b6, 0x00fe, 0x0000, 0x0005, 0x0008, 0x0030, 0x0001, 0x004a, 0x003c, 0x00ae, 0x005a, 0x008d, 0x0090, 0x0002, 0x0008, 0x0092, 0x0000, 0x00af, 0x003e, 0x00df, 0x007c, 0x00be, 0x005a, 0x008d, 0x00bb, 0x009d, 0x005e, 0x00e7, 0x004c, 0x0001, 0x0007, 0x000a, 0x007e, 0x0001, 0x00ac, 0x005e, 0x00df, 0x00bb, 0x009d, 0x005a, 0x008d, 0x007c, 0x00be, 0x003e, 0x00df, 0x00a6, 0x0000, 0x006e, 0x005a, 0x0085, 0x00bb, 0x009d, 0x007c, 0x00be, 0x00ac, 0x0001, 0x000e, 0x004e, 0x0000, 0x000c, 0x00fc, 0x0001, 0x006f, 0x007c, 0x00be, 0x00bb, 0x009d, 0x005a, 0x0085, 0x003f, 0x0006, 0x008a, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(39, 23, compressedPixelData, 346);
+
+const Image * ImageStore::Calcul4Icon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_calcul3_icon.h"
+
+// Compressed 897 pixels into 324 bytes (18.06% compression ratio)/
+const uint8_t compressedPixelData[324] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x00a9, 0x00af, 0x007b, 0x00c6, 0x007a, 0x0095, 0x0019, 0x0085, 0x007a, 0x008d, 0x007b, 0x00c6, 0x004c, 0x0000, 0x0031, 0x00af, 0x0019, 0x0085, 0x001a, 0x00ae, 0x00da, 0x00a5, 0x0019, 0x007d, 0x0019, 0x0085, 0x0050, 0x0000, 0x002d, 0x00ff, 0x0003, 0x00db, 0x00de, 0x0039, 0x0085, 0x003b, 0x00be, 0x001c, 0x00e7, 0x001a, 0x00ae, 0x0019, 0x007d, 0x0019, 0x007d, 0x0039, 0x0085, 0x00fb, 0x00de, 0x004e, 0x0000, 0x0029, 0x0064, 0x00fa, 0x00ad, 0x009a, 0x0095, 0x001c, 0x00e7, 0x004e, 0x0000, 0x004f, 0x0019, 0x007d, 0x001a, 0x00ae, 0x004c, 0x0000, 0x0027, 0x0068, 0x00fb, 0x00de, 0x003a, 0x0085, 0x009b, 0x00ce, 0x004e, 0x0000, 0x000f, 0x009e, 0x0000, 0x0029, 0x0068, 0x005b, 0x00be, 0x007a, 0x008d, 0x001c, 0x00e7, 0x004e, 0x0000, 0x002f, 0x0019, 0x007d, 0x003c, 0x0001, 0x0027, 0x004c, 0x00ba, 0x009d, 0x003b, 0x00b6, 0x004e, 0x0000, 0x002f, 0x00ba, 0x00a5, 0x00e8, 0x0000, 0x0025, 0x004c, 0x0039, 0x0085, 0x00bb, 0x00d6, 0x004e, 0x0000, 0x003f, 0x0039, 0x0085, 0x00fc, 0x00ec, 0x0000, 0x0022, 0x0033, 0x009b, 0x00ce, 0x005a, 0x00e8, 0x0000, 0x0008, 0x004e, 0x0000, 0x004f, 0x0019, 0x007d, 0x009b, 0x00ce, 0x004e, 0x0000, 0x0021, 0x0000, 0x0066, 0x0002, 0x000e, 0x004e, 0x0000, 0x000f, 0x00d8, 0x0001, 0x0025, 0x0026, 0x007a, 0x0095, 0x0072, 0x0001, 0x0008, 0x004e, 0x0000, 0x002f, 0x007a, 0x0095, 0x004c, 0x0000, 0x001f, 0x0028, 0x00bb, 0x00ce, 0x000e, 0x0002, 0x0008, 0x004e, 0x0000, 0x004f, 0x0019, 0x007d, 0x00bb, 0x00ce, 0x00d0, 0x0001, 0x001f, 0x0028, 0x00fa, 0x00ad, 0x00f6, 0x0000, 0x0008, 0x004e, 0x0000, 0x002f, 0x00ba, 0x009d, 0x006a, 0x0002, 0x001d, 0x0019, 0x005a, 0x00a8, 0x0002, 0x000a, 0x004e, 0x0000, 0x004f, 0x0019, 0x007d, 0x005b, 0x00c6, 0x00ce, 0x0001, 0x0018, 0x002b, 0x00c6, 0x0039, 0x00e2, 0x0003, 0x000c, 0x004e, 0x0000, 0x0013, 0x0039, 0x0024, 0x0003, 0x000f, 0x0098, 0x0000, 0x0011, 0x000c, 0x004c, 0x0000, 0x000e, 0x004e, 0x0000, 0x0000, 0x0050, 0x0000, 0x002f, 0x005b, 0x00be, 0x007c, 0x0001, 0x000e, 0x005e, 0x00d6, 0x00ba, 0x009d, 0x005a, 0x008d, 0x0078, 0x0000, 0x000e, 0x004e, 0x0000, 0x0002, 0x0040, 0x0001, 0x0004, 0x00de, 0x0002, 0x000a, 0x0002, 0x0000, 0x00ce, 0x00fc, 0x00de, 0x00bb, 0x00d6, 0x003b, 0x00be, 0x009a, 0x009d, 0x0039, 0x0085, 0x00fa, 0x00ad, 0x00d8, 0x0003, 0x000e, 0x004e, 0x0000, 0x0006, 0x0002, 0x0000, 0x006a, 0x009a, 0x009d, 0x003b, 0x00be, 0x00bb, 0x00d6, 0x0020, 0x0003, 0x008e, 0x001a, 0x00b6, 0x005a, 0x008d, 0x00ba, 0x00a5, 0x005b, 0x00be, 0x0022, 0x0004, 0x000f, 0x004e, 0x0000, 0x000d, 0x000e, 0x00aa, 0x0004, 0x000f, 0x0002, 0x0000, 0x0080, 0x0050, 0x00e7, 0x001c, 0x00e7, 0x001c, 0x00e7, 
+};
+
+constexpr Image image = Image(39, 23, compressedPixelData, 324);
+
+const Image * ImageStore::FocusedCalcul3Icon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_fisher_icon.h"
+
+// Compressed 665 pixels into 216 bytes (16.24% compression ratio)/
+const uint8_t compressedPixelData[216] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x00c3, 0x006f, 0x00da, 0x00a5, 0x009a, 0x0095, 0x00fb, 0x00de, 0x0044, 0x0000, 0x002b, 0x008f, 0x00bb, 0x00d6, 0x0019, 0x007d, 0x0019, 0x007d, 0x007b, 0x00c6, 0x0046, 0x0000, 0x002b, 0x0020, 0x00fa, 0x00ad, 0x0046, 0x0000, 0x002f, 0x00fa, 0x00a5, 0x0046, 0x0000, 0x002b, 0x0020, 0x007a, 0x008d, 0x0046, 0x0000, 0x002f, 0x005a, 0x008d, 0x00d4, 0x0000, 0x0029, 0x0011, 0x00db, 0x00d0, 0x0000, 0x000f, 0x00d4, 0x0000, 0x002d, 0x0024, 0x005b, 0x00be, 0x0046, 0x0000, 0x004f, 0x009a, 0x0095, 0x001c, 0x00df, 0x0016, 0x0001, 0x002b, 0x0002, 0x0002, 0x0000, 0x002f, 0x005b, 0x00be, 0x0046, 0x0000, 0x0025, 0x0026, 0x009a, 0x0095, 0x0046, 0x0000, 0x004f, 0x0039, 0x0085, 0x009b, 0x00ce, 0x0046, 0x0000, 0x0023, 0x004f, 0x003a, 0x0085, 0x0019, 0x007d, 0x0048, 0x0000, 0x002d, 0x0028, 0x00db, 0x00de, 0x0044, 0x0000, 0x0002, 0x0048, 0x0000, 0x002f, 0x003b, 0x00b6, 0x0046, 0x0000, 0x001d, 0x002c, 0x009b, 0x00ce, 0x0046, 0x0000, 0x0001, 0x0068, 0x0001, 0x003f, 0x009d, 0x00bb, 0x00ce, 0x00a2, 0x0001, 0x0023, 0x000b, 0x0002, 0x0000, 0x005f, 0x0085, 0x00da, 0x00a5, 0x00bb, 0x00d6, 0x00a2, 0x0001, 0x0021, 0x000e, 0x0002, 0x0000, 0x004f, 0x00ba, 0x009d, 0x007b, 0x00c6, 0x008c, 0x0002, 0x0011, 0x002e, 0x00ba, 0x009d, 0x0046, 0x0000, 0x000c, 0x0028, 0x0001, 0x004f, 0x00fa, 0x00a5, 0x009b, 0x00ce, 0x004c, 0x0000, 0x000b, 0x0017, 0x007a, 0x00e8, 0x0001, 0x000f, 0x004c, 0x0000, 0x000b, 0x005f, 0x00ba, 0x009d, 0x003b, 0x00b6, 0x00bb, 0x004e, 0x0000, 0x0004, 0x0019, 0x0039, 0x00e8, 0x0001, 0x000f, 0x004e, 0x0000, 0x0011, 0x00f0, 0x0005, 0x009a, 0x0095, 0x00da, 0x00a5, 0x003b, 0x00b6, 0x007b, 0x00c6, 0x009b, 0x00ce, 0x00db, 0x00d6, 0x00fb, 0x00de, 0x001c, 0x00e7, 0x001c, 0x00e7, 0x001c, 0x00e7, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 216);
+
+const Image * ImageStore::FocusedFisherIcon = &image;
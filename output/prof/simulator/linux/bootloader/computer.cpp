@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "computer.h"
+
+// Compressed 3901 pixels into 229 bytes (2.94% compression ratio)/
+const uint8_t compressedPixelData[229] = {0x0019, 0x00ff, 0x0001, 0x0000, 0x002f, 0x0015, 0x005c, 0x0002, 0x0000, 0x0075, 0x000a, 0x0098, 0x0000, 0x000e, 0x00a4, 0x0000, 0x000f, 0x00a8, 0x0000, 0x008b, 0x0000, 0x001a, 0x0000, 0x002f, 0x0019, 0x007d, 0x0002, 0x0000, 0x0075, 0x000e, 0x00a8, 0x0000, 0x000f, 0x00a6, 0x0000, 0x00ff, 0x00ff, 0x00be, 0x0025, 0x0085, 0x0039, 0x0002, 0x0000, 0x000f, 0x0022, 0x0000, 0x0003, 0x000e, 0x0020, 0x0000, 0x000f, 0x004c, 0x0001, 0x0063, 0x0022, 0x007d, 0x00ef, 0x0002, 0x0000, 0x000f, 0x0020, 0x0000, 0x0025, 0x000f, 0x00a6, 0x0000, 0x0059, 0x002f, 0x009e, 0x00f7, 0x0020, 0x0000, 0x0025, 0x000f, 0x00a6, 0x0000, 0x0079, 0x001f, 0x009d, 0x00a6, 0x0000, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x0001, 0x001f, 0x009d, 0x00d6, 0x0005, 0x0092, 0x000e, 0x0004, 0x0007, 0x000e, 0x001e, 0x0000, 0x000f, 0x00a6, 0x0000, 0x0069, 0x002e, 0x009d, 0x00f7, 0x008a, 0x0000, 0x000e, 0x00a4, 0x0000, 0x000f, 0x00a6, 0x0000, 0x006d, 0x000a, 0x008c, 0x0000, 0x002f, 0x007d, 0x00ef, 0x0016, 0x0000, 0x000b, 0x000f, 0x00a6, 0x0000, 0x0075, 0x0019, 0x009d, 0x000e, 0x0000, 0x000f, 0x00a6, 0x0000, 0x0077, 0x000c, 0x00a8, 0x0000, 0x000e, 0x00a4, 0x0000, 0x000f, 0x00ac, 0x000b, 0x0075, 0x000f, 0x00a4, 0x0000, 0x003f, 0x000f, 0x0052, 0x000c, 0x0043, 0x0000, 0x006e, 0x0004, 0x000f, 0x00a4, 0x0000, 0x0039, 0x000f, 0x00f8, 0x000c, 0x0047, 0x000e, 0x00a2, 0x0000, 0x000f, 0x009e, 0x000d, 0x0083, 0x000e, 0x00a4, 0x0000, 0x000f, 0x00a6, 0x0000, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x006b, 0x0020, 0x009d, 0x00f7, 0x0002, 0x0000, 0x000f, 0x00f2, 0x0001, 0x00ff, 0x00d8, 0x000f, 0x00b2, 0x0016, 0x00ff, 0x00ff, 0x00fe, 0x000f, 0x00a6, 0x0000, 0x0084, 0x000f, 0x003e, 0x001b, 0x0087, 0x002f, 0x0015, 0x005c, 0x0002, 0x0000, 0x008d, 0x000e, 0x00a8, 0x0000, 0x000f, 0x0052, 0x0001, 0x00fe, 0x000f, 0x00a2, 0x0000, 0x0013, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(83, 47, compressedPixelData, 229);
+
+const Image * ImageStore::Computer = &image;
@@ -0,0 +1,690 @@
+/* This file is auto-generated by the rasterizer */
+
+#include <kandinsky/font.h>
+
+static constexpr KDFont::CodePointIndexPair table[] = {
+  KDFont::CodePointIndexPair(0x20, 0),
+  KDFont::CodePointIndexPair(0xb0, 95),
+  KDFont::CodePointIndexPair(0xb7, 97),
+  KDFont::CodePointIndexPair(0xc6, 98),
+  KDFont::CodePointIndexPair(0xd0, 99),
+  KDFont::CodePointIndexPair(0xd7, 100),
+  KDFont::CodePointIndexPair(0xde, 102),
+  KDFont::CodePointIndexPair(0xe6, 104),
+  KDFont::CodePointIndexPair(0xf0, 105),
+  KDFont::CodePointIndexPair(0xf7, 106),
+  KDFont::CodePointIndexPair(0xfe, 108),
+  KDFont::CodePointIndexPair(0x192, 109),
+  KDFont::CodePointIndexPair(0x300, 110),
+  KDFont::CodePointIndexPair(0x305, 114),
+  KDFont::CodePointIndexPair(0x308, 115),
+  KDFont::CodePointIndexPair(0x30a, 116),
+  KDFont::CodePointIndexPair(0x327, 118),
+  KDFont::CodePointIndexPair(0x391, 119),
+  KDFont::CodePointIndexPair(0x3a3, 136),
+  KDFont::CodePointIndexPair(0x3b1, 143),
+  KDFont::CodePointIndexPair(0x3c3, 160),
+  KDFont::CodePointIndexPair(0x454, 167),
+  KDFont::CodePointIndexPair(0x1d07, 168),
+  KDFont::CodePointIndexPair(0x2026, 169),
+  KDFont::CodePointIndexPair(0x212f, 170),
+  KDFont::CodePointIndexPair(0x2190, 171),
+  KDFont::CodePointIndexPair(0x21d0, 181),
+  KDFont::CodePointIndexPair(0x2200, 185),
+  KDFont::CodePointIndexPair(0x2202, 186),
+  KDFont::CodePointIndexPair(0x2208, 189),
+  KDFont::CodePointIndexPair(0x2211, 191),
+  KDFont::CodePointIndexPair(0x221a, 192),
+  KDFont::CodePointIndexPair(0x221e, 193),
+  KDFont::CodePointIndexPair(0x2229, 194),
+  KDFont::CodePointIndexPair(0x2248, 197),
+  KDFont::CodePointIndexPair(0x2260, 198),
+  KDFont::CodePointIndexPair(0x2264, 200),
+  KDFont::CodePointIndexPair(0x2282, 202),
+  KDFont::CodePointIndexPair(0x2284, 203),
+  KDFont::CodePointIndexPair(0x22c2, 204),
+  KDFont::CodePointIndexPair(0x2505, 206),
+  KDFont::CodePointIndexPair(0x27e6, 207),
+  KDFont::CodePointIndexPair(0xfffd, 209),
+  KDFont::CodePointIndexPair(0x1d422, 210),
+};
+
+static constexpr size_t tableLength = 44;
+
+static constexpr KDCoordinate glyphWidth = 7;
+
+static constexpr KDCoordinate glyphHeight = 14;
+
+static constexpr uint16_t glyphDataOffset[212] = {
+  0x0000, 0x000b, 0x0032, 0x004a, 0x0074, 0x00a7, 0x00b2, 0x00dc, 0x00f4,
+  0x0127, 0x015a, 0x017b, 0x0199, 0x01af, 0x01c1, 0x01d4, 0x0202, 0x022c,
+  0x024d, 0x0278, 0x02a3, 0x02cd, 0x02f8, 0x0322, 0x034c, 0x0377, 0x03a1,
+  0x03bb, 0x03d8, 0x03fa, 0x0413, 0x0435, 0x045e, 0x048d, 0x04b7, 0x04e2,
+  0x050c, 0x0536, 0x0561, 0x0589, 0x05b3, 0x05de, 0x0608, 0x062f, 0x065a,
+  0x0685, 0x06b0, 0x06db, 0x0705, 0x072e, 0x075d, 0x0788, 0x07b2, 0x07dc,
+  0x0807, 0x0831, 0x085c, 0x088a, 0x08b4, 0x08df, 0x0912, 0x0945, 0x0977,
+  0x0993, 0x09a7, 0x09bf, 0x09e2, 0x0a10, 0x0a32, 0x0a5e, 0x0a80, 0x0ab2,
+  0x0ada, 0x0b08, 0x0b34, 0x0b64, 0x0b92, 0x0bc0, 0x0be3, 0x0c06, 0x0c29,
+  0x0c52, 0x0c7b, 0x0c9d, 0x0cc0, 0x0cea, 0x0d0d, 0x0d2f, 0x0d52, 0x0d75,
+  0x0d9e, 0x0dbd, 0x0df0, 0x0e22, 0x0e55, 0x0e6a, 0x0e85, 0x0ea5, 0x0eba,
+  0x0ec9, 0x0ef3, 0x0f16, 0x0f21, 0x0f4a, 0x0f55, 0x0f88, 0x0fb5, 0x0fd7,
+  0x0fe2, 0x1004, 0x1036, 0x104e, 0x1065, 0x107d, 0x108f, 0x10ad, 0x10be,
+  0x10d4, 0x10e8, 0x1100, 0x112a, 0x1155, 0x117d, 0x11a5, 0x11d0, 0x11fb,
+  0x1226, 0x1252, 0x127c, 0x12a7, 0x12cf, 0x12fa, 0x1325, 0x1345, 0x136f,
+  0x1399, 0x13c2, 0x13ec, 0x1416, 0x1440, 0x146e, 0x149c, 0x14c5, 0x14f1,
+  0x1513, 0x1545, 0x156d, 0x1599, 0x15bb, 0x15ed, 0x1615, 0x1643, 0x1665,
+  0x168e, 0x16bc, 0x16e4, 0x1706, 0x1739, 0x175a, 0x177d, 0x17a5, 0x17c6,
+  0x17e7, 0x1809, 0x1837, 0x1860, 0x188e, 0x18b0, 0x18ce, 0x18ec, 0x18f7,
+  0x1919, 0x193d, 0x1964, 0x1986, 0x19aa, 0x19b5, 0x19dd, 0x1a00, 0x1a21,
+  0x1a44, 0x1a67, 0x1a8b, 0x1ab6, 0x1ada, 0x1aff, 0x1b1d, 0x1b49, 0x1b67,
+  0x1b85, 0x1ba3, 0x1bc1, 0x1bf4, 0x1c1e, 0x1c3b, 0x1c59, 0x1c77, 0x1ca6,
+  0x1cc6, 0x1ced, 0x1d0b, 0x1d30, 0x1d56, 0x1d74, 0x1d92, 0x1db0, 0x1dce,
+  0x1dec, 0x1e0a, 0x1e28, 0x1e46, 0x1e64
+};
+
+/* Rasterized  = 20678 bytes (211 glyphs x 98 pixels)
+ * Downsampled = 10339 bytes (1/2 of rasterized)
+ * Compressed  =  7780 bytes (37.62% of rasterized) */
+static constexpr uint8_t glyphData[7780] = {
+  0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf1, 0x01, 0x03, 0xf0, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x00, 0xb5, 0x00, 0x00, 0x0d, 0x10, 0x15, 0x00, 0x65, 0x6b, 0x00, 0x00,
+  0x07, 0xe0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xaf, 0x6b, 0x0c, 0x40, 0x0a, 0x70, 0xf1, 0x00, 0xd4, 0x3d, 0x00,
+  0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xf4, 0x0d, 0x68, 0x09, 0x50, 0x0a, 0x50, 0xc2, 0x1f, 0xff, 0xff, 0xf0, 0x0f,
+  0x02, 0xc0, 0x02, 0xd0, 0x5a, 0x08, 0xff, 0xff, 0xfb, 0x07, 0x70, 0xa4, 0x00,
+  0xa4, 0x0d, 0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0x22, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x9d, 0xfe, 0x40, 0x6b,
+  0x2a, 0x4e, 0x07, 0xb5, 0x70, 0x10, 0x1b, 0xf9, 0x10, 0x00, 0x0b, 0x9e, 0x14,
+  0x40, 0xd0, 0xa6, 0x5d, 0x3b, 0x1e, 0x30, 0x8e, 0xfd, 0x60, 0x00, 0x75, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xf4, 0x0d, 0x4d, 0xe9, 0x00, 0x0e, 0x31, 0xc2, 0x00, 0xf0, 0x00, 0x00, 0x1e,
+  0x70, 0x00, 0x3d, 0x6e, 0x35, 0xba, 0x60, 0x4d, 0xd1, 0xa9, 0x02, 0xea, 0x01,
+  0xbf, 0xd4, 0xd3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x01, 0x00, 0xaf, 0x01, 0xf0, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x08, 0x80,
+  0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00,
+  0x00, 0x4d, 0x20, 0x00, 0x2e, 0x20, 0x00, 0x0c, 0x50, 0x00, 0x05, 0xc0, 0x00,
+  0x00, 0xb5, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x0c,
+  0x50, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x09, 0x60, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x0e, 0x10,
+  0x00, 0x05, 0xb0, 0x00, 0x01, 0xe3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xa9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf9,
+  0x04, 0x3b, 0x00, 0x07, 0x44, 0x74, 0x70, 0x2a, 0xcc, 0x92, 0x04, 0xad, 0xb6,
+  0x00, 0xa2, 0xc0, 0x92, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xfc, 0x01, 0x4a, 0x00, 0x00, 0x07, 0x70,
+  0x00, 0xce, 0xfe, 0xe7, 0x00, 0x0d, 0x10, 0x00, 0x00, 0xc0, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x09, 0x83, 0x7c,
+  0x00, 0x00, 0x1e, 0x30, 0x00, 0x08, 0x80, 0x0f, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x4f, 0x2f, 0xff, 0xc0, 0x00, 0x01, 0x00,
+  0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x09, 0x56,
+  0x6b, 0x00, 0x00, 0x07, 0xe0, 0x0f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x01, 0x00, 0xf2, 0x10, 0x97, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x08,
+  0x80, 0x00, 0x01, 0xe1, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x07,
+  0x90, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x0e, 0x20, 0x25, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d,
+  0xac, 0xb2, 0x00, 0x96, 0x03, 0xc0, 0x0e, 0x00, 0x0c, 0x21, 0xc0, 0xc2, 0x94,
+  0x1c, 0x09, 0x19, 0x40, 0xe0, 0x00, 0xc2, 0x0a, 0x60, 0x3d, 0x00, 0x1b, 0xcc,
+  0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xd8, 0x01, 0x6b, 0x40, 0x00, 0x26, 0xc5, 0x00, 0x00, 0x0a, 0x50, 0x00,
+  0x00, 0xa5, 0x07, 0x00, 0x44, 0xad, 0xdd, 0xd4, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x04, 0xcd, 0xb1,
+  0x00, 0x81, 0x06, 0xa0, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x07, 0x80, 0x00, 0x04,
+  0xc0, 0x00, 0x03, 0xc1, 0x00, 0x04, 0xc1, 0x00, 0x01, 0xdd, 0xdd, 0xd3, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4,
+  0x0e, 0x05, 0xcc, 0xb2, 0x00, 0x61, 0x04, 0xd0, 0x00, 0x00, 0x3d, 0x00, 0x04,
+  0x9b, 0x20, 0x00, 0x25, 0xa8, 0x00, 0x00, 0x00, 0xd2, 0x17, 0x00, 0x2f, 0x10,
+  0x7c, 0xdc, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x01, 0x00, 0xf4, 0x0d, 0x01, 0xb4, 0x00, 0x00, 0xbc, 0x50, 0x00, 0x88,
+  0x95, 0x00, 0x4b, 0x09, 0x50, 0x0d, 0x10, 0xa6, 0x00, 0xcc, 0xcf, 0xf6, 0x00,
+  0x00, 0x95, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x06, 0xcc, 0xcb, 0x00, 0x86,
+  0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0xac, 0xbc, 0x50, 0x01, 0x00, 0x2e, 0x10,
+  0x00, 0x00, 0xc3, 0x16, 0x00, 0x3e, 0x00, 0x8d, 0xdc, 0x30, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x6c,
+  0xc9, 0x00, 0x6b, 0x00, 0x40, 0x0d, 0x20, 0x00, 0x00, 0xe4, 0xbc, 0x50, 0x0f,
+  0x60, 0x1d, 0x30, 0xe0, 0x00, 0x96, 0x08, 0x70, 0x0d, 0x20, 0x09, 0xcd, 0x50,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf5, 0x0d, 0x1c, 0xcc, 0xcc, 0x40, 0x00, 0x02, 0xb0, 0x00, 0x00, 0xb2, 0x00,
+  0x00, 0x49, 0x00, 0x00, 0x0b, 0x30, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x2d, 0x00,
+  0x00, 0x03, 0xa0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf4, 0x0e, 0x01, 0xab, 0xb3, 0x00, 0x96, 0x01, 0xd0, 0x09,
+  0x50, 0x0d, 0x00, 0x1d, 0x99, 0x50, 0x07, 0x74, 0xb9, 0x01, 0xc0, 0x00, 0xb4,
+  0x1e, 0x10, 0x0c, 0x40, 0x4c, 0xcc, 0x70, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x03, 0xcc, 0xa1, 0x00,
+  0xe2, 0x05, 0xb0, 0x2c, 0x00, 0x0c, 0x10, 0xe2, 0x03, 0xf3, 0x04, 0xbb, 0x7b,
+  0x30, 0x00, 0x00, 0xe1, 0x03, 0x00, 0x7a, 0x00, 0x8c, 0xda, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x58, 0x89, 0x00,
+  0x00, 0x0a, 0xc0, 0x11, 0x00, 0x56, 0x6b, 0x00, 0x00, 0x07, 0xe0, 0x0f, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x58, 0x89, 0x00,
+  0x00, 0x0a, 0xc0, 0x11, 0x00, 0x83, 0x7c, 0x00, 0x00, 0x1e, 0x30, 0x00, 0x08,
+  0x80, 0x0f, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xf8, 0x05, 0x07, 0xd2, 0x00, 0x09, 0xb1, 0x00, 0x1c, 0x90, 0x00, 0x02, 0xe4,
+  0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x04, 0xe1, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x42, 0x09, 0xff, 0xff, 0xb0,
+  0x0a, 0x00, 0x5b, 0x02, 0xff, 0xff, 0xf4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf9, 0x05, 0x06, 0xd1, 0x00, 0x00,
+  0x08, 0xc0, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x01, 0xc8, 0x00, 0x03, 0xd5, 0x00,
+  0x06, 0xd3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf5, 0x0c, 0x7e, 0xf9, 0x00, 0x5b, 0x10, 0xb7, 0x03, 0x10, 0x07,
+  0x80, 0x00, 0x04, 0xe4, 0x00, 0x5f, 0xd5, 0x00, 0x07, 0x60, 0x00, 0x01, 0xc5,
+  0x00, 0x00, 0x1e, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0xf0, 0x1a, 0x3b, 0xfe, 0x70, 0x3e, 0x40, 0x2e, 0x0c,
+  0x47, 0xec, 0xb3, 0xc4, 0xc1, 0x4f, 0x68, 0x86, 0x01, 0xd6, 0x86, 0x90, 0x9a,
+  0x4b, 0x0b, 0xe9, 0x70, 0xd7, 0x00, 0x00, 0x01, 0xae, 0xf7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4,
+  0x0d, 0x02, 0xf5, 0x00, 0x00, 0xba, 0x70, 0x00, 0x3b, 0x5a, 0x00, 0x0b, 0x43,
+  0xc0, 0x03, 0xc0, 0x1e, 0x00, 0xbe, 0xdd, 0xf0, 0x3d, 0x00, 0x0d, 0x3b, 0x60,
+  0x00, 0xb5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xf4, 0x0e, 0x05, 0xff, 0xfc, 0x30, 0x87, 0x00, 0x8b, 0x0b, 0x30,
+  0x1a, 0x70, 0xef, 0xff, 0x80, 0x1d, 0x00, 0x2e, 0x24, 0xb0, 0x00, 0xc4, 0x78,
+  0x00, 0x4e, 0x1a, 0xff, 0xfc, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x5d, 0xfd, 0x50, 0x6d, 0x30,
+  0x5f, 0x0e, 0x20, 0x00, 0x65, 0xb0, 0x00, 0x00, 0x79, 0x00, 0x00, 0x06, 0xa0,
+  0x00, 0x43, 0x2f, 0x30, 0x4e, 0x20, 0x5d, 0xfc, 0x30, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x05, 0xff,
+  0xd7, 0x00, 0x87, 0x03, 0xd6, 0x0b, 0x40, 0x05, 0xc0, 0xe1, 0x00, 0x2e, 0x1e,
+  0x00, 0x04, 0xc4, 0xb0, 0x00, 0xa7, 0x78, 0x02, 0x9c, 0x0a, 0xff, 0xd7, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4,
+  0x0e, 0x01, 0xff, 0xff, 0xf0, 0x4b, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0xaf,
+  0xff, 0xf2, 0x0d, 0x10, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x06,
+  0xff, 0xff, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x01, 0x00, 0xf6, 0x0b, 0xff, 0xff, 0xf0, 0x3c, 0x00, 0x00, 0x06, 0x80,
+  0x00, 0x00, 0x9f, 0xff, 0xe0, 0x0c, 0x20, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x2d,
+  0x00, 0x00, 0x05, 0xa0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x5c, 0xfd, 0x50, 0x5e, 0x30, 0x5e, 0x0d,
+  0x30, 0x00, 0x03, 0xc0, 0x1f, 0xfc, 0x5a, 0x00, 0x07, 0xa5, 0xb0, 0x00, 0xd8,
+  0x1f, 0x30, 0x9f, 0x50, 0x5e, 0xe8, 0xc3, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x09, 0x60, 0x00, 0x80,
+  0xc3, 0x00, 0x0b, 0x0e, 0x00, 0x00, 0xe2, 0xfe, 0xee, 0xef, 0x5a, 0x00, 0x04,
+  0xc8, 0x70, 0x00, 0x79, 0xb4, 0x00, 0x0a, 0x6e, 0x20, 0x00, 0xc3, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d,
+  0xef, 0xff, 0xd0, 0x00, 0x3c, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x96, 0x00,
+  0x00, 0x0c, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x04, 0xff, 0xff,
+  0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
+  0x00, 0xf5, 0x0a, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00,
+  0x87, 0x00, 0x00, 0x0b, 0x40, 0x80, 0x00, 0xe1, 0x0e, 0x40, 0x7b, 0x00, 0x4e,
+  0xfb, 0x10, 0x22, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf4, 0x0e, 0x02, 0xd0, 0x05, 0xd0, 0x5a, 0x06, 0xd1, 0x08, 0x77, 0xc1,
+  0x00, 0xbc, 0xc1, 0x00, 0x0e, 0xc7, 0x00, 0x01, 0xe1, 0xe3, 0x00, 0x4b, 0x04,
+  0xe1, 0x07, 0x80, 0x08, 0xb0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x01, 0xe0, 0x00, 0x00, 0x4b, 0x00,
+  0x00, 0x07, 0x80, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x0d, 0x20, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x3c, 0x00, 0x00, 0x06, 0xfe, 0xee, 0xc0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x08, 0xb0,
+  0x00, 0xd0, 0xbf, 0x10, 0x9f, 0x0e, 0xb6, 0x4c, 0xe1, 0xe4, 0xcd, 0x3e, 0x4b,
+  0x0e, 0x64, 0xb7, 0x80, 0x00, 0x78, 0xa5, 0x00, 0x0a, 0x5d, 0x20, 0x00, 0xd2,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x07, 0xd0, 0x00, 0x90, 0xaf, 0x40, 0x0c, 0x0d, 0x8b, 0x00, 0xf0,
+  0xf0, 0xe1, 0x2d, 0x3c, 0x08, 0x85, 0xa6, 0x90, 0x1e, 0x87, 0x96, 0x00, 0xaf,
+  0x4c, 0x30, 0x04, 0xf1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x6d, 0xfc, 0x20, 0x7d, 0x20, 0x7d, 0x1e,
+  0x10, 0x00, 0xf6, 0xa0, 0x00, 0x0e, 0x88, 0x00, 0x00, 0xf7, 0x90, 0x00, 0x7a,
+  0x3e, 0x20, 0x5e, 0x20, 0x6e, 0xfb, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf6, 0x0c, 0x04, 0xff, 0xfd, 0x30,
+  0x79, 0x00, 0x6d, 0x09, 0x60, 0x01, 0xf0, 0xc3, 0x01, 0x9a, 0x0f, 0xff, 0xd9,
+  0x02, 0xd0, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x08, 0x70, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf0, 0x1a, 0x6d, 0xfc,
+  0x20, 0x7d, 0x20, 0x7d, 0x1e, 0x10, 0x00, 0xf6, 0xa0, 0x00, 0x0e, 0x88, 0x00,
+  0x00, 0xf7, 0x90, 0x00, 0x7a, 0x3e, 0x20, 0x5e, 0x20, 0x6e, 0xfe, 0x20, 0x00,
+  0x01, 0xd5, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x02, 0xff, 0xfd, 0x30, 0x5a, 0x00, 0x6d,
+  0x08, 0x80, 0x01, 0xf0, 0xb5, 0x01, 0xaa, 0x0e, 0xff, 0xf8, 0x01, 0xf0, 0x1e,
+  0x00, 0x4c, 0x00, 0xb6, 0x07, 0x90, 0x05, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x8e, 0xfc, 0x20,
+  0x5d, 0x10, 0x8b, 0x05, 0xb0, 0x00, 0x20, 0x0a, 0xb5, 0x00, 0x00, 0x02, 0x9c,
+  0x02, 0x60, 0x00, 0xd4, 0x2e, 0x20, 0x3f, 0x20, 0x6e, 0xfd, 0x50, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d,
+  0x04, 0xff, 0xff, 0xf0, 0x00, 0x3c, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x96,
+  0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x05,
+  0xa0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf4, 0x0e, 0x07, 0x80, 0x00, 0xa0, 0xa5, 0x00, 0x0d, 0x0d, 0x20, 0x00,
+  0xf0, 0xf0, 0x00, 0x3d, 0x3c, 0x00, 0x06, 0xa5, 0xa0, 0x00, 0xa5, 0x3e, 0x10,
+  0x5d, 0x00, 0x7e, 0xeb, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x0a, 0x60, 0x00, 0x90, 0x88, 0x00,
+  0x1e, 0x05, 0xa0, 0x09, 0x80, 0x3d, 0x01, 0xe1, 0x00, 0xf0, 0x98, 0x00, 0x0e,
+  0x3e, 0x00, 0x00, 0xcc, 0x70, 0x00, 0x09, 0xe0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x0f, 0x02, 0xf0,
+  0x10, 0xe0, 0x8f, 0x06, 0x1d, 0x0d, 0xd1, 0xb1, 0xd4, 0xac, 0x2e, 0x2c, 0xa4,
+  0xc6, 0x92, 0xcd, 0x0c, 0xc4, 0x2f, 0x80, 0xce, 0x03, 0xf2, 0x0c, 0x90, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x24, 0x00, 0x06, 0x02, 0xe0, 0x08, 0x90, 0x0b, 0x63, 0xd0, 0x00, 0x4c,
+  0xc4, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x5f, 0xa0, 0x00, 0x1e, 0x3e, 0x10, 0x0b,
+  0x70, 0x98, 0x06, 0xc0, 0x02, 0xe0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x07, 0x90, 0x00, 0xc0, 0x1e,
+  0x00, 0x7a, 0x00, 0xb4, 0x3d, 0x00, 0x05, 0xbd, 0x30, 0x00, 0x0f, 0x60, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x03, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x98, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x5b, 0x00, 0x00,
+  0x3c, 0x10, 0x00, 0x2d, 0x20, 0x00, 0x1d, 0x30, 0x00, 0x09, 0xff, 0xff, 0xe0,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x06, 0x00, 0x09,
+  0xff, 0x30, 0x00, 0xe0, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
+  0x96, 0x00, 0x00, 0x0b, 0x30, 0x00, 0x11, 0x00, 0xf0, 0x09, 0x1d, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x7f, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x00, 0x5b,
+  0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00, 0x2d, 0x00, 0x00,
+  0x00, 0xb4, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x09, 0x00, 0x0c, 0xfe, 0x00,
+  0x00, 0x00, 0xd1, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x03, 0xb0, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xc3, 0x11, 0x00, 0xf0, 0x05, 0x01, 0xd0,
+  0x00, 0x00, 0x4a, 0x00, 0x00, 0x07, 0x70, 0x00, 0xbf, 0xe2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xef, 0x05, 0xf3, 0x00,
+  0x02, 0xd6, 0xa0, 0x00, 0xd3, 0x0d, 0x20, 0xb6, 0x00, 0x69, 0x00, 0x01, 0x00,
+  0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0f, 0xe0,
+  0xaf, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x00, 0xaf, 0x61, 0x00, 0x00, 0x06, 0xd5, 0x00, 0x00,
+  0x01, 0x30, 0x00, 0x01, 0x00, 0x0a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0x01, 0x00, 0xf5, 0x06, 0x02, 0xcf, 0xca, 0x71, 0xe6, 0x05, 0xf4, 0x6b,
+  0x00, 0x0f, 0x27, 0x90, 0x01, 0xf0, 0x5d, 0x11, 0xbc, 0x00, 0x9f, 0xd5, 0xf8,
+  0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x2e, 0x00, 0x00, 0x04, 0xb0, 0x00, 0x00, 0x79, 0x00, 0x00, 0x0a, 0xac,
+  0xe9, 0x00, 0xcb, 0x01, 0xd4, 0x0f, 0x10, 0x09, 0x72, 0xe0, 0x00, 0xb5, 0x4f,
+  0x40, 0x5e, 0x07, 0x7c, 0xfc, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5, 0x05, 0x8e, 0xe9, 0x00, 0x9b, 0x10,
+  0xb5, 0x0f, 0x00, 0x00, 0x02, 0xe0, 0x00, 0x00, 0x0e, 0x50, 0x6d, 0x00, 0x4d,
+  0xfc, 0x20, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01,
+  0x00, 0xf4, 0x0f, 0x0f, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x59, 0x02, 0xcf,
+  0xc9, 0x71, 0xe6, 0x05, 0xf4, 0x6b, 0x00, 0x0f, 0x17, 0x90, 0x01, 0xe0, 0x5d,
+  0x11, 0xbc, 0x00, 0x9f, 0xd5, 0xf8, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5, 0x05, 0x9e, 0xfa, 0x00, 0xb5, 0x00,
+  0xa6, 0x2f, 0xff, 0xff, 0x74, 0xc0, 0x00, 0x00, 0x1f, 0x40, 0x6c, 0x00, 0x5e,
+  0xfb, 0x10, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01,
+  0x00, 0xf0, 0x1d, 0x1c, 0xfc, 0x00, 0x08, 0x80, 0x00, 0x00, 0xb4, 0x00, 0x05,
+  0xff, 0xff, 0x50, 0x00, 0xf0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x06, 0xa0, 0x00,
+  0x00, 0x87, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x2e, 0x00,
+  0x00, 0xce, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0,
+  0x13, 0x5e, 0xff, 0xf0, 0x2d, 0x11, 0xe2, 0x06, 0x80, 0x0c, 0x30, 0x5b, 0x04,
+  0xd0, 0x09, 0xcf, 0xc3, 0x01, 0xff, 0xfd, 0x40, 0x78, 0x00, 0x6c, 0x0a, 0x80,
+  0x09, 0x90, 0x2c, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x08,
+  0xac, 0xfb, 0x00, 0xac, 0x10, 0xc6, 0x0d, 0x30, 0x09, 0x60, 0xf0, 0x00, 0xb4,
+  0x2d, 0x00, 0x0e, 0x15, 0xa0, 0x01, 0xe0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x50, 0x4e, 0x10, 0x00, 0x02, 0xc1,
+  0x09, 0x00, 0xf4, 0x07, 0x04, 0xff, 0x50, 0x00, 0x00, 0x96, 0x00, 0x00, 0x0c,
+  0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x01, 0xef, 0xc0, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x51,
+  0x06, 0xd0, 0x00, 0x00, 0x4b, 0x0a, 0x00, 0xf0, 0x13, 0x9f, 0xf3, 0x00, 0x00,
+  0x0b, 0x30, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x03, 0xc0, 0x00,
+  0x00, 0x69, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0xc4, 0x00, 0xdf, 0xfd, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x04, 0xb0, 0x5d, 0x20, 0x78, 0x7c,
+  0x10, 0x0a, 0xdb, 0x00, 0x00, 0xd7, 0xd1, 0x00, 0x0f, 0x07, 0xb0, 0x02, 0xd0,
+  0x0b, 0x70, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0x00, 0x02, 0xe0, 0x00, 0x00, 0x4b,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x0c, 0x20, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x01, 0xef, 0xc0, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x6e, 0xae,
+  0x8e, 0xc0, 0xf2, 0x8b, 0x0e, 0x3c, 0x09, 0x60, 0xf5, 0x90, 0xc3, 0x2d, 0x86,
+  0x0e, 0x05, 0xab, 0x31, 0xd0, 0x87, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x3f, 0x8b, 0xfc, 0x10, 0x8e, 0x20,
+  0xb7, 0x0a, 0x60, 0x08, 0x70, 0xd2, 0x00, 0xb4, 0x0f, 0x00, 0x0e, 0x23, 0xc0,
+  0x01, 0xf0, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0xf5, 0x06, 0x01, 0xae, 0xe8, 0x00, 0xc8, 0x01, 0xd4, 0x3d, 0x00, 0x08,
+  0x85, 0xb0, 0x00, 0x96, 0x1f, 0x30, 0x5e, 0x10, 0x5e, 0xfb, 0x20, 0x1e, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x0f,
+  0x6d, 0xf9, 0x00, 0xcb, 0x01, 0xd5, 0x0e, 0x10, 0x08, 0x80, 0xf0, 0x00, 0xb6,
+  0x0f, 0x50, 0x5e, 0x10, 0xac, 0xfc, 0x30, 0x06, 0x00, 0x00, 0x0b, 0x40, 0x00,
+  0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf0,
+  0x14, 0x01, 0xaf, 0xd5, 0xb0, 0xc8, 0x02, 0xe8, 0x2e, 0x00, 0x0b, 0x54, 0xc0,
+  0x00, 0xe3, 0x2f, 0x20, 0x8f, 0x00, 0x7e, 0xe9, 0xd0, 0x00, 0x00, 0x5a, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x6e, 0x30, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0xf6, 0x05, 0x08, 0xfb, 0xae, 0xb0, 0x03, 0xf2, 0x00, 0x00, 0x6a, 0x00,
+  0x00, 0x09, 0x70, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x01, 0xbf,
+  0xe7, 0x00, 0x7a, 0x02, 0xc0, 0x03, 0xd7, 0x40, 0x00, 0x00, 0x3a, 0x90, 0x1f,
+  0x20, 0x7b, 0x00, 0x6e, 0xfc, 0x20, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x04, 0x10, 0x00, 0x00, 0xd1, 0x00,
+  0x09, 0xff, 0xff, 0x40, 0x04, 0xc0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x09, 0x60,
+  0x00, 0x00, 0xb5, 0x00, 0x00, 0x06, 0xff, 0x60, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x0d, 0x20, 0x0b,
+  0x40, 0xf0, 0x00, 0xe2, 0x3c, 0x00, 0x1f, 0x05, 0xa0, 0x04, 0xc0, 0x5c, 0x01,
+  0xd9, 0x00, 0xbf, 0xc7, 0xf4, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf6, 0x05, 0x0e, 0x20, 0x07, 0x90, 0xb6, 0x00, 0xc5,
+  0x06, 0xa0, 0x5d, 0x00, 0x2e, 0x0e, 0x30, 0x00, 0xea, 0x90, 0x00, 0x0a, 0xe1,
+  0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5,
+  0x06, 0x4a, 0x0a, 0xa0, 0xb3, 0xa1, 0xeb, 0x0e, 0x3b, 0x77, 0xc5, 0xa2, 0xbd,
+  0x1d, 0xb3, 0x1f, 0xa0, 0xed, 0x01, 0xf3, 0x0e, 0x60, 0x1e, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x1e, 0x90, 0x0b,
+  0x70, 0x0d, 0x39, 0x90, 0x00, 0x5e, 0xb0, 0x00, 0x08, 0xf7, 0x00, 0x05, 0xc2,
+  0xe1, 0x04, 0xd1, 0x07, 0xe4, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x0e, 0x10, 0x05, 0xb0, 0xa6, 0x00, 0x97,
+  0x05, 0xa0, 0x2e, 0x10, 0x1e, 0x0b, 0x60, 0x00, 0xc9, 0xc0, 0x00, 0x07, 0xf2,
+  0x00, 0x00, 0xa7, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x0d, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x71, 0x04, 0xff, 0xff, 0x50, 0x00, 0x09,
+  0xb0, 0x03, 0x00, 0x10, 0xa0, 0x03, 0x00, 0x45, 0x03, 0xff, 0xff, 0x80, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x9e, 0xe0,
+  0x00, 0x4d, 0x10, 0x00, 0x06, 0x90, 0x00, 0x00, 0x59, 0x00, 0x00, 0x06, 0x80,
+  0x00, 0x01, 0xc5, 0x00, 0x07, 0xf9, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x3b,
+  0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x06, 0xef, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x0f,
+  0x00, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x08, 0x70, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x4b, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x0d, 0x30, 0x00, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x8f, 0xb0, 0x00, 0x00, 0x0d, 0x40,
+  0x00, 0x00, 0xc2, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x5a,
+  0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x01,
+  0xd0, 0x00, 0x00, 0x6c, 0x00, 0x07, 0xfd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x8e, 0x5e, 0xb2, 0x86, 0x0d, 0x16,
+  0xeb, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0xdf, 0xbe, 0x50, 0x00, 0x57, 0x1c, 0x00, 0x06, 0x71, 0xc0, 0x00,
+  0x0b, 0xe5, 0x00, 0x01, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xc0, 0x06, 0x80, 0x00, 0xdf, 0xff, 0xf7, 0x00, 0x0c, 0x10,
+  0x00, 0x00, 0xa0, 0x10, 0x00, 0x45, 0x08, 0xff, 0xff, 0xc0, 0x1d, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x8e, 0x01, 0xc4, 0x00,
+  0x00, 0x1e, 0x60, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x0e, 0x15, 0x03, 0x0a, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x02, 0xff, 0xd6, 0x00, 0x5b,
+  0x03, 0xe5, 0x09, 0x70, 0x06, 0xba, 0xff, 0xe0, 0x3d, 0x0e, 0x10, 0x05, 0xb1,
+  0xe0, 0x00, 0xb6, 0x4c, 0x02, 0xac, 0x06, 0xff, 0xd7, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf8, 0x06, 0x16, 0x00,
+  0x45, 0x00, 0xd5, 0x6d, 0x20, 0x02, 0xfc, 0x10, 0x00, 0xab, 0xd1, 0x00, 0xc8,
+  0x05, 0xc0, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf6, 0x0c, 0x04, 0xb0, 0x00, 0x00, 0x7f, 0xff, 0xb1, 0x09,
+  0x40, 0x0a, 0x90, 0xc1, 0x00, 0x6a, 0x0e, 0x00, 0x2d, 0x52, 0xff, 0xfd, 0x60,
+  0x59, 0x00, 0x00, 0x08, 0x70, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf0,
+  0x22, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xfa, 0x00, 0x1e, 0x21, 0xd3, 0x05, 0xa0,
+  0x3e, 0x10, 0x08, 0xfc, 0xce, 0xb4, 0xc0, 0xca, 0x0f, 0xa5, 0x0b, 0xdd, 0xdc,
+  0x20, 0xe1, 0x00, 0xb4, 0x5f, 0x39, 0x65, 0xec, 0xde, 0xb0, 0x70, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0xf4, 0x10, 0x0c, 0x89, 0x00, 0x06, 0xdf, 0x60, 0x00, 0x40, 0x87,
+  0x01, 0xaf, 0xe9, 0xb0, 0xb9, 0x01, 0xbd, 0x2d, 0x00, 0x05, 0xc4, 0xc0, 0x00,
+  0x78, 0x1f, 0x40, 0x4e, 0x10, 0x5d, 0xfc, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x51, 0x05, 0xb0, 0x00, 0x00,
+  0x7e, 0x0a, 0x00, 0x30, 0xdf, 0xff, 0xf7, 0x07, 0x00, 0x78, 0x04, 0xc1, 0x00,
+  0x00, 0x5e, 0x20, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0xf6, 0x05, 0x1a, 0xee, 0xaa, 0x0c, 0x80, 0x7f, 0x40, 0xd0, 0x6a, 0x98,
+  0x0b, 0x7a, 0x09, 0x60, 0xfb, 0x05, 0xe1, 0x0b, 0xdf, 0xc2, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x1c, 0xfc,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0xb4, 0x00, 0x05, 0xff, 0xff, 0x50, 0x00, 0xf0,
+  0x00, 0x00, 0x3c, 0x00, 0x00, 0x06, 0xa0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x0b,
+  0x40, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x2e, 0x00, 0x00, 0xce, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xaf, 0x61, 0x00, 0x00, 0x06, 0xd5,
+  0x00, 0x00, 0x01, 0x30, 0x00, 0x01, 0x00, 0x0a, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x00, 0x9f, 0x01, 0x60, 0x00, 0x09, 0xd5, 0x00, 0x00,
+  0x50, 0x00, 0x01, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0xaf, 0x04, 0x00, 0x00, 0x2c, 0x8c, 0x00, 0x01, 0x00, 0x10, 0x00,
+  0x01, 0x00, 0x0a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0x4f, 0x4e, 0xfd, 0x10, 0x00, 0x01, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50,
+  0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0x3f, 0x3b, 0x1c, 0x00,
+  0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x51, 0x49, 0x30, 0x00, 0x09, 0x09, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x6f, 0x92, 0xb1, 0x00,
+  0x39, 0x66, 0x00, 0x01, 0x00, 0x0e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0c, 0xf0, 0x02, 0x08, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00,
+  0x00, 0xd1, 0x00, 0x0c, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0xf4, 0x0d, 0x02, 0xf5, 0x00, 0x00, 0xba, 0x70, 0x00, 0x3b, 0x5a, 0x00,
+  0x0b, 0x43, 0xc0, 0x03, 0xc0, 0x1e, 0x00, 0xbe, 0xdd, 0xf0, 0x3d, 0x00, 0x0d,
+  0x3b, 0x60, 0x00, 0xb5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x05, 0xff, 0xfc, 0x30, 0x87, 0x00, 0x8b,
+  0x1b, 0x30, 0x1a, 0x76, 0xef, 0xff, 0x80, 0x6d, 0x00, 0x2e, 0x22, 0xb0, 0x00,
+  0xc4, 0x08, 0x00, 0x4e, 0x10, 0xff, 0xfc, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf6, 0x0b, 0x0c, 0xdd, 0xd0,
+  0x00, 0xe0, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0xb3, 0x00,
+  0x00, 0x0e, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x00, 0x57, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf5, 0x0b, 0x9c, 0x00,
+  0x00, 0x39, 0xd0, 0x00, 0x0b, 0x2d, 0x00, 0x04, 0x90, 0xd0, 0x00, 0xc1, 0x0c,
+  0x10, 0x68, 0x00, 0xb3, 0x0d, 0x00, 0x0a, 0x45, 0xdd, 0xdd, 0xd4, 0x23, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x01,
+  0xff, 0xff, 0xf0, 0x4b, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0xaf, 0xff, 0xf2,
+  0x0d, 0x10, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x06, 0xff, 0xff,
+  0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xf4, 0x0e, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x98, 0x00, 0x00, 0x7a,
+  0x00, 0x00, 0x5b, 0x00, 0x00, 0x3c, 0x10, 0x00, 0x2d, 0x20, 0x00, 0x1d, 0x30,
+  0x00, 0x09, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x09, 0x60, 0x00, 0x80, 0xc3, 0x00,
+  0x0b, 0x0e, 0x00, 0x00, 0xe2, 0xfe, 0xee, 0xef, 0x5a, 0x00, 0x04, 0xc8, 0x70,
+  0x00, 0x79, 0xb4, 0x00, 0x0a, 0x6e, 0x20, 0x00, 0xc3, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf4, 0x0f, 0x10, 0x00,
+  0x08, 0xdd, 0xa0, 0x07, 0x90, 0x0e, 0x01, 0xd0, 0x00, 0xb0, 0x68, 0x8b, 0x5c,
+  0x0a, 0x51, 0x21, 0xe0, 0xb4, 0x00, 0x78, 0x08, 0x90, 0x4c, 0x00, 0x1c, 0xeb,
+  0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0xf4, 0x0d, 0xef, 0xff, 0xd0, 0x00, 0x3c, 0x00, 0x00, 0x06, 0x90, 0x00,
+  0x00, 0x96, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00,
+  0x04, 0xff, 0xff, 0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x02, 0xd0, 0x05, 0xd0, 0x5a, 0x06, 0xd1,
+  0x08, 0x77, 0xc1, 0x00, 0xbc, 0xc1, 0x00, 0x0e, 0xc7, 0x00, 0x01, 0xe1, 0xe3,
+  0x00, 0x4b, 0x04, 0xe1, 0x07, 0x80, 0x08, 0xb0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf5, 0x0b, 0xac, 0x00, 0x00,
+  0x2a, 0xd0, 0x00, 0x0a, 0x2d, 0x00, 0x03, 0xa0, 0xe0, 0x00, 0xb2, 0x0e, 0x00,
+  0x4a, 0x00, 0xd1, 0x0c, 0x20, 0x0d, 0x23, 0x90, 0x00, 0xa2, 0x23, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf4, 0x0e, 0x08, 0xb0,
+  0x00, 0xd0, 0xbf, 0x10, 0x9f, 0x0e, 0xb6, 0x4c, 0xe1, 0xe4, 0xcd, 0x3e, 0x4b,
+  0x0e, 0x64, 0xb7, 0x80, 0x00, 0x78, 0xa5, 0x00, 0x0a, 0x5d, 0x20, 0x00, 0xd2,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xf4, 0x0e, 0x07, 0xd0, 0x00, 0x90, 0xaf, 0x40, 0x0c, 0x0d, 0x8b, 0x00, 0xf0,
+  0xf0, 0xe1, 0x2d, 0x3c, 0x08, 0x85, 0xa6, 0x90, 0x1e, 0x87, 0x96, 0x00, 0xaf,
+  0x4c, 0x30, 0x04, 0xf1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x01, 0x00, 0x33, 0x4d, 0xdd, 0xd0, 0x0a, 0x00, 0x63, 0x04, 0xbb,
+  0xb0, 0x00, 0x12, 0x22, 0x0d, 0x00, 0x25, 0x01, 0xdd, 0x18, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x6d,
+  0xfc, 0x20, 0x7d, 0x20, 0x7d, 0x1e, 0x10, 0x00, 0xf6, 0xa0, 0x00, 0x0e, 0x88,
+  0x00, 0x00, 0xf7, 0x90, 0x00, 0x7a, 0x3e, 0x20, 0x5e, 0x20, 0x6e, 0xfb, 0x20,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00,
+  0xf4, 0x0d, 0x6e, 0xdd, 0xe0, 0x0a, 0x40, 0x0a, 0x00, 0xd1, 0x00, 0xd0, 0x1d,
+  0x00, 0x1d, 0x05, 0x90, 0x05, 0x90, 0x86, 0x00, 0x95, 0x0c, 0x20, 0x0c, 0x20,
+  0xc0, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x01, 0x00, 0xf6, 0x0c, 0x04, 0xff, 0xfd, 0x30, 0x79, 0x00, 0x6d, 0x09,
+  0x60, 0x01, 0xf0, 0xc3, 0x01, 0x9a, 0x0f, 0xff, 0xd9, 0x02, 0xd0, 0x00, 0x00,
+  0x5a, 0x00, 0x00, 0x08, 0x70, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x00, 0x01, 0x00, 0xf4, 0x0d, 0x5f, 0xdd, 0xd0, 0x00, 0xd1, 0x00,
+  0x00, 0x06, 0x80, 0x00, 0x00, 0x0d, 0x10, 0x00, 0x05, 0x90, 0x00, 0x05, 0xa0,
+  0x00, 0x04, 0xa0, 0x00, 0x00, 0xdd, 0xdd, 0xd0, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d, 0x04, 0xff, 0xff,
+  0xf0, 0x00, 0x3c, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x96, 0x00, 0x00, 0x0c,
+  0x30, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xf5, 0x0d,
+  0x07, 0x90, 0x00, 0xc0, 0x1e, 0x00, 0x7a, 0x00, 0xb4, 0x3d, 0x00, 0x05, 0xbd,
+  0x30, 0x00, 0x0f, 0x60, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x05,
+  0xa0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01,
+  0x00, 0xf2, 0x10, 0x20, 0x00, 0x00, 0x9b, 0x00, 0x05, 0xcf, 0xed, 0x03, 0xc0,
+  0xc0, 0x90, 0xa4, 0x0c, 0x07, 0x0d, 0x04, 0x90, 0xc0, 0xc3, 0x85, 0x69, 0x04,
+  0xdf, 0xe9, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x01, 0x25, 0x00, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x06,
+  0x02, 0xe0, 0x08, 0x90, 0x0b, 0x63, 0xd0, 0x00, 0x4c, 0xc4, 0x00, 0x00, 0xe9,
+  0x00, 0x00, 0x5f, 0xa0, 0x00, 0x1e, 0x3e, 0x10, 0x0b, 0x70, 0x98, 0x06, 0xc0,
+  0x02, 0xe0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf5, 0x0c, 0xc1, 0x68, 0x00, 0x0d, 0x0a, 0x43, 0x03, 0xb0, 0xd1,
+  0x70, 0x3d, 0x1d, 0x2c, 0x00, 0x9f, 0xfa, 0x20, 0x00, 0x86, 0x00, 0x00, 0x0c,
+  0x20, 0x00, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x01, 0x00, 0xf4, 0x0f, 0x10, 0x00, 0x08, 0xdd, 0xa0, 0x08, 0x80,
+  0x0d, 0x01, 0xe0, 0x00, 0xb0, 0x69, 0x00, 0x0c, 0x09, 0x60, 0x01, 0xd0, 0x85,
+  0x00, 0x85, 0x03, 0xa0, 0x49, 0x05, 0xdc, 0x0c, 0xd5, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5, 0x05, 0x2a, 0xb2,
+  0x90, 0x1d, 0x42, 0xd6, 0x08, 0x60, 0x0e, 0x10, 0xc1, 0x03, 0xa0, 0x0d, 0x20,
+  0xc6, 0x00, 0x6e, 0xb7, 0xd0, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x3b, 0xb2, 0x00, 0x1c, 0x15, 0xa0, 0x07,
+  0x60, 0x58, 0x00, 0xc1, 0x2b, 0x10, 0x0c, 0x2e, 0x80, 0x03, 0x90, 0x0b, 0x30,
+  0x76, 0x00, 0xa3, 0x0b, 0x60, 0x3c, 0x00, 0xd9, 0xdc, 0x10, 0x2b, 0x00, 0x00,
+  0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0xf0, 0x13, 0xe0, 0x01, 0xb0, 0x0b, 0x30, 0x84, 0x00, 0x85, 0x1b,
+  0x00, 0x05, 0x7a, 0x20, 0x00, 0x5d, 0x60, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x75,
+  0x00, 0x00, 0x0b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x00, 0xf5, 0x0f, 0x4b, 0xc9, 0x00, 0x0d, 0x00, 0x40, 0x00, 0xd3,
+  0x00, 0x00, 0x05, 0xf4, 0x00, 0x07, 0x84, 0xe1, 0x05, 0x80, 0x0a, 0x40, 0xb2,
+  0x00, 0xb1, 0x0b, 0x40, 0x5a, 0x00, 0x3d, 0xd9, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5, 0x05, 0x19, 0xca, 0x20,
+  0x0a, 0x40, 0x32, 0x00, 0x99, 0x50, 0x00, 0x3a, 0x64, 0x00, 0x0a, 0x40, 0x02,
+  0x00, 0x5d, 0xcb, 0x40, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x00, 0xf0, 0x1d, 0x6b, 0xbb, 0x00, 0x00, 0x17, 0x90, 0x00, 0x09,
+  0x60, 0x00, 0x09, 0x50, 0x00, 0x05, 0x90, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x2b,
+  0x00, 0x00, 0x03, 0xe1, 0x00, 0x00, 0x09, 0xea, 0x10, 0x00, 0x00, 0xa4, 0x00,
+  0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xf0, 0x13, 0x83, 0xab, 0x10, 0x0e, 0x71, 0xa4, 0x02, 0xb0, 0x0a, 0x20,
+  0x67, 0x00, 0xd0, 0x09, 0x40, 0x2b, 0x00, 0xc0, 0x05, 0x70, 0x00, 0x00, 0x93,
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xc9, 0x10, 0x07, 0x90, 0x7a, 0x00, 0xe1, 0x00,
+  0xe1, 0x1e, 0x00, 0x0b, 0x42, 0xfb, 0xbb, 0xf5, 0x1e, 0x00, 0x0b, 0x40, 0xe0,
+  0x00, 0xd2, 0x09, 0x70, 0x4c, 0x00, 0x1b, 0xdc, 0x20, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5, 0x05, 0x07, 0x40,
+  0x00, 0x02, 0x66, 0x00, 0x00, 0x0a, 0x30, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x0d,
+  0x00, 0x00, 0x00, 0xcc, 0x50, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf0, 0x14, 0x02, 0xa0, 0x06, 0xb0, 0x2d, 0x19, 0xa2,
+  0x01, 0xca, 0xb0, 0x00, 0x4e, 0x5d, 0x00, 0x08, 0x70, 0xb4, 0x10, 0xa1, 0x04,
+  0xc3, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x00, 0x00, 0x01,
+  0xe0, 0x00, 0x00, 0x0c, 0x10, 0x00, 0x02, 0xf3, 0x00, 0x00, 0xaa, 0x40, 0x00,
+  0x58, 0x76, 0x00, 0x0c, 0x06, 0x70, 0x08, 0x50, 0x49, 0x02, 0xb0, 0x03, 0x90,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0xf0, 0x13, 0x90, 0x04, 0x40, 0x1c, 0x00, 0xa3, 0x05, 0x80, 0x0d, 0x00, 0x85,
+  0x01, 0xb0, 0x0c, 0x40, 0xa7, 0x00, 0xdd, 0xb6, 0xb0, 0x39, 0x00, 0x00, 0x07,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01,
+  0x00, 0xf6, 0x05, 0x01, 0x90, 0x00, 0x50, 0x0d, 0x10, 0x2b, 0x00, 0x94, 0x0b,
+  0x10, 0x06, 0x68, 0x40, 0x00, 0x5b, 0x80, 0x00, 0x04, 0xb0, 0x1e, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbb,
+  0xbb, 0x00, 0x04, 0xa2, 0x10, 0x00, 0xc2, 0x00, 0x00, 0x0b, 0x50, 0x00, 0x00,
+  0x8d, 0xa0, 0x00, 0xa4, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x05, 0xc1, 0x00, 0x00,
+  0x09, 0xeb, 0x20, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf6, 0x04, 0x19, 0xc7, 0x00,
+  0x0c, 0x41, 0xd3, 0x07, 0x70, 0x0a, 0x50, 0xb3, 0x00, 0xd1, 0x0b, 0x50, 0x6a,
+  0x00, 0x3d, 0xc9, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf5, 0x06, 0x04, 0xaa, 0xaa, 0xa0, 0x1b, 0x42, 0xd2, 0x00, 0xd0,
+  0x1b, 0x00, 0x2a, 0x04, 0x80, 0x07, 0x60, 0x84, 0x00, 0xa1, 0x07, 0xb0, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x13,
+  0x08, 0xc9, 0x00, 0x0a, 0x71, 0xb5, 0x02, 0xb0, 0x08, 0x50, 0x76, 0x00, 0xc2,
+  0x0b, 0x50, 0x6a, 0x00, 0xda, 0xda, 0x00, 0x2b, 0x00, 0x00, 0x06, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf6,
+  0x04, 0x18, 0xaa, 0xa0, 0x0c, 0x54, 0xc2, 0x07, 0x70, 0x0d, 0x00, 0xc2, 0x00,
+  0xd0, 0x0c, 0x40, 0x87, 0x00, 0x4e, 0xd8, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf6, 0x04, 0xaa, 0xaa, 0x80, 0x02, 0x69,
+  0x21, 0x00, 0x08, 0x40, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xdb, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xf6, 0x05, 0x03, 0xb0, 0x06, 0x60, 0x3c, 0x00, 0x86, 0x05, 0x80, 0x0a, 0x40,
+  0x84, 0x00, 0xd0, 0x0a, 0x40, 0x77, 0x00, 0x4e, 0xd8, 0x1e, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf0, 0x19, 0x52, 0x00, 0x00,
+  0x0c, 0x10, 0x00, 0x2b, 0xf9, 0x00, 0x2c, 0x69, 0x97, 0x0a, 0x47, 0x55, 0x80,
+  0xe0, 0xb2, 0x76, 0x3b, 0x0d, 0x0b, 0x36, 0x72, 0xa0, 0xd5, 0x00, 0x67, 0x01,
+  0x00, 0x0a, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf0, 0x14, 0x03, 0xb0, 0x04, 0x80, 0x2b, 0x41, 0xb2, 0x00, 0x68,
+  0xa2, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x3f, 0x10, 0x00, 0x1b, 0x77, 0x00, 0x0b,
+  0x21, 0xc0, 0x08, 0x60, 0x0c, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x01, 0x00, 0xf0, 0x19, 0x52, 0x00, 0x00, 0x0c, 0x10, 0x07, 0x60,
+  0xd1, 0x82, 0x67, 0x49, 0x2a, 0x09, 0x47, 0x64, 0x80, 0xc0, 0xb2, 0x75, 0x0c,
+  0x0d, 0x0b, 0x24, 0x82, 0xa0, 0xc5, 0x00, 0x67, 0x01, 0x00, 0x0a, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf5, 0x05,
+  0xb2, 0x04, 0x80, 0x58, 0x00, 0x3b, 0x0c, 0x17, 0x43, 0xa0, 0xc0, 0xa1, 0x77,
+  0x2c, 0x1e, 0x0c, 0x10, 0xcb, 0x7d, 0x50, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07,
+  0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc,
+  0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc,
+  0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x84,
+  0x6b, 0x10, 0x07, 0x57, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf6, 0x07, 0x20, 0x00, 0x00, 0x69,
+  0x00, 0x00, 0x79, 0x00, 0x00, 0x7e, 0x99, 0x99, 0x73, 0xd4, 0x33, 0x33, 0x03,
+  0xb1, 0x00, 0x00, 0x02, 0xa0, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0xf3, 0x0a, 0x30, 0x00, 0x00, 0x6f, 0x80, 0x00, 0x59,
+  0xd7, 0x80, 0x4a, 0x0d, 0x07, 0x71, 0x00, 0xd0, 0x01, 0x00, 0x0d, 0x00, 0x00,
+  0x00, 0xd0, 0x00, 0x00, 0x02, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0x50, 0x20, 0x00, 0x00, 0x06, 0x90, 0x04, 0x00, 0xd6,
+  0x69, 0x99, 0x9d, 0xa2, 0x33, 0x34, 0xc5, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x84,
+  0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xf6,
+  0x07, 0x60, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x32, 0x0d, 0x00,
+  0x51, 0xc1, 0xd0, 0xb3, 0x02, 0xbd, 0xa4, 0x00, 0x02, 0xe4, 0x20, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x18, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf3, 0x0b, 0x01, 0xa2, 0x00, 0x32,
+  0xbe, 0xa4, 0x0b, 0x81, 0xd0, 0x80, 0xa0, 0x0d, 0x00, 0x08, 0x00, 0xd0, 0x00,
+  0xba, 0x4d, 0x2b, 0x01, 0x09, 0xfb, 0x10, 0x00, 0x05, 0x21, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x07, 0x87, 0x75,
+  0x00, 0xcd, 0x33, 0x30, 0x0b, 0x6b, 0x00, 0x00, 0xb0, 0x6b, 0x00, 0x0b, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x30, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x01, 0x00, 0xf7, 0x04, 0x04, 0x77, 0x77, 0x00, 0x23, 0x3c, 0xe0,
+  0x00, 0x0a, 0x8b, 0x00, 0x0a, 0x80, 0xb0, 0x0a, 0x80, 0x0c, 0x00, 0x30, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06,
+  0x08, 0x10, 0x04, 0x00, 0x4c, 0x10, 0xb0, 0x00, 0x4c, 0x1b, 0x00, 0x00, 0x4c,
+  0xc0, 0x05, 0x98, 0xcf, 0x00, 0x12, 0x22, 0x30, 0x1e, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0xf5, 0x06, 0x04, 0x00, 0x08, 0x00,
+  0xb0, 0x09, 0x80, 0x0b, 0x09, 0x80, 0x00, 0xb9, 0x80, 0x00, 0x0c, 0xe8, 0x87,
+  0x00, 0x23, 0x22, 0x10, 0x1e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xf6, 0x07, 0x20, 0x00, 0x00, 0x69, 0x00, 0x00, 0x9f, 0x99,
+  0x97, 0x78, 0x11, 0x11, 0x03, 0xc7, 0x66, 0x65, 0x04, 0xf5, 0x44, 0x30, 0x02,
+  0xa0, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xf0, 0x16, 0x30, 0x00, 0x00, 0x6b, 0x80, 0x00, 0x5f, 0x0f, 0x80, 0x4a, 0xa0,
+  0xa8, 0x71, 0x0a, 0x0a, 0x01, 0x00, 0xa0, 0xa0, 0x00, 0x0a, 0x0a, 0x00, 0x00,
+  0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0xf6, 0x07, 0x20, 0x00, 0x00, 0x06, 0x90, 0x06, 0x99,
+  0x9f, 0xd0, 0x01, 0x11, 0x15, 0xa4, 0x66, 0x66, 0xc5, 0x24, 0x44, 0xe6, 0x00,
+  0x00, 0x84, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xf6, 0x08, 0x04, 0x04, 0x00, 0x00, 0xa0, 0xa0, 0x00, 0x0a, 0x0a, 0x00,
+  0x32, 0xa0, 0xa1, 0x51, 0xcc, 0x0a, 0xb3, 0x02, 0xf1, 0xf4, 0x00, 0x02, 0xd4,
+  0x21, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44,
+  0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x00, 0xf5, 0x0f, 0x12, 0x00, 0x00, 0x03, 0xd5, 0x00, 0x00, 0x01,
+  0xe1, 0x00, 0x9c, 0xba, 0x70, 0xb7, 0x00, 0xb9, 0x2e, 0x00, 0x06, 0x84, 0xc0,
+  0x00, 0xa4, 0x1e, 0x30, 0x5c, 0x00, 0x3c, 0xc9, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b,
+  0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44,
+  0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee,
+  0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00,
+  0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10,
+  0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x2e, 0xdd, 0xdd, 0x01, 0xe2, 0x00, 0x00, 0x08, 0xa0, 0x00, 0x00, 0x0e, 0x30,
+  0x00, 0x00, 0x6b, 0x00, 0x00, 0x0a, 0x90, 0x00, 0x09, 0xb0, 0x00, 0x07, 0xc0,
+  0x00, 0x06, 0xd1, 0x00, 0x00, 0xce, 0xdd, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf3, 0x0d, 0x01,
+  0xe0, 0x00, 0x00, 0x98, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x0a, 0x70, 0x3a, 0x02,
+  0xd0, 0x01, 0xf0, 0xb5, 0x00, 0x0d, 0x6c, 0x00, 0x00, 0x9f, 0x40, 0x00, 0x02,
+  0x60, 0x23, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00,
+  0xfb, 0x00, 0x3e, 0xd1, 0xaf, 0x8a, 0x34, 0xe8, 0x0c, 0xb3, 0x3e, 0x80, 0xc3,
+  0xed, 0x2a, 0xf7, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee,
+  0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00,
+  0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10,
+  0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 0xf0, 0x05,
+  0x01, 0xce, 0xb0, 0x00, 0x88, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x2d, 0x00, 0x00, 0x05, 0xb0, 0x00, 0x11, 0x00, 0xf0, 0x02, 0x0b, 0x50,
+  0x00, 0x00, 0xe2, 0x00, 0x00, 0x2e, 0x00, 0x00, 0xbe, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xfb, 0x03, 0x2d, 0xd5, 0x4b, 0x09, 0x53,
+  0xcd, 0x30, 0x00, 0x00, 0x00, 0x08, 0xea, 0x1b, 0x31, 0xc0, 0x7e, 0x90, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0xf6,
+  0x0a, 0x05, 0x30, 0x00, 0x02, 0xd0, 0x09, 0xee, 0xff, 0xb0, 0x00, 0x6a, 0x00,
+  0x00, 0x1d, 0x10, 0x02, 0xef, 0xfe, 0xe3, 0x05, 0xb0, 0x00, 0x00, 0x51, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44,
+  0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xf5, 0x08, 0x05, 0x70, 0x00, 0x1a, 0xc2, 0x00, 0x3e, 0x80,
+  0x00, 0x04, 0xe5, 0x00, 0x00, 0x02, 0xd7, 0x00, 0x00, 0x01, 0x71, 0x07, 0xee,
+  0xee, 0xc0, 0x20, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xf5, 0x09, 0x05, 0x70, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00, 0x0a, 0xb0,
+  0x00, 0x03, 0xd9, 0x00, 0x07, 0xe4, 0x00, 0x03, 0x71, 0x00, 0x07, 0xee, 0xee,
+  0xc0, 0x21, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+  0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00,
+  0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1,
+  0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b,
+  0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44,
+  0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee,
+  0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00,
+  0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10,
+  0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac,
+  0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac,
+  0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00,
+  0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07, 0x50, 0xb1, 0x00, 0x75,
+  0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0xac, 0xcc, 0xd5, 0x0b, 0x10, 0x07,
+  0x50, 0xb1, 0x00, 0x75, 0x07, 0x00, 0x44, 0xac, 0xcc, 0xd5, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateItalicSmallFont(tableLength, table, glyphWidth, glyphHeight, glyphDataOffset, glyphData);
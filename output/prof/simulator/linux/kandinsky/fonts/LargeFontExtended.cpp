@@ -0,0 +1,969 @@
+/* This file is auto-generated by the rasterizer */
+
+#include <kandinsky/font.h>
+
+static constexpr KDFont::CodePointIndexPair table[] = {
+  KDFont::CodePointIndexPair(0x20, 0),
+  KDFont::CodePointIndexPair(0xb0, 95),
+  KDFont::CodePointIndexPair(0xb7, 97),
+  KDFont::CodePointIndexPair(0xc6, 98),
+  KDFont::CodePointIndexPair(0xd0, 99),
+  KDFont::CodePointIndexPair(0xd7, 100),
+  KDFont::CodePointIndexPair(0xde, 102),
+  KDFont::CodePointIndexPair(0xe6, 104),
+  KDFont::CodePointIndexPair(0xf0, 105),
+  KDFont::CodePointIndexPair(0xf7, 106),
+  KDFont::CodePointIndexPair(0xfe, 108),
+  KDFont::CodePointIndexPair(0x192, 109),
+  KDFont::CodePointIndexPair(0x300, 110),
+  KDFont::CodePointIndexPair(0x305, 114),
+  KDFont::CodePointIndexPair(0x308, 115),
+  KDFont::CodePointIndexPair(0x30a, 116),
+  KDFont::CodePointIndexPair(0x327, 118),
+  KDFont::CodePointIndexPair(0x391, 119),
+  KDFont::CodePointIndexPair(0x3a3, 136),
+  KDFont::CodePointIndexPair(0x3b1, 143),
+  KDFont::CodePointIndexPair(0x3c3, 160),
+  KDFont::CodePointIndexPair(0x454, 167),
+  KDFont::CodePointIndexPair(0x1d07, 168),
+  KDFont::CodePointIndexPair(0x2026, 169),
+  KDFont::CodePointIndexPair(0x212f, 170),
+  KDFont::CodePointIndexPair(0x2190, 171),
+  KDFont::CodePointIndexPair(0x21d0, 181),
+  KDFont::CodePointIndexPair(0x2200, 185),
+  KDFont::CodePointIndexPair(0x2202, 186),
+  KDFont::CodePointIndexPair(0x2208, 189),
+  KDFont::CodePointIndexPair(0x2211, 191),
+  KDFont::CodePointIndexPair(0x221a, 192),
+  KDFont::CodePointIndexPair(0x221e, 193),
+  KDFont::CodePointIndexPair(0x2229, 194),
+  KDFont::CodePointIndexPair(0x2248, 197),
+  KDFont::CodePointIndexPair(0x2260, 198),
+  KDFont::CodePointIndexPair(0x2264, 200),
+  KDFont::CodePointIndexPair(0x2282, 202),
+  KDFont::CodePointIndexPair(0x2284, 203),
+  KDFont::CodePointIndexPair(0x22c2, 204),
+  KDFont::CodePointIndexPair(0x2505, 206),
+  KDFont::CodePointIndexPair(0x27e6, 207),
+  KDFont::CodePointIndexPair(0xfffd, 209),
+  KDFont::CodePointIndexPair(0x1d422, 210),
+};
+
+static constexpr size_t tableLength = 44;
+
+static constexpr KDCoordinate glyphWidth = 10;
+
+static constexpr KDCoordinate glyphHeight = 18;
+
+static constexpr uint16_t glyphDataOffset[212] = {
+  0x0000, 0x000b, 0x003b, 0x006c, 0x00af, 0x00f6, 0x013a, 0x017e, 0x01a6,
+  0x01f8, 0x0240, 0x026f, 0x0290, 0x02b8, 0x02cc, 0x02e6, 0x0337, 0x037a,
+  0x03a4, 0x03e6, 0x0428, 0x0465, 0x04a8, 0x04eb, 0x052b, 0x056e, 0x05b1,
+  0x05cc, 0x0604, 0x0634, 0x064b, 0x067c, 0x06bd, 0x070c, 0x074f, 0x0793,
+  0x07d5, 0x081a, 0x0851, 0x087d, 0x08c0, 0x08ed, 0x0916, 0x0941, 0x0985,
+  0x09a4, 0x09e4, 0x0a26, 0x0a68, 0x0aa3, 0x0af3, 0x0b38, 0x0b7b, 0x0b9e,
+  0x0bcd, 0x0c11, 0x0c56, 0x0c9b, 0x0cd3, 0x0d16, 0x0d39, 0x0d85, 0x0da8,
+  0x0dd8, 0x0df3, 0x0e11, 0x0e4a, 0x0e88, 0x0ebb, 0x0efe, 0x0f37, 0x0f6c,
+  0x0fb2, 0x0fea, 0x101a, 0x1051, 0x108e, 0x10b3, 0x10de, 0x110c, 0x1143,
+  0x117d, 0x11bb, 0x11e2, 0x121b, 0x1256, 0x127e, 0x12b3, 0x12e9, 0x1320,
+  0x1363, 0x139a, 0x13d6, 0x13e9, 0x142b, 0x1447, 0x146d, 0x1498, 0x14b4,
+  0x14bf, 0x1504, 0x1537, 0x157c, 0x15ba, 0x1604, 0x163f, 0x1687, 0x16af,
+  0x16ea, 0x172a, 0x1773, 0x1791, 0x17af, 0x17cb, 0x17e7, 0x17fe, 0x1817,
+  0x1837, 0x1858, 0x1873, 0x18b6, 0x18fa, 0x191b, 0x195e, 0x1995, 0x19d8,
+  0x1a05, 0x1a46, 0x1a6f, 0x1ab3, 0x1af7, 0x1b37, 0x1b79, 0x1ba9, 0x1beb,
+  0x1c0f, 0x1c4a, 0x1c85, 0x1ca8, 0x1ce0, 0x1d20, 0x1d65, 0x1d9a, 0x1dde,
+  0x1e18, 0x1e6a, 0x1eaa, 0x1ef2, 0x1f2b, 0x1f7d, 0x1faf, 0x1ff8, 0x201d,
+  0x2054, 0x209d, 0x20cf, 0x2104, 0x215a, 0x2193, 0x21ca, 0x220a, 0x223f,
+  0x2265, 0x229b, 0x22e1, 0x2324, 0x2366, 0x239d, 0x23d5, 0x2404, 0x2422,
+  0x245b, 0x2492, 0x24c6, 0x24fc, 0x252a, 0x2535, 0x2573, 0x25a8, 0x25d9,
+  0x260b, 0x263c, 0x2674, 0x26aa, 0x26e1, 0x2712, 0x2755, 0x2796, 0x27c6,
+  0x280f, 0x2849, 0x288e, 0x28d3, 0x292b, 0x2958, 0x298a, 0x29bb, 0x2a09,
+  0x2a29, 0x2a5e, 0x2a75, 0x2aae, 0x2ae9, 0x2b19, 0x2b55, 0x2b81, 0x2bb0,
+  0x2bd1, 0x2bf5, 0x2c1b, 0x2c60, 0x2c93
+};
+
+/* Rasterized  = 37980 bytes (211 glyphs x 180 pixels)
+ * Downsampled = 18990 bytes (1/2 of rasterized)
+ * Compressed  = 11411 bytes (30.04% of rasterized) */
+static constexpr uint8_t glyphData[11411] = {
+  0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x01, 0x00, 0x10, 0xc6, 0x05, 0x00, 0x15, 0xd6, 0x0a, 0x00, 0x10, 0xc5, 0x05,
+  0x00, 0x10, 0xb5, 0x05, 0x00, 0x10, 0xb4, 0x05, 0x00, 0x15, 0xa4, 0x28, 0x00,
+  0xbd, 0x63, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x02, 0xea, 0x44,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x13,
+  0x22, 0x00, 0x31, 0x00, 0x00, 0xed, 0x03, 0xf8, 0x00, 0x00, 0xec, 0x03, 0xf7,
+  0x00, 0x00, 0xcb, 0x01, 0xf6, 0x00, 0x00, 0xa9, 0x00, 0xf4, 0x00, 0x00, 0x87,
+  0x00, 0xd2, 0x00, 0x00, 0x11, 0x00, 0x20, 0x00, 0x01, 0x00, 0x15, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x04, 0x30, 0x43,
+  0x00, 0x00, 0x09, 0x40, 0x93, 0x00, 0x00, 0x0b, 0x20, 0xb1, 0x00, 0x02, 0xaf,
+  0xba, 0xfa, 0x30, 0x01, 0x4f, 0x44, 0xf4, 0x10, 0x00, 0x1c, 0x01, 0xc0, 0x00,
+  0x03, 0x9f, 0x69, 0xf5, 0x00, 0x05, 0xef, 0x8e, 0xf8, 0x00, 0x00, 0x76, 0x07,
+  0x60, 0x00, 0x00, 0x94, 0x09, 0x40, 0x00, 0x00, 0x82, 0x09, 0x20, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10, 0x10, 0x05,
+  0x00, 0x14, 0x96, 0x05, 0x00, 0xb0, 0x3d, 0xff, 0xc2, 0x00, 0x00, 0xe8, 0x11,
+  0x78, 0x00, 0x02, 0xf3, 0x13, 0x00, 0xd0, 0xbe, 0x50, 0x00, 0x00, 0x00, 0x07,
+  0xee, 0x80, 0x00, 0x00, 0x00, 0x05, 0xec, 0x11, 0x00, 0xf5, 0x00, 0x3f, 0x20,
+  0x04, 0x91, 0x00, 0x6f, 0x00, 0x02, 0xaf, 0xff, 0xe4, 0x00, 0x00, 0x01, 0xc9,
+  0x3c, 0x00, 0x13, 0x53, 0x4e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0x01, 0x00, 0xfb, 0x27, 0x31, 0x00, 0x00, 0x00, 0x1d, 0x9d, 0x40, 0x03,
+  0xd0, 0x68, 0x03, 0xc0, 0x1d, 0x40, 0x86, 0x01, 0xd0, 0xc4, 0x00, 0x5a, 0x05,
+  0xa0, 0x30, 0x00, 0x09, 0xdc, 0x20, 0x22, 0x00, 0x00, 0x03, 0x0a, 0xab, 0x80,
+  0x00, 0x88, 0x2d, 0x00, 0xe0, 0x08, 0xb0, 0x4b, 0x00, 0xd2, 0x4d, 0x00, 0x1e,
+  0x01, 0xe0, 0x01, 0x00, 0x06, 0xdd, 0x40, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfb, 0x27, 0x2b, 0xd6, 0x00, 0x00, 0x00,
+  0xc7, 0x2f, 0x20, 0x00, 0x00, 0xf1, 0x0d, 0x30, 0x00, 0x00, 0xe3, 0x6c, 0x00,
+  0x00, 0x00, 0xaf, 0xd1, 0x00, 0x00, 0x01, 0xef, 0x40, 0x03, 0xc0, 0x0c, 0xa7,
+  0xd1, 0x09, 0x90, 0x3f, 0x00, 0xbc, 0x2e, 0x30, 0x4f, 0x00, 0x0b, 0xfc, 0x00,
+  0x0e, 0xb2, 0x2b, 0xff, 0x70, 0x02, 0xbf, 0xe9, 0x05, 0xc0, 0x45, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x60, 0x32, 0x00, 0x00,
+  0x00, 0x01, 0xfa, 0x0a, 0x00, 0x01, 0x05, 0x00, 0x10, 0xf8, 0x05, 0x00, 0x10,
+  0xd6, 0x05, 0x00, 0x10, 0xb5, 0x05, 0x00, 0x2f, 0x10, 0x00, 0x01, 0x00, 0x16,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf0, 0x05, 0x75,
+  0x00, 0x00, 0x00, 0x07, 0xd1, 0x00, 0x00, 0x00, 0x3e, 0x10, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x13, 0x00, 0xf0, 0x0b, 0xb0, 0x00, 0x00,
+  0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x08, 0xa0,
+  0x00, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xf1, 0x36, 0x00, 0x10,
+  0xa9, 0x05, 0x00, 0xf0, 0x03, 0x1e, 0x40, 0x00, 0x00, 0x00, 0x04, 0xe3, 0x00,
+  0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x10, 0xa2, 0x05, 0x00, 0x70, 0x5e, 0x20, 0x00, 0x00, 0x00, 0x07, 0xc0,
+  0x0b, 0x00, 0x10, 0xd6, 0x05, 0x00, 0x10, 0x6c, 0x05, 0x00, 0x10, 0x1f, 0x05,
+  0x00, 0x10, 0x0f, 0x1a, 0x00, 0x24, 0x0e, 0x30, 0x0a, 0x00, 0x10, 0x3f, 0x14,
+  0x00, 0xf0, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xe4, 0x00, 0x00, 0x00, 0x0a,
+  0xa0, 0x00, 0x00, 0x00, 0x9c, 0x13, 0x00, 0x90, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x10, 0x93, 0x05, 0x00,
+  0xff, 0x0c, 0xa4, 0x00, 0x00, 0x07, 0xa5, 0xb6, 0x7c, 0x10, 0x00, 0x4b, 0xff,
+  0x82, 0x00, 0x00, 0x07, 0xde, 0x10, 0x00, 0x00, 0x2e, 0x17, 0xb0, 0x00, 0x00,
+  0x84, 0x00, 0xa2, 0x3a, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x02, 0x10, 0x10, 0x05, 0x00, 0x18, 0xb5, 0x05, 0x00, 0x5b,
+  0x09, 0xff, 0xff, 0xff, 0x30, 0x14, 0x00, 0x03, 0x28, 0x00, 0x0e, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x25, 0xf0, 0x12,
+  0x97, 0x00, 0x00, 0x00, 0x05, 0xff, 0x30, 0x00, 0x00, 0x01, 0xaf, 0x40, 0x00,
+  0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0a, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x14, 0x5f,
+  0x09, 0xff, 0xff, 0xff, 0x30, 0x2d, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x24, 0xcd, 0x01, 0x96, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0x00, 0x00, 0x00, 0x03, 0xeb, 0x1d, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x01, 0x00, 0x10, 0x27, 0x05, 0x00, 0x10, 0x99, 0x05, 0x00,
+  0xf0, 0x05, 0xe3, 0x00, 0x00, 0x00, 0x05, 0xd0, 0x00, 0x00, 0x00, 0x0b, 0x70,
+  0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x7b, 0x18, 0x00, 0xf0, 0x05,
+  0xd5, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00,
+  0x00, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x5d, 0x18, 0x00, 0xf0, 0x04, 0xb7, 0x00,
+  0x00, 0x00, 0x01, 0xf1, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x05, 0x88, 0x20,
+  0x00, 0x00, 0xae, 0x8a, 0xf4, 0x00, 0x04, 0xf1, 0x00, 0x7d, 0x00, 0x09, 0xa0,
+  0x00, 0x0f, 0x30, 0x0c, 0x70, 0x63, 0x0d, 0x60, 0x0d, 0x62, 0xfc, 0x0c, 0x70,
+  0x0c, 0x60, 0x84, 0x0d, 0x60, 0x0a, 0x80, 0x00, 0x0f, 0x40, 0x06, 0xd0, 0x00,
+  0x4f, 0x00, 0x00, 0xd9, 0x13, 0xd7, 0x00, 0x00, 0x2b, 0xfe, 0x70, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xb0, 0x35, 0x00,
+  0x00, 0x00, 0x9e, 0xfd, 0x00, 0x00, 0x00, 0x23, 0x9d, 0x0f, 0x00, 0x1f, 0x8d,
+  0x05, 0x00, 0x08, 0xab, 0x02, 0x44, 0xad, 0x44, 0x20, 0x05, 0xdd, 0xdd, 0xdd,
+  0x60, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0xd0, 0x27, 0x97, 0x10, 0x00, 0x06, 0xfa, 0x8c, 0xe2, 0x00, 0x05, 0x30, 0x00,
+  0xba, 0x11, 0x00, 0x10, 0x8c, 0x05, 0x00, 0xfb, 0x11, 0xb9, 0x00, 0x00, 0x00,
+  0x04, 0xf2, 0x00, 0x00, 0x00, 0x2e, 0x50, 0x00, 0x00, 0x02, 0xe7, 0x00, 0x00,
+  0x00, 0x3e, 0x60, 0x00, 0x00, 0x04, 0xfa, 0x45, 0x55, 0x10, 0x0a, 0xdd, 0xdd,
+  0xdd, 0x40, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xd0, 0x17, 0x97, 0x20, 0x00, 0x05, 0xfa, 0x8b, 0xf5, 0x00, 0x01, 0x30,
+  0x00, 0x9d, 0x11, 0x00, 0xf0, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x16, 0xe4, 0x00,
+  0x00, 0x0c, 0xff, 0x50, 0x00, 0x00, 0x00, 0x15, 0xd8, 0x14, 0x00, 0xfc, 0x01,
+  0x2f, 0x20, 0x01, 0x00, 0x00, 0x2f, 0x30, 0x0d, 0xa3, 0x24, 0xdd, 0x00, 0x01,
+  0x9d, 0xfe, 0x91, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x01, 0x00, 0xf4, 0x1c, 0x02, 0x60, 0x00, 0x00, 0x00, 0x1e, 0xf2, 0x00, 0x00,
+  0x00, 0xb9, 0xf2, 0x00, 0x00, 0x08, 0xc1, 0xf2, 0x00, 0x00, 0x5e, 0x11, 0xf2,
+  0x00, 0x02, 0xe3, 0x01, 0xf2, 0x00, 0x0d, 0x71, 0x12, 0xf3, 0x00, 0x5f, 0xff,
+  0xff, 0xff, 0xb0, 0x00, 0x00, 0x01, 0xf2, 0x00, 0x05, 0x00, 0x1c, 0xd1, 0x44,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf0, 0x0d,
+  0x66, 0x66, 0x65, 0x00, 0x00, 0xfc, 0xbb, 0xb9, 0x00, 0x01, 0xf2, 0x00, 0x00,
+  0x00, 0x02, 0xf1, 0x00, 0x00, 0x00, 0x03, 0xf6, 0x99, 0x50, 0x00, 0x02, 0xd8,
+  0x68, 0xfa, 0x20, 0x00, 0xfc, 0x06, 0x4f, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x50,
+  0x01, 0x00, 0x00, 0x2f, 0x30, 0x0d, 0x93, 0x14, 0xeb, 0x00, 0x01, 0x9d, 0xfe,
+  0x80, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0xfc, 0x26, 0x01, 0x79, 0x71, 0x00, 0x00, 0x4f, 0xc8, 0xbe, 0x10, 0x00, 0xe7,
+  0x00, 0x01, 0x00, 0x06, 0xe0, 0x00, 0x00, 0x00, 0x0a, 0x90, 0x46, 0x30, 0x00,
+  0x0b, 0xad, 0xa9, 0xeb, 0x00, 0x0b, 0xe2, 0x00, 0x1f, 0x50, 0x0a, 0x90, 0x00,
+  0x0b, 0x80, 0x05, 0xe0, 0x00, 0x0d, 0x60, 0x00, 0xca, 0x21, 0x9e, 0x10, 0x00,
+  0x1a, 0xef, 0xb2, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0xf0, 0x0d, 0x05, 0x66, 0x66, 0x66, 0x30, 0x0a, 0xbb, 0xbb, 0xcf,
+  0x60, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x04, 0xd0, 0x00, 0x00, 0x00,
+  0x0d, 0x50, 0x00, 0x00, 0x00, 0x5e, 0x20, 0x00, 0x10, 0xa9, 0x05, 0x00, 0x60,
+  0xe5, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x1d, 0x00, 0x10, 0xf1, 0x05, 0x00, 0x2c,
+  0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xfc, 0x26, 0x05, 0x88, 0x30, 0x00, 0x00, 0xad, 0x78, 0xf6, 0x00, 0x02,
+  0xf1, 0x00, 0x4e, 0x00, 0x02, 0xf0, 0x00, 0x2f, 0x00, 0x00, 0xac, 0x30, 0x98,
+  0x00, 0x00, 0x1e, 0xfe, 0xc0, 0x00, 0x03, 0xd3, 0x06, 0xdb, 0x00, 0x0c, 0x60,
+  0x00, 0x1f, 0x50, 0x0d, 0x50, 0x00, 0x0d, 0x70, 0x07, 0xe4, 0x00, 0x7f, 0x20,
+  0x00, 0x6d, 0xff, 0xb3, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0x01, 0x00, 0xfc, 0x26, 0x16, 0x96, 0x10, 0x00, 0x02, 0xeb, 0x7b, 0xe2,
+  0x00, 0x0a, 0xa0, 0x00, 0x9c, 0x00, 0x0e, 0x50, 0x00, 0x1f, 0x20, 0x0d, 0x70,
+  0x00, 0x1f, 0x50, 0x07, 0xe5, 0x36, 0xcf, 0x50, 0x00, 0x6c, 0xc9, 0x1f, 0x40,
+  0x00, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x05, 0x93, 0x28,
+  0xf3, 0x00, 0x01, 0xaf, 0xfb, 0x30, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xcf, 0x01, 0x96, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0x00, 0x00, 0x00, 0x03, 0xeb, 0x1e, 0x00, 0x1c, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xde, 0x01, 0x96, 0x00, 0x00, 0x00,
+  0x07, 0xff, 0x00, 0x00, 0x00, 0x03, 0xeb, 0x00, 0x01, 0x00, 0xf0, 0x12, 0x97,
+  0x00, 0x00, 0x00, 0x05, 0xff, 0x30, 0x00, 0x00, 0x01, 0xaf, 0x40, 0x00, 0x00,
+  0x00, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x03, 0xf2, 0x06,
+  0x2a, 0x00, 0x00, 0x00, 0x06, 0xe7, 0x00, 0x00, 0x01, 0xbc, 0x20, 0x00, 0x00,
+  0x6e, 0x80, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x14, 0x00,
+  0x01, 0x1e, 0x00, 0x02, 0x28, 0x00, 0x0e, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x5f, 0x09, 0xff, 0xff, 0xff, 0x30,
+  0x14, 0x00, 0x10, 0x0b, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
+  0x00, 0x00, 0x01, 0x00, 0xd0, 0x04, 0x80, 0x00, 0x00, 0x00, 0x01, 0xbd, 0x20,
+  0x00, 0x00, 0x00, 0x06, 0xe7, 0x11, 0x00, 0x20, 0x2c, 0xc2, 0x06, 0x00, 0x13,
+  0xca, 0x0a, 0x00, 0x00, 0x14, 0x00, 0x33, 0x01, 0xbc, 0x20, 0x28, 0x00, 0x0f,
+  0x01, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00,
+  0xc0, 0x10, 0x00, 0x00, 0x00, 0x5e, 0xff, 0x90, 0x00, 0x00, 0xb4, 0x03, 0xe7,
+  0x10, 0x00, 0xf4, 0x05, 0xa9, 0x00, 0x00, 0x00, 0x01, 0xe5, 0x00, 0x00, 0x00,
+  0x1d, 0x80, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x02, 0xf1, 0x28, 0x00,
+  0xdc, 0x00, 0x61, 0x00, 0x00, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x00, 0x05, 0xf7,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00,
+  0xf0, 0x23, 0x35, 0x30, 0x00, 0x00, 0x2d, 0xb9, 0xca, 0x00, 0x01, 0xe4, 0x00,
+  0x0b, 0x50, 0x09, 0x80, 0x00, 0x05, 0xa0, 0x0e, 0x10, 0x00, 0x37, 0xb0, 0x1e,
+  0x00, 0x6d, 0xba, 0xb0, 0x3d, 0x03, 0xe1, 0x04, 0xb0, 0x2d, 0x06, 0xb0, 0x07,
+  0xb0, 0x1f, 0x01, 0xea, 0xa9, 0xb0, 0x0d, 0x30, 0x15, 0x30, 0x20, 0x06, 0xa0,
+  0x36, 0x00, 0xf0, 0x04, 0xc8, 0x00, 0x04, 0x00, 0x00, 0x09, 0xec, 0xd9, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01,
+  0x00, 0xfb, 0x26, 0xa7, 0x00, 0x00, 0x00, 0x05, 0xde, 0x00, 0x00, 0x00, 0x0b,
+  0x6e, 0x40, 0x00, 0x00, 0x0f, 0x29, 0x90, 0x00, 0x00, 0x5d, 0x04, 0xe0, 0x00,
+  0x00, 0xb8, 0x00, 0xf4, 0x00, 0x00, 0xfb, 0x77, 0xfb, 0x00, 0x05, 0xf9, 0x99,
+  0xff, 0x00, 0x0b, 0x90, 0x00, 0x0f, 0x40, 0x1f, 0x40, 0x00, 0x0b, 0xa0, 0x4c,
+  0x00, 0x00, 0x05, 0xc0, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xf0, 0x00, 0x04, 0xbb, 0xa9, 0x50, 0x00, 0x06, 0xf7, 0x79,
+  0xeb, 0x00, 0x06, 0xe0, 0x00, 0x4f, 0x10, 0x05, 0x00, 0xa0, 0x00, 0x06, 0xe4,
+  0x46, 0xd7, 0x00, 0x06, 0xfd, 0xde, 0xc5, 0x14, 0x00, 0xfb, 0x07, 0x3e, 0x60,
+  0x06, 0xe0, 0x00, 0x09, 0xb0, 0x06, 0xe0, 0x00, 0x0c, 0xa0, 0x06, 0xe5, 0x56,
+  0xbf, 0x30, 0x05, 0xdd, 0xcc, 0x92, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf0, 0x0b, 0x04, 0xad, 0xc6, 0x00, 0x00,
+  0x7f, 0x95, 0x6e, 0x50, 0x03, 0xf5, 0x00, 0x01, 0x00, 0x0a, 0xc0, 0x00, 0x00,
+  0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x05, 0x00, 0x00, 0x0a, 0x00,
+  0xfc, 0x04, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x05, 0xf4, 0x00, 0x00, 0x10, 0x00,
+  0xaf, 0x73, 0x4c, 0x90, 0x00, 0x07, 0xdf, 0xe8, 0x45, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfb, 0x28, 0x06, 0xba, 0xa7, 0x20,
+  0x00, 0x09, 0xd6, 0x7b, 0xf6, 0x00, 0x09, 0xb0, 0x00, 0x7f, 0x20, 0x09, 0xb0,
+  0x00, 0x0e, 0x80, 0x09, 0xb0, 0x00, 0x0a, 0xb0, 0x09, 0xb0, 0x00, 0x08, 0xd0,
+  0x09, 0xb0, 0x00, 0x09, 0xc0, 0x09, 0xb0, 0x00, 0x0d, 0x90, 0x09, 0xb0, 0x00,
+  0x6f, 0x30, 0x09, 0xc4, 0x5a, 0xf7, 0x00, 0x07, 0xdd, 0xc9, 0x30, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf2, 0x00,
+  0x01, 0xbb, 0xbb, 0xbb, 0x30, 0x02, 0xf8, 0x77, 0x77, 0x20, 0x02, 0xf2, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x83, 0xf6, 0x44, 0x42, 0x00, 0x02, 0xfe, 0xdd, 0xd7,
+  0x0f, 0x00, 0x06, 0x05, 0x00, 0x9b, 0xf7, 0x55, 0x55, 0x20, 0x02, 0xdd, 0xdd,
+  0xdd, 0x60, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xb0, 0x9b, 0xbb, 0xbb, 0x60, 0x00, 0xeb, 0x77, 0x77, 0x40, 0x00, 0xe7,
+  0x0f, 0x00, 0x06, 0x05, 0x00, 0x9c, 0xef, 0xff, 0xfc, 0x00, 0x00, 0xe8, 0x11,
+  0x11, 0x00, 0x19, 0x00, 0x2d, 0xb6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x06, 0xbd, 0xb4, 0x00, 0x00,
+  0xbe, 0x75, 0x7f, 0x20, 0x07, 0xf2, 0x00, 0x01, 0x00, 0x0d, 0x90, 0x00, 0x00,
+  0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x2f, 0x40, 0x07, 0xaa, 0x50, 0x1f, 0x50,
+  0x05, 0x7d, 0x80, 0x0e, 0x80, 0x00, 0x0b, 0x80, 0x08, 0xe1, 0x00, 0x0b, 0x80,
+  0x00, 0xdd, 0x53, 0x6e, 0x80, 0x00, 0x08, 0xef, 0xd7, 0x45, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xa7, 0x08, 0x60, 0x00, 0x0b,
+  0x30, 0x0b, 0x90, 0x00, 0x0f, 0x50, 0x05, 0x00, 0x88, 0xb4, 0x44, 0x4f, 0x50,
+  0x0b, 0xfd, 0xdd, 0xdf, 0x14, 0x00, 0x05, 0x05, 0x00, 0x5b, 0x09, 0x70, 0x00,
+  0x0d, 0x40, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xef, 0x05, 0xbb, 0xbb, 0xbb, 0x00, 0x03, 0x77, 0xeb, 0x77, 0x00, 0x00,
+  0x00, 0xe7, 0x00, 0x05, 0x00, 0x0c, 0xab, 0x02, 0x55, 0xea, 0x55, 0x00, 0x06,
+  0xdd, 0xdd, 0xdd, 0x10, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0x01, 0x00, 0x80, 0x9b, 0xbb, 0xba, 0x00, 0x00, 0x56, 0x66, 0xae, 0x0c,
+  0x00, 0x1f, 0x7e, 0x05, 0x00, 0x07, 0xec, 0x01, 0x30, 0x00, 0xac, 0x00, 0x07,
+  0xe6, 0x37, 0xf6, 0x00, 0x00, 0x7d, 0xfd, 0x70, 0x45, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x1d, 0x04, 0x90, 0x00, 0x09,
+  0x60, 0x07, 0xe0, 0x00, 0x9d, 0x00, 0x07, 0xe0, 0x07, 0xe2, 0x00, 0x07, 0xe0,
+  0x4f, 0x30, 0x00, 0x07, 0xe3, 0xff, 0x00, 0x00, 0x07, 0xfe, 0xbf, 0x40, 0x00,
+  0x07, 0xfb, 0x09, 0xd0, 0x00, 0x07, 0xf0, 0x01, 0xf6, 0x00, 0x07, 0xe0, 0x00,
+  0x8e, 0x05, 0x00, 0x7b, 0x0e, 0x80, 0x05, 0xb0, 0x00, 0x05, 0xc1, 0x46, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x10, 0x94, 0x05,
+  0x00, 0x1f, 0xd7, 0x05, 0x00, 0x14, 0x9b, 0xda, 0x55, 0x55, 0x30, 0x00, 0xbd,
+  0xdd, 0xdd, 0x80, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0xf0, 0x17, 0x09, 0x90, 0x00, 0x3b, 0x40, 0x0d, 0xf2, 0x00, 0x9f,
+  0x70, 0x0d, 0xd7, 0x00, 0xed, 0x70, 0x0d, 0x9d, 0x03, 0xdb, 0x70, 0x0d, 0x6f,
+  0x29, 0x8c, 0x70, 0x0d, 0x69, 0x7e, 0x2d, 0x70, 0x0d, 0x64, 0xec, 0x0d, 0x70,
+  0x0d, 0x60, 0xe7, 0x05, 0x00, 0x13, 0x00, 0x05, 0x00, 0x5b, 0x0a, 0x50, 0x00,
+  0x0a, 0x50, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xc0, 0x07, 0xa0, 0x00, 0x0a, 0x30, 0x0b, 0xf6, 0x00, 0x0f, 0x40, 0x0b,
+  0xcd, 0x05, 0x00, 0xc0, 0x8d, 0x60, 0x0f, 0x40, 0x0b, 0x86, 0xe0, 0x0f, 0x40,
+  0x0b, 0x90, 0xd6, 0x05, 0x00, 0x10, 0x6e, 0x05, 0x00, 0xfb, 0x03, 0x0d, 0x6e,
+  0x40, 0x0b, 0x90, 0x05, 0xdd, 0x40, 0x0b, 0x90, 0x00, 0xdf, 0x40, 0x08, 0x70,
+  0x00, 0x5d, 0x30, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0xf1, 0x0e, 0x19, 0xdc, 0x60, 0x00, 0x01, 0xec, 0x57, 0xe9, 0x00,
+  0x0a, 0xd0, 0x00, 0x4f, 0x30, 0x0f, 0x60, 0x00, 0x0d, 0x90, 0x2f, 0x30, 0x00,
+  0x09, 0xb0, 0x3f, 0x20, 0x00, 0x09, 0xc0, 0x0a, 0x00, 0xfc, 0x04, 0x0f, 0x60,
+  0x00, 0x0c, 0x90, 0x0a, 0xc0, 0x00, 0x3f, 0x40, 0x02, 0xfa, 0x35, 0xea, 0x00,
+  0x00, 0x2b, 0xfe, 0x80, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xf7, 0x18, 0x04, 0xbb, 0xaa, 0x71, 0x00, 0x06, 0xf6, 0x67,
+  0xce, 0x20, 0x06, 0xf0, 0x00, 0x0d, 0x80, 0x06, 0xf0, 0x00, 0x0b, 0xa0, 0x06,
+  0xf0, 0x00, 0x0e, 0x70, 0x06, 0xf7, 0x78, 0xdd, 0x10, 0x06, 0xfa, 0xa9, 0x50,
+  0x00, 0x06, 0xf0, 0x00, 0x00, 0x05, 0x00, 0x3d, 0x04, 0xc0, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf0, 0x3b, 0x19,
+  0xdc, 0x60, 0x00, 0x01, 0xec, 0x57, 0xe9, 0x00, 0x0a, 0xd0, 0x00, 0x4f, 0x30,
+  0x0f, 0x60, 0x00, 0x0d, 0x90, 0x2f, 0x30, 0x00, 0x0a, 0xb0, 0x3f, 0x20, 0x00,
+  0x09, 0xc0, 0x2f, 0x30, 0x00, 0x09, 0xb0, 0x0f, 0x60, 0x00, 0x0c, 0x90, 0x0a,
+  0xc0, 0x00, 0x3f, 0x40, 0x02, 0xf9, 0x24, 0xda, 0x00, 0x00, 0x2b, 0xff, 0x80,
+  0x00, 0x00, 0x00, 0x8e, 0x10, 0x00, 0x00, 0x00, 0x0b, 0xfc, 0x90, 0x00, 0x00,
+  0x00, 0x36, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfb,
+  0x28, 0x04, 0xbb, 0xaa, 0x71, 0x00, 0x06, 0xf6, 0x67, 0xde, 0x10, 0x06, 0xe0,
+  0x00, 0x0f, 0x60, 0x06, 0xe0, 0x00, 0x0d, 0x70, 0x06, 0xe0, 0x00, 0x4f, 0x40,
+  0x06, 0xfb, 0xcf, 0xf8, 0x00, 0x06, 0xf6, 0x8f, 0x70, 0x00, 0x06, 0xe0, 0x09,
+  0xe0, 0x00, 0x06, 0xe0, 0x01, 0xe7, 0x00, 0x06, 0xe0, 0x00, 0x6f, 0x10, 0x05,
+  0xb0, 0x00, 0x0b, 0x70, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0x01, 0x00, 0xf0, 0x01, 0x19, 0xdd, 0x91, 0x00, 0x01, 0xeb, 0x55, 0xae,
+  0x00, 0x05, 0xf0, 0x00, 0x01, 0x00, 0x05, 0xf3, 0x14, 0x00, 0xfc, 0x12, 0xbf,
+  0x92, 0x00, 0x00, 0x00, 0x06, 0xef, 0xa2, 0x00, 0x00, 0x00, 0x05, 0xde, 0x20,
+  0x00, 0x00, 0x00, 0x0f, 0x80, 0x02, 0x10, 0x00, 0x0d, 0x80, 0x0a, 0xe7, 0x33,
+  0x9f, 0x20, 0x00, 0x6c, 0xff, 0xb3, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x01, 0x00, 0xd0, 0x3b, 0xbb, 0xbb, 0xbb, 0xa0, 0x27, 0x77,
+  0xeb, 0x77, 0x60, 0x00, 0x00, 0xe7, 0x11, 0x00, 0x0f, 0x05, 0x00, 0x10, 0x2c,
+  0xb6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xaf, 0x08, 0x60, 0x00, 0x0a, 0x30, 0x0b, 0x90, 0x00, 0x0f, 0x50, 0x05,
+  0x00, 0x07, 0xfb, 0x04, 0xa0, 0x00, 0x0f, 0x40, 0x08, 0xd0, 0x00, 0x3f, 0x20,
+  0x02, 0xfa, 0x34, 0xdb, 0x00, 0x00, 0x3b, 0xfe, 0x90, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfc, 0x27, 0x2b, 0x20,
+  0x00, 0x06, 0x80, 0x0e, 0x70, 0x00, 0x0c, 0x80, 0x09, 0xc0, 0x00, 0x1f, 0x30,
+  0x04, 0xf1, 0x00, 0x6e, 0x00, 0x00, 0xf5, 0x00, 0xb9, 0x00, 0x00, 0xaa, 0x00,
+  0xf4, 0x00, 0x00, 0x5e, 0x04, 0xe0, 0x00, 0x00, 0x0f, 0x39, 0xa0, 0x00, 0x00,
+  0x0b, 0x8d, 0x40, 0x00, 0x00, 0x06, 0xef, 0x00, 0x00, 0x00, 0x01, 0xc9, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfb,
+  0x28, 0x87, 0x00, 0x00, 0x00, 0xb4, 0xac, 0x00, 0x00, 0x02, 0xf4, 0x8e, 0x00,
+  0x00, 0x03, 0xf1, 0x5f, 0x00, 0xea, 0x05, 0xf0, 0x3f, 0x22, 0xfe, 0x07, 0xd0,
+  0x0f, 0x46, 0xaf, 0x29, 0xa0, 0x0e, 0x6b, 0x6c, 0x6b, 0x80, 0x0b, 0x8e, 0x39,
+  0xac, 0x60, 0x09, 0xbf, 0x05, 0xde, 0x30, 0x07, 0xfb, 0x01, 0xff, 0x10, 0x03,
+  0xd6, 0x00, 0xbc, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xf0, 0x25, 0x07, 0x80, 0x00, 0x0a, 0x30, 0x03, 0xf3, 0x00,
+  0x8d, 0x00, 0x00, 0xab, 0x01, 0xf4, 0x00, 0x00, 0x1f, 0x49, 0xb0, 0x00, 0x00,
+  0x08, 0xdf, 0x20, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x0a, 0xbf, 0x30,
+  0x00, 0x00, 0x3f, 0x19, 0xc0, 0x00, 0x00, 0xc8, 0x01, 0xf6, 0x00, 0x06, 0xe1,
+  0x00, 0x7e, 0x00, 0x0b, 0x60, 0x03, 0x00, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x12, 0x2b, 0x20, 0x00, 0x06,
+  0x80, 0x0c, 0x90, 0x00, 0x0e, 0x50, 0x04, 0xf2, 0x00, 0x7d, 0x00, 0x00, 0xb9,
+  0x00, 0xe5, 0x00, 0x00, 0x3f, 0x27, 0xc0, 0x00, 0x00, 0x0b, 0xae, 0x40, 0x00,
+  0x00, 0x02, 0xfc, 0x25, 0x00, 0x1a, 0xe7, 0x05, 0x00, 0x2c, 0xb6, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x11,
+  0x05, 0xbb, 0xbb, 0xbb, 0x60, 0x03, 0x66, 0x66, 0x9f, 0x40, 0x00, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00,
+  0x00, 0xd8, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x00, 0x60, 0x4f, 0x20, 0x00, 0x00,
+  0x00, 0xd7, 0x0e, 0x00, 0x9b, 0xe5, 0x55, 0x55, 0x30, 0x0c, 0xdd, 0xdd, 0xdd,
+  0x80, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0xdf, 0x03, 0x88, 0x88, 0x00, 0x00, 0x06, 0xb3, 0x33, 0x00, 0x00, 0x06, 0xa0,
+  0x00, 0x05, 0x00, 0x22, 0xd0, 0xd8, 0x88, 0x00, 0x00, 0x01, 0x33, 0x33, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x70, 0x02, 0x70, 0x00,
+  0x00, 0x00, 0x01, 0xf2, 0x0b, 0x00, 0x10, 0xa8, 0x05, 0x00, 0x10, 0x4e, 0x05,
+  0x00, 0x70, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x1f, 0x00, 0x10, 0xf1,
+  0x10, 0x00, 0x10, 0xc6, 0x05, 0x00, 0x10, 0x6c, 0x05, 0x00, 0xc0, 0x0f, 0x20,
+  0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x04, 0xe0, 0x10, 0x00, 0x10,
+  0xd4, 0x05, 0x00, 0xc0, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x80, 0x03, 0x88, 0x88, 0x00, 0x00,
+  0x01, 0x33, 0x4f, 0x0c, 0x00, 0x1f, 0x1f, 0x05, 0x00, 0x21, 0x30, 0x03, 0x88,
+  0x8f, 0x41, 0x00, 0x80, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x01, 0x00, 0xff, 0x12, 0xd8, 0x00, 0x00, 0x00, 0x05, 0xce, 0x00, 0x00,
+  0x00, 0x0b, 0x5b, 0x50, 0x00, 0x00, 0x2e, 0x05, 0xb0, 0x00, 0x00, 0x89, 0x00,
+  0xf2, 0x00, 0x00, 0xe3, 0x00, 0x98, 0x00, 0x00, 0x40, 0x00, 0x13, 0x00, 0x01,
+  0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x32,
+  0xf0, 0x05, 0x01, 0x11, 0x11, 0x11, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xa0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00,
+  0x10, 0x05, 0x05, 0x00, 0x70, 0x2e, 0x80, 0x00, 0x00, 0x00, 0x03, 0xe5, 0x0b,
+  0x00, 0x2f, 0x25, 0x00, 0x01, 0x00, 0x2a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x07, 0xc0, 0x11, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xd3,
+  0x00, 0x01, 0xa3, 0x00, 0x9e, 0x10, 0x00, 0xfb, 0x0c, 0x3f, 0x20, 0x00, 0x28,
+  0xce, 0xdf, 0x30, 0x03, 0xf7, 0x20, 0x1f, 0x30, 0x0a, 0xa0, 0x00, 0x1f, 0x30,
+  0x08, 0xe3, 0x15, 0xdf, 0x30, 0x00, 0x9f, 0xea, 0x1b, 0x30, 0x3a, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x76, 0x04, 0x70, 0x00,
+  0x00, 0x00, 0x08, 0xc0, 0x05, 0x00, 0xf4, 0x08, 0x01, 0x00, 0x00, 0x08, 0xc7,
+  0xff, 0xe5, 0x00, 0x08, 0xf8, 0x00, 0x8f, 0x20, 0x08, 0xc0, 0x00, 0x0e, 0x70,
+  0x08, 0xc0, 0x00, 0x0c, 0x90, 0x05, 0x00, 0xcb, 0x1f, 0x50, 0x08, 0xf8, 0x33,
+  0xcd, 0x00, 0x06, 0x77, 0xef, 0xa1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf4, 0x05, 0x02, 0x00, 0x00, 0x00,
+  0x1a, 0xff, 0xfa, 0x10, 0x00, 0xdc, 0x20, 0x19, 0x10, 0x07, 0xe0, 0x00, 0x00,
+  0x00, 0x0a, 0xb0, 0x05, 0x00, 0x20, 0x06, 0xf1, 0x22, 0x00, 0x8c, 0xdd, 0x41,
+  0x3b, 0x50, 0x00, 0x19, 0xef, 0xd7, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x01, 0x00, 0x64, 0x19, 0x10, 0x00, 0x00, 0x00, 0x3f, 0x05,
+  0x00, 0xf0, 0x05, 0x20, 0x3f, 0x10, 0x00, 0x6e, 0xfe, 0x8f, 0x10, 0x05, 0xf6,
+  0x01, 0xaf, 0x10, 0x0d, 0x90, 0x00, 0x3f, 0x10, 0x0f, 0x50, 0x05, 0x00, 0xfa,
+  0x05, 0x60, 0x00, 0x3f, 0x10, 0x0d, 0xa0, 0x00, 0x3f, 0x10, 0x05, 0xf7, 0x25,
+  0xdf, 0x10, 0x00, 0x7e, 0xfb, 0x2c, 0x10, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xfc, 0x1b, 0x11, 0x00, 0x00,
+  0x00, 0x3d, 0xff, 0xe4, 0x00, 0x03, 0xf7, 0x00, 0x6f, 0x20, 0x0a, 0xb0, 0x00,
+  0x0c, 0x70, 0x0e, 0xfb, 0xbb, 0xbf, 0x90, 0x0d, 0xc4, 0x44, 0x44, 0x20, 0x09,
+  0xc0, 0x00, 0x00, 0x00, 0x02, 0xea, 0x31, 0x39, 0x00, 0x00, 0x2a, 0xef, 0xd7,
+  0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xff,
+  0x11, 0x07, 0xbb, 0x81, 0x00, 0x00, 0x9e, 0x65, 0x80, 0x00, 0x00, 0xf5, 0x00,
+  0x00, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x05, 0xef, 0xff, 0xff, 0x60, 0x00, 0x13,
+  0xf4, 0x11, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x05, 0x00, 0x03, 0x3c, 0x01, 0xd2,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0xf0, 0x30, 0x10, 0x00, 0x00, 0x00, 0x5e, 0xdf, 0xff, 0xf0, 0x02, 0xf5,
+  0x01, 0xe6, 0x10, 0x05, 0xe0, 0x00, 0x99, 0x00, 0x03, 0xf2, 0x00, 0xc7, 0x00,
+  0x00, 0xae, 0x9c, 0xc1, 0x00, 0x02, 0xd3, 0x53, 0x00, 0x00, 0x04, 0xe4, 0x22,
+  0x10, 0x00, 0x00, 0xde, 0xef, 0xff, 0x80, 0x09, 0x80, 0x00, 0x06, 0xf0, 0x0c,
+  0x70, 0x00, 0x08, 0xd0, 0x04, 0xeb, 0x99, 0xdc, 0x20, 0x00, 0x04, 0x55, 0x20,
+  0x00, 0x15, 0x00, 0x01, 0x00, 0x76, 0x04, 0x70, 0x00, 0x00, 0x00, 0x08, 0xc0,
+  0x05, 0x00, 0xfb, 0x08, 0x01, 0x00, 0x00, 0x08, 0xc4, 0xef, 0xf7, 0x00, 0x08,
+  0xeb, 0x20, 0x7f, 0x20, 0x08, 0xd0, 0x00, 0x0f, 0x50, 0x08, 0xc0, 0x00, 0x0f,
+  0x60, 0x05, 0x00, 0x6a, 0x06, 0xa0, 0x00, 0x0c, 0x40, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xc2, 0x19, 0x30, 0x00,
+  0x00, 0x00, 0x6f, 0x90, 0x00, 0x00, 0x00, 0x05, 0x10, 0x12, 0x00, 0xdf, 0x08,
+  0xff, 0xff, 0x50, 0x00, 0x00, 0x11, 0x1f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x05,
+  0x00, 0x05, 0x3b, 0x0c, 0x40, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x00, 0xc2, 0x19, 0x30, 0x00, 0x00, 0x00, 0x6f, 0x90,
+  0x00, 0x00, 0x00, 0x05, 0x10, 0x12, 0x00, 0xdf, 0x08, 0xff, 0xff, 0x50, 0x00,
+  0x00, 0x11, 0x1f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x00, 0x0b, 0xf0, 0x02,
+  0x40, 0x00, 0x01, 0x00, 0x5f, 0x10, 0x00, 0x0e, 0xdd, 0xf7, 0x00, 0x00, 0x00,
+  0x34, 0x10, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x7c, 0x02, 0x90, 0x00, 0x00,
+  0x00, 0x04, 0xf0, 0x05, 0x00, 0xf0, 0x0b, 0x4e, 0x40, 0x04, 0xf0, 0x04, 0xe4,
+  0x00, 0x04, 0xf0, 0x4f, 0x40, 0x00, 0x04, 0xf5, 0xff, 0x10, 0x00, 0x04, 0xff,
+  0x4b, 0xb0, 0x00, 0x04, 0xf4, 0x01, 0xe7, 0x1e, 0x00, 0x8a, 0x4f, 0x30, 0x03,
+  0xd0, 0x00, 0x07, 0xb0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0x80, 0x06, 0x99, 0x92, 0x00, 0x00, 0x05, 0x78, 0xf4,
+  0x0c, 0x00, 0x0f, 0x05, 0x00, 0x15, 0x9a, 0xcb, 0x23, 0x20, 0x00, 0x00, 0x3c,
+  0xfd, 0x50, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x06, 0xff, 0x04, 0x01, 0x00, 0x01, 0x00, 0x1f, 0x7f, 0xe4, 0xef,
+  0x60, 0x1f, 0xa0, 0xdd, 0x19, 0xd0, 0x1f, 0x30, 0xb8, 0x06, 0xe0, 0x05, 0x00,
+  0x01, 0x5b, 0x1d, 0x30, 0x86, 0x05, 0xb0, 0x3b, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xfb, 0x08, 0x01, 0x00, 0x00, 0x07,
+  0x94, 0xef, 0xf7, 0x00, 0x08, 0xeb, 0x20, 0x7f, 0x20, 0x08, 0xd0, 0x00, 0x0f,
+  0x50, 0x08, 0xc0, 0x00, 0x0f, 0x60, 0x05, 0x00, 0x5b, 0x06, 0xa0, 0x00, 0x0c,
+  0x40, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0xf1, 0x08, 0x11, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xb2, 0x00, 0x05, 0xf5,
+  0x01, 0xad, 0x00, 0x0d, 0x90, 0x00, 0x0f, 0x60, 0x0f, 0x50, 0x00, 0x0c, 0x90,
+  0x05, 0x00, 0xec, 0x0c, 0xa0, 0x00, 0x1f, 0x50, 0x03, 0xf8, 0x23, 0xcc, 0x00,
+  0x00, 0x3c, 0xfe, 0x90, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x07, 0xf4, 0x08, 0x01, 0x00, 0x00, 0x07, 0xa7, 0xff, 0xe5,
+  0x00, 0x08, 0xf8, 0x00, 0x8f, 0x20, 0x08, 0xc0, 0x00, 0x0e, 0x70, 0x08, 0xc0,
+  0x00, 0x0c, 0x90, 0x05, 0x00, 0xf7, 0x01, 0x1f, 0x50, 0x08, 0xf8, 0x33, 0xcd,
+  0x00, 0x08, 0xc7, 0xef, 0xa1, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x05, 0x00, 0x50,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x05, 0x20,
+  0x00, 0x00, 0x00, 0x6e, 0xff, 0x6f, 0x10, 0x05, 0xf6, 0x01, 0xaf, 0x10, 0x0d,
+  0x90, 0x00, 0x3f, 0x10, 0x0f, 0x50, 0x05, 0x00, 0xf7, 0x08, 0x60, 0x00, 0x3f,
+  0x10, 0x0d, 0xa0, 0x00, 0x3f, 0x10, 0x05, 0xf7, 0x25, 0xdf, 0x10, 0x00, 0x7e,
+  0xfb, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x3f, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x08, 0xfe, 0x05, 0x11, 0x00, 0x00, 0xa6,
+  0x3c, 0xff, 0x70, 0x00, 0xaa, 0xe6, 0x11, 0x10, 0x00, 0xaf, 0x30, 0x00, 0x00,
+  0x00, 0xaa, 0x00, 0x05, 0x00, 0x1e, 0x88, 0x39, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x01, 0x11, 0x00, 0x00, 0x00,
+  0x7f, 0xef, 0xd6, 0x00, 0x04, 0xf3, 0x00, 0x46, 0x00, 0x04, 0xf4, 0x00, 0x0f,
+  0x00, 0xfc, 0x07, 0xea, 0x50, 0x00, 0x00, 0x00, 0x48, 0xed, 0x10, 0x00, 0x00,
+  0x00, 0x0f, 0x60, 0x09, 0xb4, 0x11, 0x6f, 0x30, 0x01, 0x7d, 0xff, 0xc4, 0x3a,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf8, 0x0d,
+  0x03, 0x40, 0x00, 0x00, 0x00, 0x08, 0x90, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00,
+  0x00, 0x0c, 0xef, 0xff, 0xff, 0x60, 0x01, 0x1b, 0xa1, 0x11, 0x00, 0x00, 0x0b,
+  0x90, 0x00, 0x05, 0x00, 0xeb, 0x0a, 0xb0, 0x00, 0x00, 0x00, 0x05, 0xf4, 0x12,
+  0x20, 0x00, 0x00, 0x8e, 0xfd, 0x60, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x7e, 0x0b, 0x80, 0x00, 0x3f, 0x10, 0x0c,
+  0x90, 0x05, 0x00, 0xfb, 0x00, 0x0b, 0xa0, 0x00, 0x6f, 0x10, 0x07, 0xf5, 0x27,
+  0xcf, 0x10, 0x00, 0x9e, 0xe8, 0x0c, 0x10, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfd, 0x17, 0x0e, 0x50, 0x00, 0x0a,
+  0x80, 0x09, 0xb0, 0x00, 0x1f, 0x20, 0x02, 0xf2, 0x00, 0x7c, 0x00, 0x00, 0xb8,
+  0x00, 0xd5, 0x00, 0x00, 0x4e, 0x04, 0xe0, 0x00, 0x00, 0x0d, 0x5a, 0x80, 0x00,
+  0x00, 0x07, 0xcf, 0x10, 0x00, 0x00, 0x01, 0xc9, 0x37, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfc, 0x18, 0xb8, 0x00, 0x64,
+  0x00, 0xd5, 0x8b, 0x00, 0xfb, 0x00, 0xf2, 0x5f, 0x04, 0xbf, 0x04, 0xe0, 0x1f,
+  0x28, 0x8e, 0x37, 0xb0, 0x0e, 0x5c, 0x4a, 0x6a, 0x80, 0x0a, 0x8f, 0x17, 0xad,
+  0x40, 0x07, 0xed, 0x03, 0xef, 0x10, 0x03, 0xd7, 0x00, 0xcb, 0x37, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfb, 0x19, 0x06,
+  0xe1, 0x00, 0x5e, 0x10, 0x00, 0xab, 0x01, 0xe4, 0x00, 0x00, 0x1e, 0x7b, 0x90,
+  0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x08, 0xde, 0x10, 0x00, 0x00, 0x4f,
+  0x19, 0xc0, 0x00, 0x01, 0xe5, 0x00, 0xd8, 0x00, 0x08, 0x90, 0x00, 0x2c, 0x30,
+  0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xf0, 0x17, 0x0e, 0x40, 0x00, 0x09, 0x90, 0x08, 0xc0, 0x00, 0x0f, 0x30, 0x01,
+  0xf3, 0x00, 0x6c, 0x00, 0x00, 0x9a, 0x00, 0xc6, 0x00, 0x00, 0x2f, 0x12, 0xf0,
+  0x00, 0x00, 0x0a, 0x88, 0x90, 0x00, 0x00, 0x03, 0xee, 0x20, 0x00, 0x00, 0x00,
+  0xbc, 0x2a, 0x00, 0xf0, 0x03, 0xd5, 0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00,
+  0x0c, 0xfc, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x0a, 0xfb, 0x19, 0x04, 0xff, 0xff, 0xff, 0x50, 0x00, 0x11, 0x12, 0xea,
+  0x00, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x00, 0xad, 0x10, 0x00, 0x00, 0x08,
+  0xe1, 0x00, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x05, 0xf8, 0x44, 0x44, 0x20,
+  0x0b, 0xdd, 0xdd, 0xdd, 0x60, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x01, 0x00, 0xb0, 0x04, 0x78, 0x00, 0x00, 0x00, 0x9b, 0x43, 0x00,
+  0x00, 0x00, 0xd4, 0x0f, 0x00, 0x24, 0xe3, 0x00, 0x0a, 0x00, 0xf4, 0x01, 0xc4,
+  0x00, 0x00, 0x00, 0x15, 0xf2, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00,
+  0x01, 0xe3, 0x14, 0x00, 0x0c, 0x28, 0x00, 0xd0, 0x6d, 0x98, 0x00, 0x00, 0x00,
+  0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10,
+  0x21, 0x05, 0x00, 0x1f, 0xc6, 0x05, 0x00, 0x35, 0x50, 0x00, 0x00, 0xa5, 0x00,
+  0x00, 0x15, 0x00, 0x01, 0x00, 0x80, 0x03, 0x86, 0x20, 0x00, 0x00, 0x01, 0x36,
+  0xe3, 0x0c, 0x00, 0x15, 0xa7, 0x05, 0x00, 0x10, 0xa6, 0x05, 0x00, 0x10, 0xb6,
+  0x05, 0x00, 0xb0, 0x7c, 0x30, 0x00, 0x00, 0x00, 0x1c, 0xe8, 0x00, 0x00, 0x00,
+  0x99, 0x0f, 0x00, 0x15, 0xb5, 0x1e, 0x00, 0x13, 0x97, 0x23, 0x00, 0xf0, 0x00,
+  0x03, 0x8a, 0xd1, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x10, 0xdf, 0x59, 0x30, 0x05, 0x10, 0x05,
+  0xc7, 0xd9, 0x6d, 0x10, 0x06, 0x20, 0x08, 0xa2, 0x31, 0x00, 0x11, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0xff, 0x08, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0xac, 0x30, 0x00, 0x00, 0x2a, 0x01, 0xb0, 0x00, 0x00, 0x1c, 0x02,
+  0xb0, 0x00, 0x00, 0x06, 0xbb, 0x20, 0x00, 0x01, 0x00, 0x1f, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02, 0x10, 0x10, 0x05, 0x00, 0x18,
+  0xb5, 0x05, 0x00, 0x58, 0x09, 0xff, 0xff, 0xff, 0x30, 0x14, 0x00, 0xdb, 0x94,
+  0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x00, 0x08, 0xdd, 0xdd, 0xdd, 0x30, 0x3f,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x10, 0xdf,
+  0x01, 0x96, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x03, 0xeb, 0x00,
+  0x01, 0x00, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfb, 0x28,
+  0x06, 0xba, 0xa7, 0x20, 0x00, 0x09, 0xd6, 0x7b, 0xf5, 0x00, 0x09, 0xb0, 0x00,
+  0x7f, 0x20, 0x09, 0xb0, 0x00, 0x0e, 0x80, 0x1a, 0xc3, 0x30, 0x0a, 0xb0, 0xae,
+  0xfc, 0xc0, 0x09, 0xd0, 0x09, 0xb0, 0x00, 0x0a, 0xc0, 0x09, 0xb0, 0x00, 0x0d,
+  0x80, 0x09, 0xb0, 0x00, 0x6f, 0x30, 0x09, 0xc4, 0x59, 0xf7, 0x00, 0x07, 0xdd,
+  0xc9, 0x30, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x05, 0xff, 0x14, 0x01, 0x60, 0x00, 0x16, 0x00, 0x01, 0xd8, 0x01,
+  0xd7, 0x00, 0x00, 0x1d, 0x8d, 0x80, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x00,
+  0x0c, 0x9d, 0x70, 0x00, 0x00, 0xc9, 0x01, 0xd6, 0x00, 0x01, 0x80, 0x00, 0x27,
+  0x00, 0x01, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xfa, 0x28, 0x19, 0xdc, 0x66, 0xb0, 0x01, 0xec, 0x57, 0xff, 0x30, 0x0a,
+  0xd0, 0x00, 0xff, 0x30, 0x0f, 0x60, 0x07, 0xcd, 0x90, 0x2f, 0x30, 0x2f, 0x29,
+  0xb0, 0x3f, 0x20, 0xc7, 0x09, 0xc0, 0x2f, 0x38, 0xc0, 0x09, 0xb0, 0x0f, 0x9e,
+  0x20, 0x0c, 0x90, 0x0b, 0xf6, 0x00, 0x3f, 0x40, 0x0b, 0xfa, 0x35, 0xea, 0x00,
+  0x2e, 0x4b, 0xfe, 0x80, 0x00, 0x01, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x01, 0x00, 0x70, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x06, 0xf0,
+  0x05, 0x00, 0xf0, 0x03, 0xfe, 0xee, 0xb4, 0x00, 0x06, 0xf2, 0x23, 0x8f, 0x40,
+  0x06, 0xf0, 0x00, 0x0b, 0xa0, 0x06, 0xf0, 0x00, 0x0a, 0x05, 0x00, 0xb2, 0x2e,
+  0x70, 0x06, 0xfb, 0xbc, 0xfa, 0x00, 0x06, 0xf6, 0x65, 0x20, 0x28, 0x00, 0x3d,
+  0x05, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xfa, 0x2d, 0x29, 0xca, 0x20, 0x00, 0x01, 0xeb, 0x5a, 0xe0, 0x00,
+  0x07, 0xe0, 0x01, 0xf3, 0x00, 0x09, 0xb0, 0x04, 0xf0, 0x00, 0x09, 0xb0, 0x0d,
+  0x60, 0x00, 0x09, 0xb0, 0x5e, 0x00, 0x00, 0x09, 0xb0, 0x5f, 0x30, 0x00, 0x09,
+  0xb0, 0x09, 0xf9, 0x00, 0x09, 0xb0, 0x00, 0x3d, 0xa0, 0x09, 0xb0, 0x00, 0x04,
+  0xf0, 0x09, 0xb0, 0x53, 0x19, 0xd0, 0x07, 0x90, 0x6d, 0xfc, 0x20, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06, 0xfb,
+  0x1d, 0x11, 0x00, 0x01, 0x00, 0x2c, 0xff, 0x56, 0xef, 0x90, 0x15, 0x03, 0xfd,
+  0x11, 0xe3, 0x00, 0x00, 0xd7, 0x00, 0x96, 0x03, 0x9d, 0xff, 0xbb, 0xe8, 0x4e,
+  0x50, 0xba, 0x44, 0x42, 0xa8, 0x00, 0xa9, 0x00, 0x00, 0x9c, 0x15, 0xff, 0x41,
+  0x50, 0x2c, 0xfb, 0x15, 0xdf, 0xb1, 0x3b, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0x80, 0x1a, 0x20, 0x17, 0x00, 0x00, 0x07, 0xff,
+  0xe8, 0x05, 0x00, 0xfb, 0x20, 0xa0, 0x00, 0x00, 0x59, 0x11, 0xe6, 0x00, 0x00,
+  0x02, 0x42, 0x5e, 0x00, 0x00, 0xbe, 0xbc, 0xaf, 0x40, 0x09, 0xc0, 0x00, 0x4f,
+  0x70, 0x0f, 0x40, 0x00, 0x0b, 0x80, 0x0f, 0x30, 0x00, 0x0c, 0x70, 0x0d, 0x70,
+  0x00, 0x1f, 0x40, 0x04, 0xf7, 0x23, 0xcb, 0x00, 0x00, 0x4c, 0xfe, 0x90, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02,
+  0x10, 0x10, 0x05, 0x00, 0x10, 0xf8, 0x05, 0x00, 0x13, 0x52, 0x12, 0x00, 0x53,
+  0x09, 0xff, 0xff, 0xff, 0x30, 0x0c, 0x00, 0x15, 0x41, 0x1e, 0x00, 0x1f, 0x20,
+  0x3f, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0xfa, 0x1d, 0x11, 0x02, 0x00, 0x00, 0x5e, 0xff, 0xcf, 0x50, 0x05, 0xf5,
+  0x01, 0xff, 0x00, 0x0d, 0x90, 0x0a, 0xbf, 0x60, 0x0f, 0x50, 0x8c, 0x0c, 0x90,
+  0x0f, 0x55, 0xd1, 0x0c, 0x90, 0x0c, 0xee, 0x20, 0x1f, 0x50, 0x06, 0xfc, 0x13,
+  0xcc, 0x00, 0x0c, 0xac, 0xfe, 0x90, 0x00, 0x01, 0x3a, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x76, 0x04, 0x70, 0x00, 0x00, 0x00,
+  0x08, 0xc0, 0x05, 0x00, 0xf4, 0x08, 0x01, 0x00, 0x00, 0x08, 0xc7, 0xff, 0xe5,
+  0x00, 0x08, 0xf8, 0x00, 0x8f, 0x20, 0x08, 0xc0, 0x00, 0x0e, 0x70, 0x08, 0xc0,
+  0x00, 0x0c, 0x90, 0x05, 0x00, 0xb9, 0x1f, 0x50, 0x08, 0xf8, 0x33, 0xcd, 0x00,
+  0x08, 0xc7, 0xef, 0xa1, 0x37, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xb0, 0x05, 0xcd, 0x50, 0x00, 0x00, 0x2f,
+  0x73, 0x20, 0x00, 0x00, 0x8c, 0x0f, 0x00, 0xf4, 0x1e, 0xb8, 0x00, 0x00, 0x00,
+  0x6b, 0xff, 0xb8, 0x00, 0x00, 0x24, 0xf9, 0x43, 0x00, 0x00, 0x00, 0xf3, 0x00,
+  0x00, 0x00, 0x02, 0xf1, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x07,
+  0xc0, 0x00, 0x00, 0x00, 0x0c, 0x90, 0x00, 0x00, 0x1c, 0xde, 0x20, 0x00, 0x00,
+  0x04, 0x41, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01,
+  0x00, 0x10, 0x05, 0x05, 0x00, 0x70, 0x2e, 0x80, 0x00, 0x00, 0x00, 0x03, 0xe5,
+  0x0b, 0x00, 0x2f, 0x25, 0x00, 0x01, 0x00, 0x2a, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x01, 0x00, 0xb0, 0x02, 0x30, 0x00, 0x00, 0x00, 0x0d, 0xa0,
+  0x00, 0x00, 0x00, 0xba, 0x0f, 0x00, 0x2f, 0x70, 0x00, 0x01, 0x00, 0x2a, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xef, 0x04, 0xfd, 0x00,
+  0x00, 0x00, 0x2e, 0x38, 0xb0, 0x00, 0x00, 0x52, 0x00, 0x61, 0x00, 0x01, 0x00,
+  0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xef, 0x3a,
+  0x60, 0x34, 0x00, 0x00, 0xc6, 0xb9, 0xc5, 0x00, 0x00, 0x60, 0x07, 0x60, 0x00,
+  0x01, 0x00, 0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0x9f, 0x3b, 0xbb, 0xa0, 0x00, 0x00, 0x03, 0x33, 0x20, 0x00, 0x01, 0x00, 0x29,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x83, 0x14, 0x01,
+  0x50, 0x00, 0x00, 0x8f, 0x06, 0xf2, 0x0a, 0x00, 0x0f, 0x01, 0x00, 0x28, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xff, 0x02, 0x53, 0x00,
+  0x00, 0x00, 0x0b, 0x5a, 0x50, 0x00, 0x00, 0x0d, 0x06, 0x70, 0x00, 0x00, 0x03,
+  0x98, 0x00, 0x01, 0x00, 0x2a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x01, 0x00, 0xff, 0x03, 0x20, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x7a, 0x00, 0x00,
+  0x06, 0x90, 0xd1, 0x00, 0x00, 0x07, 0x12, 0x50, 0x00, 0x01, 0x00, 0x29, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x2f, 0x10, 0x31, 0x05,
+  0x00, 0x10, 0xd1, 0x05, 0x00, 0xd0, 0x6d, 0x00, 0x00, 0x00, 0x02, 0x7c, 0x00,
+  0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xfb, 0x26, 0xa7,
+  0x00, 0x00, 0x00, 0x05, 0xde, 0x00, 0x00, 0x00, 0x0b, 0x6e, 0x40, 0x00, 0x00,
+  0x0f, 0x29, 0x90, 0x00, 0x00, 0x5d, 0x04, 0xe0, 0x00, 0x00, 0xb8, 0x00, 0xf4,
+  0x00, 0x00, 0xfb, 0x77, 0xfb, 0x00, 0x05, 0xf9, 0x99, 0xff, 0x00, 0x0b, 0x90,
+  0x00, 0x0f, 0x40, 0x1f, 0x40, 0x00, 0x0b, 0xa0, 0x4c, 0x00, 0x00, 0x05, 0xc0,
+  0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0,
+  0x00, 0x04, 0xbb, 0xa9, 0x50, 0x00, 0x06, 0xf7, 0x79, 0xeb, 0x00, 0x06, 0xe0,
+  0x00, 0x4f, 0x10, 0x05, 0x00, 0xa0, 0x00, 0x06, 0xe4, 0x46, 0xd7, 0x00, 0x06,
+  0xfd, 0xde, 0xc5, 0x14, 0x00, 0xfb, 0x07, 0x3e, 0x60, 0x06, 0xe0, 0x00, 0x09,
+  0xb0, 0x06, 0xe0, 0x00, 0x0c, 0xa0, 0x06, 0xe5, 0x56, 0xbf, 0x30, 0x05, 0xdd,
+  0xcc, 0x92, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0xb0, 0x9b, 0xbb, 0xbb, 0x60, 0x00, 0xdb, 0x77, 0x77, 0x30, 0x00,
+  0xd7, 0x0f, 0x00, 0x0f, 0x05, 0x00, 0x10, 0x2d, 0xa6, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xfb, 0x26, 0xa7, 0x00,
+  0x00, 0x00, 0x06, 0xef, 0x00, 0x00, 0x00, 0x0b, 0x7e, 0x50, 0x00, 0x00, 0x1f,
+  0x29, 0xa0, 0x00, 0x00, 0x6d, 0x04, 0xf0, 0x00, 0x00, 0xc8, 0x00, 0xe5, 0x00,
+  0x01, 0xf2, 0x00, 0x9b, 0x00, 0x07, 0xd0, 0x00, 0x4f, 0x10, 0x0c, 0x80, 0x00,
+  0x0e, 0x60, 0x2f, 0x75, 0x55, 0x5c, 0xb0, 0x4d, 0xdd, 0xdd, 0xdd, 0xb0, 0x44,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf2, 0x00,
+  0x01, 0xbb, 0xbb, 0xbb, 0x30, 0x02, 0xf8, 0x77, 0x77, 0x20, 0x02, 0xf2, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x83, 0xf6, 0x44, 0x42, 0x00, 0x02, 0xfe, 0xdd, 0xd7,
+  0x0f, 0x00, 0x06, 0x05, 0x00, 0x9b, 0xf7, 0x55, 0x55, 0x20, 0x02, 0xdd, 0xdd,
+  0xdd, 0x60, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xf0, 0x11, 0x05, 0xbb, 0xbb, 0xbb, 0x60, 0x03, 0x66, 0x66, 0x9f, 0x40,
+  0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x00, 0x3f,
+  0x30, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x00, 0x60, 0x4f,
+  0x20, 0x00, 0x00, 0x00, 0xd7, 0x0e, 0x00, 0x9b, 0xe5, 0x55, 0x55, 0x30, 0x0c,
+  0xdd, 0xdd, 0xdd, 0x80, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xa7, 0x08, 0x60, 0x00, 0x0b, 0x30, 0x0b, 0x90, 0x00, 0x0f,
+  0x50, 0x05, 0x00, 0x88, 0xb4, 0x44, 0x4f, 0x50, 0x0b, 0xfd, 0xdd, 0xdf, 0x14,
+  0x00, 0x05, 0x05, 0x00, 0x5b, 0x09, 0x70, 0x00, 0x0d, 0x40, 0x46, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf1, 0x13, 0x19, 0xdc,
+  0x60, 0x00, 0x01, 0xec, 0x57, 0xe9, 0x00, 0x0a, 0xd0, 0x00, 0x4f, 0x30, 0x0f,
+  0x60, 0x00, 0x0d, 0x90, 0x2f, 0x33, 0x44, 0x1a, 0xb0, 0x3f, 0x2a, 0xdd, 0x59,
+  0xc0, 0x2f, 0x30, 0x00, 0x09, 0xb0, 0x14, 0x00, 0xec, 0x0a, 0xc0, 0x00, 0x3f,
+  0x40, 0x02, 0xea, 0x35, 0xea, 0x00, 0x00, 0x2b, 0xfe, 0x80, 0x45, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xef, 0x05, 0xbb, 0xbb,
+  0xbb, 0x00, 0x03, 0x77, 0xeb, 0x77, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x05, 0x00,
+  0x0c, 0xab, 0x02, 0x55, 0xea, 0x55, 0x00, 0x06, 0xdd, 0xdd, 0xdd, 0x10, 0x46,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x1d,
+  0x04, 0x90, 0x00, 0x09, 0x60, 0x07, 0xe0, 0x00, 0x9d, 0x00, 0x07, 0xe0, 0x07,
+  0xe2, 0x00, 0x07, 0xe0, 0x4f, 0x30, 0x00, 0x07, 0xe3, 0xff, 0x00, 0x00, 0x07,
+  0xfe, 0xbf, 0x40, 0x00, 0x07, 0xfb, 0x09, 0xd0, 0x00, 0x07, 0xf0, 0x01, 0xf6,
+  0x00, 0x07, 0xe0, 0x00, 0x8e, 0x05, 0x00, 0x7b, 0x0e, 0x80, 0x05, 0xb0, 0x00,
+  0x05, 0xc1, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xfb, 0x27, 0x01, 0xa7, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x00, 0x00, 0x00,
+  0x0a, 0x7e, 0x40, 0x00, 0x00, 0x0f, 0x3a, 0x90, 0x00, 0x00, 0x5e, 0x05, 0xe0,
+  0x00, 0x00, 0xa9, 0x01, 0xf3, 0x00, 0x00, 0xe5, 0x00, 0xc8, 0x00, 0x04, 0xf0,
+  0x00, 0x7d, 0x00, 0x09, 0xb0, 0x00, 0x3f, 0x20, 0x0e, 0x60, 0x00, 0x0e, 0x70,
+  0x2d, 0x20, 0x00, 0x08, 0xa0, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0xf0, 0x17, 0x09, 0x90, 0x00, 0x3b, 0x40, 0x0d, 0xf2,
+  0x00, 0x9f, 0x70, 0x0d, 0xd7, 0x00, 0xed, 0x70, 0x0d, 0x9d, 0x03, 0xdb, 0x70,
+  0x0d, 0x6f, 0x29, 0x8c, 0x70, 0x0d, 0x69, 0x7e, 0x2d, 0x70, 0x0d, 0x64, 0xec,
+  0x0d, 0x70, 0x0d, 0x60, 0xe7, 0x05, 0x00, 0x13, 0x00, 0x05, 0x00, 0x5b, 0x0a,
+  0x50, 0x00, 0x0a, 0x50, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0xc0, 0x07, 0xa0, 0x00, 0x0a, 0x30, 0x0b, 0xf6, 0x00, 0x0f,
+  0x40, 0x0b, 0xcd, 0x05, 0x00, 0xc0, 0x8d, 0x60, 0x0f, 0x40, 0x0b, 0x86, 0xe0,
+  0x0f, 0x40, 0x0b, 0x90, 0xd6, 0x05, 0x00, 0x10, 0x6e, 0x05, 0x00, 0xfb, 0x03,
+  0x0d, 0x6e, 0x40, 0x0b, 0x90, 0x05, 0xdd, 0x40, 0x0b, 0x90, 0x00, 0xdf, 0x40,
+  0x08, 0x70, 0x00, 0x5d, 0x30, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0xa7, 0x07, 0xbb, 0xbb, 0xbb, 0x30, 0x05, 0x77, 0x77,
+  0x77, 0x20, 0x15, 0x00, 0x9b, 0x24, 0x44, 0x41, 0x00, 0x00, 0x9d, 0xdd, 0xd3,
+  0x00, 0x01, 0x00, 0xab, 0x04, 0x55, 0x55, 0x55, 0x20, 0x0b, 0xdd, 0xdd, 0xdd,
+  0x60, 0x19, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0xf1, 0x0e, 0x19, 0xdc, 0x60, 0x00, 0x01, 0xec, 0x57, 0xe9, 0x00, 0x0a, 0xd0,
+  0x00, 0x4f, 0x30, 0x0f, 0x60, 0x00, 0x0d, 0x90, 0x2f, 0x30, 0x00, 0x09, 0xb0,
+  0x3f, 0x20, 0x00, 0x09, 0xc0, 0x0a, 0x00, 0xfc, 0x04, 0x0f, 0x60, 0x00, 0x0c,
+  0x90, 0x0a, 0xc0, 0x00, 0x3f, 0x40, 0x02, 0xfa, 0x35, 0xea, 0x00, 0x00, 0x2b,
+  0xfe, 0x80, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xef, 0x08, 0xbb, 0xbb, 0xbb, 0x30, 0x0b, 0xc7, 0x77, 0x7f, 0x50, 0x0b,
+  0x90, 0x00, 0x0f, 0x05, 0x00, 0x11, 0x5b, 0x09, 0x70, 0x00, 0x0d, 0x40, 0x46,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf7, 0x18,
+  0x04, 0xbb, 0xaa, 0x71, 0x00, 0x06, 0xf6, 0x67, 0xce, 0x20, 0x06, 0xf0, 0x00,
+  0x0d, 0x80, 0x06, 0xf0, 0x00, 0x0b, 0xa0, 0x06, 0xf0, 0x00, 0x0e, 0x70, 0x06,
+  0xf7, 0x78, 0xdd, 0x10, 0x06, 0xfa, 0xa9, 0x50, 0x00, 0x06, 0xf0, 0x00, 0x00,
+  0x05, 0x00, 0x3d, 0x04, 0xc0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x01, 0x00, 0xc0, 0x08, 0xbb, 0xbb, 0xbb, 0x00, 0x06, 0xf8,
+  0x77, 0x77, 0x00, 0x00, 0x9c, 0x10, 0x00, 0x70, 0x0c, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0xe6, 0x0b, 0x00, 0x10, 0x6e, 0x0a, 0x00, 0x14, 0xe5, 0x14, 0x00, 0x00,
+  0x1e, 0x00, 0xab, 0x06, 0xf7, 0x55, 0x55, 0x20, 0x0a, 0xdd, 0xdd, 0xdd, 0x60,
+  0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xd0,
+  0x3b, 0xbb, 0xbb, 0xbb, 0xa0, 0x27, 0x77, 0xeb, 0x77, 0x60, 0x00, 0x00, 0xe7,
+  0x11, 0x00, 0x0f, 0x05, 0x00, 0x10, 0x2c, 0xb6, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x12, 0x2b, 0x20, 0x00,
+  0x06, 0x80, 0x0c, 0x90, 0x00, 0x0e, 0x50, 0x04, 0xf2, 0x00, 0x7d, 0x00, 0x00,
+  0xb9, 0x00, 0xe5, 0x00, 0x00, 0x3f, 0x27, 0xc0, 0x00, 0x00, 0x0b, 0xae, 0x40,
+  0x00, 0x00, 0x02, 0xfc, 0x25, 0x00, 0x1a, 0xe7, 0x05, 0x00, 0x2c, 0xb6, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xf1,
+  0x0d, 0xd6, 0x00, 0x00, 0x00, 0x28, 0xff, 0x60, 0x00, 0x07, 0xf9, 0xfd, 0xbe,
+  0x20, 0x2f, 0x40, 0xd6, 0x0a, 0xb0, 0x7d, 0x00, 0xd6, 0x03, 0xf1, 0x8b, 0x00,
+  0xd6, 0x01, 0xf2, 0x0a, 0x00, 0xe3, 0x2f, 0x30, 0xd6, 0x0a, 0xc0, 0x08, 0xe7,
+  0xfb, 0xae, 0x20, 0x00, 0x4a, 0xff, 0x81, 0x32, 0x00, 0x28, 0x00, 0x21, 0x44,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x25,
+  0x07, 0x80, 0x00, 0x0a, 0x30, 0x03, 0xf3, 0x00, 0x8d, 0x00, 0x00, 0xab, 0x01,
+  0xf4, 0x00, 0x00, 0x1f, 0x49, 0xb0, 0x00, 0x00, 0x08, 0xdf, 0x20, 0x00, 0x00,
+  0x02, 0xfb, 0x00, 0x00, 0x00, 0x0a, 0xbf, 0x30, 0x00, 0x00, 0x3f, 0x19, 0xc0,
+  0x00, 0x00, 0xc8, 0x01, 0xf6, 0x00, 0x06, 0xe1, 0x00, 0x7e, 0x00, 0x0b, 0x60,
+  0x03, 0x00, 0x0a, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0xa4, 0x3a, 0x00, 0x95, 0x04, 0x90, 0x4f, 0x00, 0xe7, 0x06, 0xe0,
+  0x05, 0x00, 0xf9, 0x06, 0x07, 0xd0, 0x1f, 0x40, 0xe7, 0x0a, 0xb0, 0x0a, 0xd5,
+  0xfa, 0x8f, 0x40, 0x00, 0x7c, 0xff, 0xb3, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x05,
+  0x00, 0x2c, 0xb6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0x01, 0x00, 0xfb, 0x27, 0x29, 0xdc, 0x70, 0x00, 0x02, 0xeb, 0x56, 0xea,
+  0x00, 0x0a, 0xc0, 0x00, 0x3f, 0x40, 0x0f, 0x60, 0x00, 0x0c, 0x90, 0x2f, 0x30,
+  0x00, 0x09, 0xc0, 0x3f, 0x20, 0x00, 0x09, 0xc0, 0x1f, 0x30, 0x00, 0x0a, 0xb0,
+  0x0c, 0x80, 0x00, 0x0e, 0x60, 0x04, 0xe0, 0x00, 0x6d, 0x00, 0x14, 0xca, 0x02,
+  0xf7, 0x40, 0x5d, 0xdc, 0x04, 0xdd, 0xc0, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xfb, 0x1c, 0x10, 0x00, 0x00, 0x00,
+  0x7f, 0xfe, 0x3b, 0x80, 0x06, 0xf5, 0x03, 0xce, 0x50, 0x0d, 0x90, 0x00, 0x8f,
+  0x20, 0x0f, 0x50, 0x00, 0x5f, 0x00, 0x0f, 0x50, 0x00, 0x7d, 0x00, 0x0e, 0x80,
+  0x00, 0xbb, 0x00, 0x07, 0xf5, 0x29, 0xdd, 0x20, 0x00, 0x8e, 0xe8, 0x1d, 0xf1,
+  0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf2,
+  0x30, 0x18, 0xba, 0x40, 0x00, 0x00, 0xdc, 0x58, 0xf5, 0x00, 0x05, 0xf1, 0x00,
+  0xab, 0x00, 0x07, 0xd0, 0x00, 0xab, 0x00, 0x08, 0xc0, 0x01, 0xe4, 0x00, 0x08,
+  0xb0, 0x7e, 0x70, 0x00, 0x08, 0xb0, 0x68, 0xda, 0x00, 0x08, 0xb0, 0x00, 0x0e,
+  0x70, 0x08, 0xb0, 0x00, 0x0a, 0xa0, 0x08, 0xc0, 0x00, 0x0c, 0x90, 0x08, 0xfa,
+  0x32, 0x9f, 0x30, 0x08, 0xb6, 0xdf, 0xd5, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x05,
+  0x00, 0xa0, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0a, 0xf0, 0x17, 0x0e, 0x80, 0x00, 0x0c, 0x70, 0x05, 0xf2,
+  0x00, 0x0f, 0x40, 0x00, 0xc9, 0x00, 0x4e, 0x00, 0x00, 0x4f, 0x10, 0xb9, 0x00,
+  0x00, 0x0d, 0x62, 0xf1, 0x00, 0x00, 0x08, 0xaa, 0x90, 0x00, 0x00, 0x03, 0xfe,
+  0x10, 0x00, 0x00, 0x00, 0xf6, 0x2a, 0x00, 0x10, 0xe5, 0x05, 0x00, 0x10, 0xe6,
+  0x05, 0x00, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xb0, 0x3a, 0xca, 0x84, 0x00, 0x00, 0xf9, 0x45, 0x8c, 0x30, 0x00,
+  0xf5, 0x0f, 0x00, 0xfb, 0x1d, 0x6f, 0x60, 0x00, 0x00, 0x00, 0x05, 0xfb, 0x10,
+  0x00, 0x00, 0x5e, 0xbb, 0xe4, 0x00, 0x04, 0xf3, 0x00, 0x9f, 0x10, 0x0c, 0x80,
+  0x00, 0x0e, 0x70, 0x0e, 0x50, 0x00, 0x0c, 0x80, 0x0c, 0x90, 0x00, 0x0e, 0x50,
+  0x04, 0xf8, 0x23, 0xbd, 0x00, 0x00, 0x4c, 0xfe, 0xa1, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x00, 0x12,
+  0x00, 0x00, 0x00, 0x6e, 0xfe, 0xf8, 0x00, 0x01, 0xf7, 0x00, 0x18, 0x00, 0x00,
+  0xf5, 0x13, 0x00, 0xfc, 0x08, 0x4f, 0xdb, 0x40, 0x00, 0x02, 0xe9, 0x54, 0x10,
+  0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x05, 0xf6, 0x21, 0x3a, 0x40, 0x00, 0x6c,
+  0xff, 0xd8, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xf0, 0x10, 0x69, 0x99, 0x99, 0x30, 0x00, 0x47, 0x66, 0xbe, 0x30, 0x00,
+  0x00, 0x09, 0xc1, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x00,
+  0x00, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x00, 0xb9, 0x23, 0x00, 0x60, 0xf4, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x0a, 0x00, 0x10, 0xf8, 0x05, 0x00, 0x80, 0x7f, 0x93,
+  0x00, 0x00, 0x00, 0x05, 0xcf, 0xf9, 0x0c, 0x00, 0xf0, 0x02, 0x4f, 0x50, 0x00,
+  0x00, 0x00, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xfb, 0x08, 0x01, 0x00, 0x00, 0x07, 0xb3,
+  0xdf, 0xf7, 0x00, 0x06, 0xec, 0x30, 0x7f, 0x00, 0x06, 0xf1, 0x00, 0x1f, 0x20,
+  0x06, 0xe0, 0x00, 0x0f, 0x30, 0x05, 0x00, 0x77, 0x05, 0xb0, 0x00, 0x1f, 0x30,
+  0x00, 0x00, 0x05, 0x00, 0x70, 0x1a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0x01, 0x00, 0xfb, 0x2c, 0x07, 0xba, 0x30, 0x00, 0x00, 0xad, 0x58, 0xf4,
+  0x00, 0x03, 0xf1, 0x00, 0x8d, 0x00, 0x08, 0xb0, 0x00, 0x2f, 0x20, 0x0b, 0x80,
+  0x00, 0x0f, 0x50, 0x0d, 0xe7, 0x77, 0x7f, 0x60, 0x0e, 0xf8, 0x88, 0x8f, 0x60,
+  0x0c, 0x80, 0x00, 0x0e, 0x50, 0x09, 0xa0, 0x00, 0x1f, 0x30, 0x05, 0xe0, 0x00,
+  0x6e, 0x00, 0x00, 0xda, 0x24, 0xe7, 0x00, 0x00, 0x1b, 0xfe, 0x70, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x80,
+  0x0a, 0xff, 0xf4, 0x00, 0x00, 0x01, 0x12, 0xf3, 0x0c, 0x00, 0x0f, 0x05, 0x00,
+  0x01, 0x8b, 0xda, 0x23, 0x00, 0x00, 0x00, 0x4d, 0xfd, 0x30, 0x37, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfb, 0x19, 0x05,
+  0xe0, 0x00, 0x3c, 0x90, 0x04, 0xf0, 0x08, 0xf9, 0x20, 0x03, 0xf1, 0x8f, 0x20,
+  0x00, 0x03, 0xf5, 0xff, 0x00, 0x00, 0x03, 0xfd, 0x2d, 0x90, 0x00, 0x03, 0xf6,
+  0x03, 0xf5, 0x00, 0x03, 0xf1, 0x00, 0x7f, 0x20, 0x03, 0xc0, 0x00, 0x09, 0xb0,
+  0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xd0,
+  0x09, 0xc9, 0x00, 0x00, 0x00, 0x05, 0x6d, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xf4,
+  0x11, 0x00, 0x10, 0xaa, 0x05, 0x00, 0xfa, 0x18, 0xcf, 0x10, 0x00, 0x00, 0x04,
+  0xfd, 0x70, 0x00, 0x00, 0x0b, 0x97, 0xd0, 0x00, 0x00, 0x2f, 0x22, 0xf3, 0x00,
+  0x00, 0x9b, 0x00, 0xc9, 0x00, 0x01, 0xf5, 0x00, 0x6e, 0x00, 0x08, 0xe0, 0x00,
+  0x1f, 0x50, 0x0c, 0x70, 0x00, 0x09, 0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x4a, 0x0a, 0xa0, 0x00, 0x5f,
+  0x05, 0x00, 0x13, 0x5e, 0x05, 0x00, 0xf0, 0x01, 0xc0, 0x00, 0x8e, 0x00, 0x0a,
+  0xf6, 0x28, 0xcf, 0x10, 0x0a, 0xbc, 0xe9, 0x1d, 0xb0, 0x0a, 0x90, 0x2d, 0x00,
+  0x00, 0x05, 0x00, 0xa0, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfd, 0x17, 0x0e, 0x70, 0x00, 0x0c, 0x80,
+  0x06, 0xf1, 0x00, 0x0f, 0x50, 0x00, 0xd9, 0x00, 0x4f, 0x00, 0x00, 0x5f, 0x00,
+  0xa9, 0x00, 0x00, 0x0e, 0x61, 0xf2, 0x00, 0x00, 0x08, 0xa8, 0xb0, 0x00, 0x00,
+  0x04, 0xfe, 0x20, 0x00, 0x00, 0x00, 0xc8, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xf0, 0x02, 0x04, 0x99, 0x99, 0x99, 0x30,
+  0x04, 0x6c, 0xf9, 0x77, 0x20, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x6e, 0x15,
+  0x00, 0xf0, 0x0b, 0x2f, 0x60, 0x00, 0x00, 0x00, 0x03, 0xed, 0xa3, 0x00, 0x00,
+  0x1d, 0xb6, 0x52, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00,
+  0x00, 0x01, 0xf5, 0x1e, 0x00, 0xf0, 0x0e, 0xaf, 0x83, 0x00, 0x00, 0x00, 0x06,
+  0xbf, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x4e, 0x50, 0x00, 0x00, 0x00, 0x0e, 0x30,
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x07, 0xfc, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xb1, 0x00, 0x04,
+  0xf6, 0x01, 0xbd, 0x00, 0x0b, 0xa0, 0x00, 0x1f, 0x50, 0x0e, 0x60, 0x00, 0x0d,
+  0x80, 0x0e, 0x70, 0x00, 0x0d, 0x80, 0x0b, 0xb0, 0x00, 0x2f, 0x40, 0x03, 0xf8,
+  0x23, 0xcc, 0x00, 0x00, 0x3c, 0xfe, 0x90, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf0, 0x04, 0x8f, 0xff, 0xff, 0xff,
+  0xf2, 0x12, 0xf5, 0x22, 0xab, 0x20, 0x00, 0xf4, 0x00, 0x9a, 0x00, 0x00, 0xf3,
+  0x00, 0x99, 0x05, 0x00, 0xfb, 0x02, 0xa9, 0x00, 0x01, 0xf2, 0x00, 0xa9, 0x00,
+  0x02, 0xf1, 0x00, 0x9b, 0x10, 0x03, 0xd0, 0x00, 0x3e, 0xc0, 0x37, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf3, 0x09, 0x11,
+  0x00, 0x00, 0x00, 0x2c, 0xff, 0xe4, 0x00, 0x00, 0xea, 0x00, 0x8f, 0x10, 0x05,
+  0xf0, 0x00, 0x0e, 0x70, 0x07, 0xc0, 0x00, 0x0c, 0x90, 0x08, 0x05, 0x00, 0xf2,
+  0x01, 0x1f, 0x50, 0x08, 0xf8, 0x33, 0xcd, 0x00, 0x08, 0xc8, 0xdf, 0xa1, 0x00,
+  0x08, 0xc0, 0x00, 0x00, 0x05, 0x00, 0xa0, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfc, 0x17, 0x4c, 0xff,
+  0xff, 0xf2, 0x04, 0xf7, 0x25, 0xd4, 0x10, 0x0c, 0x90, 0x00, 0x6d, 0x00, 0x0f,
+  0x50, 0x00, 0x2f, 0x20, 0x0f, 0x50, 0x00, 0x1f, 0x20, 0x0c, 0xa0, 0x00, 0x5f,
+  0x00, 0x04, 0xf7, 0x24, 0xe8, 0x00, 0x00, 0x5c, 0xfe, 0x70, 0x36, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xee, 0x0d, 0xff,
+  0xff, 0xff, 0x80, 0x01, 0x11, 0xd7, 0x11, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x05,
+  0x00, 0x7c, 0xc9, 0x21, 0x00, 0x00, 0x00, 0x4e, 0xf5, 0x37, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfc, 0x18, 0x0a, 0x90,
+  0x00, 0x6e, 0x00, 0x09, 0xa0, 0x00, 0x3f, 0x20, 0x09, 0xa0, 0x00, 0x0f, 0x50,
+  0x0a, 0x90, 0x00, 0x0e, 0x60, 0x0a, 0x90, 0x00, 0x0f, 0x50, 0x09, 0xb0, 0x00,
+  0x3f, 0x20, 0x03, 0xf6, 0x24, 0xda, 0x00, 0x00, 0x5d, 0xfe, 0x80, 0x37, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x10, 0x10, 0x05,
+  0x00, 0x10, 0xd7, 0x05, 0x00, 0xf4, 0x1b, 0xe7, 0x00, 0x00, 0x00, 0x8f, 0xff,
+  0xd4, 0x00, 0x09, 0xd2, 0xd7, 0x6f, 0x30, 0x1f, 0x40, 0xd7, 0x0b, 0xa0, 0x4f,
+  0x10, 0xd7, 0x07, 0xd0, 0x3f, 0x10, 0xd7, 0x08, 0xd0, 0x0f, 0x50, 0xd7, 0x0c,
+  0x90, 0x07, 0xe5, 0xe8, 0x9f, 0x20, 0x00, 0x6d, 0xff, 0xb2, 0x32, 0x00, 0x01,
+  0x05, 0x00, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0a, 0xf0, 0x2d, 0x0c, 0xa0, 0x00, 0x3f, 0x30, 0x03, 0xf4, 0x00,
+  0xb9, 0x00, 0x00, 0x8d, 0x04, 0xf1, 0x00, 0x00, 0x0d, 0x7d, 0x70, 0x00, 0x00,
+  0x04, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x09, 0xbe, 0x50,
+  0x00, 0x00, 0x3f, 0x25, 0xe1, 0x00, 0x00, 0xc8, 0x00, 0xca, 0x00, 0x06, 0xe1,
+  0x00, 0x2f, 0x40, 0x0b, 0x60, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x01, 0x00, 0x10, 0x11, 0x05, 0x00, 0x13, 0xd7, 0x05, 0x00, 0xf0,
+  0x05, 0x1f, 0x20, 0xd7, 0x0e, 0x50, 0x0f, 0x30, 0xd7, 0x0a, 0x90, 0x0f, 0x30,
+  0xd7, 0x08, 0xc0, 0x0f, 0x30, 0xd7, 0x07, 0xd0, 0x0a, 0x00, 0xf7, 0x00, 0xb0,
+  0x0e, 0x60, 0xd7, 0x0c, 0x80, 0x08, 0xe3, 0xd9, 0x8f, 0x10, 0x00, 0x8e, 0xff,
+  0xc3, 0x32, 0x00, 0xa0, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfb, 0x19, 0x06, 0xd0, 0x00, 0x4e, 0x10,
+  0x0d, 0x80, 0x00, 0x0d, 0x80, 0x3f, 0x10, 0x10, 0x08, 0xd0, 0x6e, 0x00, 0xd6,
+  0x05, 0xf0, 0x6d, 0x00, 0xc5, 0x04, 0xf0, 0x5f, 0x00, 0xd6, 0x06, 0xe0, 0x1f,
+  0x74, 0xeb, 0x2d, 0x90, 0x04, 0xee, 0x39, 0xfb, 0x10, 0x37, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x0f, 0x02, 0x00,
+  0x00, 0x00, 0x2a, 0xfe, 0xfa, 0x10, 0x01, 0xe9, 0x10, 0x08, 0x10, 0x07, 0xd0,
+  0x00, 0x00, 0x00, 0x0a, 0xfb, 0xbb, 0x90, 0x00, 0x0a, 0xe4, 0x44, 0x30, 0x00,
+  0x07, 0xe0, 0x22, 0x00, 0x8c, 0xdc, 0x41, 0x39, 0x50, 0x00, 0x19, 0xef, 0xe8,
+  0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b,
+  0xf3, 0x08, 0xbb, 0xbb, 0x70, 0x00, 0x01, 0xe4, 0x44, 0x30, 0x00, 0x01, 0xe0,
+  0x00, 0x00, 0x00, 0x01, 0xfc, 0xc9, 0x00, 0x00, 0x01, 0xe2, 0x21, 0x00, 0x0f,
+  0x00, 0x01, 0x05, 0x00, 0x3c, 0xff, 0xff, 0xa0, 0x36, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x23, 0xfb, 0x00, 0x05, 0x10, 0x42,
+  0x03, 0x30, 0x6f, 0xa3, 0xfd, 0x1f, 0xf0, 0x3f, 0x71, 0xea, 0x0d, 0xc0, 0x1e,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xf8,
+  0x1b, 0x18, 0xba, 0x40, 0x00, 0x02, 0xe6, 0x35, 0xca, 0x00, 0x0b, 0x60, 0x00,
+  0x0b, 0x70, 0x0e, 0x00, 0x04, 0x8c, 0xb0, 0x0e, 0x9c, 0xd9, 0x51, 0x00, 0x0c,
+  0xa1, 0x00, 0x00, 0x00, 0x03, 0xe4, 0x00, 0x2c, 0x90, 0x00, 0x4d, 0xdd, 0xe7,
+  0x00, 0x00, 0x00, 0x11, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x07, 0xf0, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x00,
+  0x00, 0x00, 0x6d, 0x10, 0x00, 0x00, 0x07, 0xc1, 0x00, 0x00, 0x00, 0x6f, 0xdc,
+  0xcc, 0xcc, 0xc1, 0x2e, 0xa5, 0x55, 0x55, 0x50, 0x02, 0xd6, 0x22, 0x00, 0x7d,
+  0x1d, 0x70, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf8, 0x12, 0x51, 0x00, 0x00, 0x00,
+  0x05, 0xfd, 0x10, 0x00, 0x00, 0x5d, 0xdb, 0xd1, 0x00, 0x04, 0xe2, 0xc5, 0x6c,
+  0x10, 0x3e, 0x20, 0xc5, 0x08, 0xc0, 0x02, 0x00, 0xc5, 0x00, 0x20, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x05, 0x00, 0x18, 0x21, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x10, 0x21, 0x05, 0x00, 0x70, 0x6d,
+  0x10, 0x00, 0x00, 0x00, 0x06, 0xd2, 0x0b, 0x00, 0xfd, 0x0a, 0x5d, 0x20, 0x6c,
+  0xcc, 0xcc, 0xce, 0xe1, 0x25, 0x55, 0x55, 0x5e, 0x90, 0x00, 0x00, 0x00, 0xb9,
+  0x00, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x00, 0x00, 0x78, 0x3a, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x10, 0x73, 0x05, 0x00,
+  0x18, 0xc5, 0x05, 0x00, 0xfd, 0x08, 0x28, 0x00, 0xc5, 0x01, 0x90, 0x0c, 0x70,
+  0xc5, 0x1d, 0x70, 0x00, 0xc6, 0xc6, 0xc7, 0x00, 0x00, 0x1c, 0xee, 0x70, 0x00,
+  0x00, 0x01, 0xd8, 0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x06, 0xf0, 0x0a, 0x02, 0xd9, 0x00, 0x00, 0x00, 0x4d, 0xec, 0xb0, 0x00, 0x45,
+  0xd2, 0xc5, 0x7d, 0x00, 0xd1, 0x10, 0xc5, 0x03, 0x00, 0xe0, 0x00, 0xc5, 0x00,
+  0x00, 0xc0, 0x05, 0x00, 0xf8, 0x03, 0xc5, 0x60, 0xc5, 0x09, 0x00, 0x11, 0xc8,
+  0xc7, 0xc7, 0x00, 0x00, 0x0a, 0xff, 0x50, 0x00, 0x00, 0x00, 0x73, 0x3b, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf0, 0x13,
+  0x02, 0x55, 0x55, 0x43, 0x00, 0x07, 0xfc, 0x9a, 0xa7, 0x00, 0x07, 0xcf, 0x30,
+  0x00, 0x00, 0x06, 0x85, 0xe3, 0x00, 0x00, 0x06, 0x80, 0x5e, 0x30, 0x00, 0x06,
+  0x90, 0x05, 0xe3, 0x00, 0x04, 0x70, 0x00, 0x5e, 0x26, 0x00, 0x1c, 0x01, 0x37,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff,
+  0x12, 0x44, 0x55, 0x55, 0x00, 0x01, 0xba, 0xa9, 0xff, 0x00, 0x00, 0x00, 0x0a,
+  0xce, 0x00, 0x00, 0x00, 0xac, 0x1e, 0x00, 0x00, 0x0a, 0xc1, 0x0e, 0x00, 0x00,
+  0xac, 0x10, 0x1e, 0x00, 0x07, 0xc1, 0x00, 0x1a, 0x36, 0x00, 0x02, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xff, 0x13, 0x02, 0x50,
+  0x00, 0x02, 0x00, 0x03, 0xf6, 0x00, 0x0f, 0x00, 0x00, 0x3e, 0x60, 0x0f, 0x00,
+  0x00, 0x03, 0xe6, 0x0f, 0x00, 0x00, 0x00, 0x3e, 0x6e, 0x00, 0x00, 0x21, 0x13,
+  0xef, 0x00, 0x01, 0xdd, 0xee, 0xee, 0x37, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff, 0x12, 0x20, 0x00, 0x07, 0x00,
+  0x04, 0xb0, 0x00, 0xac, 0x00, 0x04, 0xa0, 0x0a, 0xc0, 0x00, 0x04, 0xa0, 0xac,
+  0x00, 0x00, 0x05, 0x9a, 0xc0, 0x00, 0x00, 0x05, 0xfc, 0x10, 0x11, 0x00, 0x05,
+  0xee, 0xee, 0xea, 0x36, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x07, 0xf0, 0x04, 0x30, 0x00, 0x00, 0x00, 0x06, 0xd1, 0x00,
+  0x00, 0x00, 0x8f, 0x31, 0x11, 0x10, 0x07, 0xfd, 0xcc, 0xcc, 0xc1, 0x6c, 0x17,
+  0x00, 0xfd, 0x03, 0x2d, 0x63, 0x33, 0x33, 0x30, 0x02, 0xff, 0xaa, 0xaa, 0xa1,
+  0x00, 0x1d, 0x60, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x3a, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0xf7, 0x12, 0x51, 0x00, 0x00,
+  0x00, 0x05, 0xdd, 0x10, 0x00, 0x00, 0x5f, 0x17, 0xf1, 0x00, 0x04, 0xfe, 0x02,
+  0xfc, 0x10, 0x3e, 0x4c, 0x02, 0xb7, 0xc0, 0x02, 0x1c, 0x02, 0xb0, 0x20, 0x00,
+  0x1c, 0x02, 0xb0, 0x00, 0x05, 0x00, 0x37, 0x02, 0x00, 0x20, 0x3a, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x10, 0x21, 0x05,
+  0x00, 0xfd, 0x15, 0x6d, 0x10, 0x00, 0x01, 0x11, 0x17, 0xf2, 0x00, 0x6c, 0xcc,
+  0xcc, 0xff, 0x20, 0x00, 0x00, 0x00, 0x04, 0xe1, 0x13, 0x33, 0x33, 0x3b, 0x90,
+  0x5a, 0xaa, 0xab, 0xfb, 0x00, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x00, 0x00, 0x78,
+  0x3a, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x06,
+  0x87, 0x07, 0x01, 0x60, 0x00, 0x00, 0x1c, 0x02, 0xb0, 0x05, 0x00, 0xfd, 0x08,
+  0x28, 0x1c, 0x02, 0xb1, 0x90, 0x0c, 0x9c, 0x02, 0xcd, 0x70, 0x00, 0xef, 0x03,
+  0xf7, 0x00, 0x00, 0x1e, 0x6c, 0x90, 0x00, 0x00, 0x01, 0xd8, 0x3b, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x21, 0x4c, 0x00,
+  0x00, 0x05, 0xc0, 0x1f, 0x50, 0x00, 0x0b, 0xa0, 0x0b, 0xa0, 0x00, 0x0f, 0x40,
+  0x06, 0xf9, 0x99, 0xef, 0x00, 0x01, 0xfb, 0x77, 0xfb, 0x00, 0x00, 0xb8, 0x00,
+  0xe4, 0x00, 0x00, 0x5d, 0x04, 0xe0, 0x00, 0x00, 0x0f, 0x28, 0x90, 0x00, 0x00,
+  0x0b, 0x7d, 0x40, 0x00, 0x00, 0x05, 0xde, 0x34, 0x00, 0x2c, 0xa7, 0x00, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x80, 0x08,
+  0xed, 0x80, 0x00, 0x00, 0x4a, 0x34, 0xe8, 0x0c, 0x00, 0x10, 0x5f, 0x05, 0x00,
+  0xfc, 0x15, 0x0f, 0x40, 0x00, 0x17, 0xa8, 0x1e, 0x50, 0x01, 0xdb, 0x68, 0xdf,
+  0x50, 0x08, 0xc0, 0x00, 0x3f, 0x30, 0x0b, 0x80, 0x00, 0x4f, 0x00, 0x0b, 0x90,
+  0x00, 0xaa, 0x00, 0x05, 0xf5, 0x28, 0xe1, 0x00, 0x00, 0x7e, 0xfb, 0x20, 0x45,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x90, 0x06,
+  0xaa, 0xaa, 0xa8, 0x00, 0x02, 0x33, 0x33, 0x5d, 0x0d, 0x00, 0x13, 0x2d, 0x05,
+  0x00, 0x88, 0x01, 0x11, 0x3d, 0x00, 0x00, 0x9c, 0xcc, 0xcd, 0x14, 0x00, 0x05,
+  0x05, 0x00, 0x5b, 0x0a, 0xdd, 0xdd, 0xdd, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf9, 0x2c, 0x40, 0x00, 0x06, 0xaa,
+  0xab, 0xf8, 0x00, 0x02, 0x33, 0x3a, 0x9d, 0x00, 0x00, 0x00, 0x0b, 0x2d, 0x00,
+  0x00, 0x00, 0x28, 0x2d, 0x00, 0x00, 0x01, 0xa3, 0x3d, 0x00, 0x00, 0x9c, 0xfc,
+  0xcd, 0x00, 0x00, 0x04, 0x60, 0x2d, 0x00, 0x00, 0x0a, 0x10, 0x2d, 0x00, 0x00,
+  0x1a, 0x00, 0x2d, 0x00, 0x00, 0x64, 0x00, 0x2d, 0x00, 0x0a, 0xfd, 0xdd, 0xdd,
+  0x00, 0x01, 0x70, 0x48, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x06, 0xf0, 0x10, 0x28, 0xaa, 0xaa, 0x50, 0x03, 0xe8, 0x54, 0x44,
+  0x20, 0x0a, 0x60, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x22, 0x22, 0x10, 0x0e, 0xbc,
+  0xcc, 0xcc, 0x60, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x09, 0xa0, 0x23, 0x00, 0x9b,
+  0xbe, 0xba, 0xaa, 0x50, 0x00, 0x02, 0x44, 0x44, 0x20, 0x3b, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0xf8, 0x28, 0x30, 0x00, 0x00,
+  0x00, 0x03, 0xb0, 0x00, 0x00, 0x28, 0xaf, 0xfa, 0x50, 0x03, 0xe8, 0x5f, 0x94,
+  0x20, 0x0a, 0x60, 0x0e, 0x10, 0x00, 0x0d, 0x02, 0x19, 0x22, 0x10, 0x0e, 0xbc,
+  0xba, 0xcc, 0x60, 0x0d, 0x20, 0x77, 0x00, 0x00, 0x09, 0xa0, 0xb4, 0x00, 0x00,
+  0x00, 0xbe, 0xfb, 0xaa, 0x50, 0x00, 0x04, 0xf4, 0x44, 0x20, 0x00, 0x04, 0x90,
+  0x43, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xc0,
+  0x04, 0x66, 0x66, 0x66, 0x20, 0x09, 0xfb, 0xbb, 0xbb, 0x40, 0x01, 0xe6, 0x10,
+  0x00, 0x70, 0x4f, 0x20, 0x00, 0x00, 0x00, 0x09, 0xc0, 0x0b, 0x00, 0x15, 0xd8,
+  0x10, 0x00, 0xb3, 0xbb, 0x00, 0x00, 0x00, 0x06, 0xe1, 0x00, 0x00, 0x00, 0x2f,
+  0x40, 0x18, 0x00, 0xf0, 0x05, 0x09, 0xf6, 0x66, 0x66, 0x50, 0x0a, 0xbb, 0xbb,
+  0xbb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x05, 0x00, 0x10, 0xd2, 0x05, 0x00, 0xf0, 0x2c,
+  0xe0, 0x00, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00,
+  0x00, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x62, 0x00, 0x3b, 0x00,
+  0x0b, 0xc8, 0x00, 0x77, 0x00, 0x00, 0x3d, 0x00, 0xb3, 0x00, 0x00, 0x0d, 0x30,
+  0xe0, 0x00, 0x00, 0x07, 0x82, 0xc0, 0x00, 0x00, 0x02, 0xd6, 0x80, 0x00, 0x00,
+  0x00, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x7f, 0x3f, 0x00, 0x10, 0x14, 0x05, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x0a, 0xff, 0x0e, 0x08, 0xa2, 0x02, 0x9a, 0x40, 0xa7, 0x6d, 0x4e, 0x64, 0xc4,
+  0xf0, 0x05, 0xf2, 0x00, 0x68, 0xd1, 0x0c, 0xcb, 0x10, 0x87, 0x2c, 0xd7, 0x09,
+  0xfe, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x37, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0xf1, 0x08, 0x01, 0x43, 0x00, 0x00,
+  0x00, 0x6f, 0xde, 0xd1, 0x00, 0x01, 0xf3, 0x00, 0x9b, 0x00, 0x06, 0xb0, 0x00,
+  0x1f, 0x00, 0x07, 0x90, 0x00, 0x0f, 0x05, 0x00, 0x16, 0x10, 0x05, 0x00, 0x4f,
+  0x01, 0x10, 0x00, 0x02, 0x40, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x01, 0x00, 0xaa, 0x02, 0x20, 0x00, 0x04, 0x00, 0x07, 0x90,
+  0x00, 0x0f, 0x10, 0x05, 0x00, 0xff, 0x05, 0x00, 0x05, 0xb0, 0x00, 0x2f, 0x00,
+  0x01, 0xe5, 0x01, 0xb9, 0x00, 0x00, 0x3d, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01,
+  0x00, 0xb0, 0x1a, 0xc0, 0x00, 0x00, 0x00, 0x9c, 0x30, 0x00, 0x00, 0x00, 0xc5,
+  0x0f, 0x00, 0x10, 0xe4, 0x05, 0x00, 0x10, 0xe5, 0x05, 0x00, 0x10, 0xd5, 0x05,
+  0x00, 0x10, 0xb7, 0x05, 0x00, 0x10, 0xa9, 0x05, 0x00, 0x10, 0x8b, 0x05, 0x00,
+  0x10, 0x6c, 0x05, 0x00, 0x10, 0x5e, 0x05, 0x00, 0x10, 0x4e, 0x05, 0x00, 0x10,
+  0x4d, 0x05, 0x00, 0xf0, 0x03, 0x7b, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0x00, 0x00,
+  0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x06, 0xdf, 0x59, 0x30, 0x05, 0x10, 0x05, 0xc7, 0xd9, 0x6d, 0x10, 0x06,
+  0x20, 0x08, 0xa2, 0x14, 0x00, 0x08, 0x1e, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x03, 0x10, 0x46, 0x05, 0x00, 0xf0,
+  0x0e, 0xd1, 0x00, 0x07, 0xbb, 0xbc, 0xeb, 0x20, 0x03, 0x55, 0x6d, 0x55, 0x10,
+  0x00, 0x00, 0xa4, 0x00, 0x00, 0x02, 0x46, 0xd4, 0x44, 0x00, 0x07, 0xcf, 0xbb,
+  0xbb, 0x20, 0x00, 0x78, 0x21, 0x00, 0x1f, 0xa0, 0x3e, 0x00, 0x04, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0x5f, 0x09, 0xff, 0xff,
+  0xff, 0x30, 0x0f, 0x00, 0x15, 0x0b, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x01, 0x00, 0x08, 0xfb, 0x1b, 0x17, 0x20, 0x00, 0x00, 0x6b,
+  0xfa, 0x10, 0x03, 0xaf, 0xb5, 0x00, 0x00, 0x0a, 0xf7, 0x10, 0x00, 0x00, 0x00,
+  0x5a, 0xfb, 0x60, 0x00, 0x00, 0x00, 0x06, 0xbf, 0x30, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x01, 0x33, 0x33, 0x33, 0x00, 0x08, 0xdd, 0xdd, 0xdd, 0x30, 0x39, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x05, 0xf0, 0x10,
+  0x06, 0x40, 0x00, 0x00, 0x00, 0x05, 0xde, 0x93, 0x00, 0x00, 0x00, 0x02, 0x8d,
+  0xe8, 0x10, 0x00, 0x00, 0x03, 0xaf, 0x30, 0x00, 0x28, 0xde, 0x82, 0x00, 0x09,
+  0xe9, 0x30, 0x00, 0x00, 0x02, 0x23, 0x00, 0xab, 0x01, 0x33, 0x33, 0x33, 0x00,
+  0x08, 0xdd, 0xdd, 0xdd, 0x30, 0x3c, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x0b, 0xa0, 0x8c, 0xdd, 0xdd, 0xc0, 0x0b, 0xb4, 0x11,
+  0x11, 0x10, 0x3d, 0x0e, 0x00, 0x10, 0x4b, 0x05, 0x00, 0xff, 0x00, 0x0d, 0x70,
+  0x00, 0x00, 0x00, 0x02, 0xcf, 0xdd, 0xdd, 0xc0, 0x00, 0x00, 0x11, 0x11, 0x10,
+  0x36, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x02, 0x10, 0x01, 0x05, 0x00, 0xf0, 0x04, 0x09, 0x60, 0x00, 0x00, 0x8c, 0xdf,
+  0xfd, 0xc0, 0x0b, 0xb4, 0x1e, 0x41, 0x10, 0x3d, 0x00, 0x0e, 0x00, 0x00, 0x4b,
+  0x05, 0x00, 0xfd, 0x03, 0x0d, 0x70, 0x2c, 0x00, 0x00, 0x02, 0xcf, 0xff, 0xdd,
+  0xc0, 0x00, 0x00, 0x7a, 0x11, 0x10, 0x00, 0x00, 0x22, 0x3f, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02, 0xfd, 0x07, 0x54, 0x00,
+  0x00, 0x00, 0x3e, 0xac, 0xb0, 0x00, 0x00, 0xe5, 0x00, 0xb7, 0x00, 0x01, 0xe0,
+  0x00, 0x5b, 0x00, 0x02, 0xc0, 0x00, 0x3c, 0x05, 0x00, 0x3f, 0xa0, 0x00, 0x2b,
+  0x3f, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x01,
+  0x00, 0x9d, 0x01, 0x40, 0x00, 0x14, 0x00, 0x02, 0xc0, 0x00, 0x3c, 0x05, 0x00,
+  0xff, 0x04, 0xd0, 0x00, 0x3c, 0x00, 0x00, 0xf1, 0x00, 0x7a, 0x00, 0x00, 0x9b,
+  0x24, 0xe3, 0x00, 0x00, 0x07, 0xdc, 0x30, 0x00, 0x01, 0x00, 0x01, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0f, 0xa1, 0x13, 0x20, 0x33,
+  0x03, 0x30, 0x7f, 0xa4, 0xfe, 0x1f, 0xf1, 0x05, 0x00, 0x5f, 0x14, 0x21, 0x43,
+  0x04, 0x40, 0x32, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0xdf, 0x08, 0x88, 0x88, 0x00, 0x00, 0x0d, 0x97, 0x33, 0x00, 0x00,
+  0x0d, 0x84, 0x00, 0x05, 0x00, 0x21, 0xe0, 0x0e, 0xca, 0x88, 0x00, 0x00, 0x03,
+  0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0xdf,
+  0x03, 0x88, 0x88, 0x50, 0x00, 0x01, 0x33, 0xc7, 0xa0, 0x00, 0x00, 0x00, 0xb5,
+  0x05, 0x00, 0x21, 0xf0, 0x00, 0x03, 0x88, 0xda, 0xa0, 0x00, 0x01, 0x33, 0x33,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfb, 0x28,
+  0x0c, 0xcc, 0xcc, 0xcc, 0x70, 0x0f, 0xf4, 0x33, 0xaf, 0x90, 0x0f, 0x8a, 0x01,
+  0xe9, 0x90, 0x0f, 0x1e, 0x29, 0x87, 0x90, 0x0f, 0x06, 0xce, 0x17, 0x90, 0x0f,
+  0x01, 0xfa, 0x07, 0x90, 0x0f, 0x08, 0x9e, 0x27, 0x90, 0x0f, 0x2e, 0x17, 0xb7,
+  0x90, 0x0f, 0xb7, 0x00, 0xeb, 0x90, 0x0f, 0xe2, 0x22, 0x7f, 0x90, 0x0d, 0xdd,
+  0xdd, 0xdd, 0x70, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0x70, 0x01, 0x86, 0x00, 0x00, 0x00, 0x02, 0xfc, 0x0a, 0x00, 0x14,
+  0x64, 0x14, 0x00, 0x60, 0x2b, 0xfb, 0x00, 0x00, 0x00, 0xfb, 0x14, 0x00, 0x24,
+  0x32, 0xfc, 0x1e, 0x00, 0x08, 0x05, 0x00, 0x7b, 0xaa, 0x00, 0x00, 0x00, 0xaf,
+  0xb1, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateLargeFont(tableLength, table, glyphWidth, glyphHeight, glyphDataOffset, glyphData);
@@ -0,0 +1,639 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTRnull, 0, 0, "")
+QDEF(MP_QSTR_, 5381, 0, "")
+QDEF(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF(MP_QSTR__space_, 46469, 1, " ")
+QDEF(MP_QSTR__star_, 46479, 1, "*")
+QDEF(MP_QSTR__slash_, 46474, 1, "/")
+QDEF(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF(MP_QSTR__, 46586, 1, "_")
+QDEF(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF(MP_QSTR_abs, 12949, 3, "abs")
+QDEF(MP_QSTR_all, 13124, 3, "all")
+QDEF(MP_QSTR_any, 13075, 3, "any")
+QDEF(MP_QSTR_append, 38763, 6, "append")
+QDEF(MP_QSTR_args, 50882, 4, "args")
+QDEF(MP_QSTR_bool, 15595, 4, "bool")
+QDEF(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF(MP_QSTR_callable, 28685, 8, "callable")
+QDEF(MP_QSTR_chr, 19676, 3, "chr")
+QDEF(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF(MP_QSTR_clear, 41084, 5, "clear")
+QDEF(MP_QSTR_close, 26419, 5, "close")
+QDEF(MP_QSTR_const, 65472, 5, "const")
+QDEF(MP_QSTR_copy, 56288, 4, "copy")
+QDEF(MP_QSTR_count, 19878, 5, "count")
+QDEF(MP_QSTR_dict, 64575, 4, "dict")
+QDEF(MP_QSTR_dir, 7930, 3, "dir")
+QDEF(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF(MP_QSTR_end, 8970, 3, "end")
+QDEF(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF(MP_QSTR_eval, 42651, 4, "eval")
+QDEF(MP_QSTR_exec, 49182, 4, "exec")
+QDEF(MP_QSTR_extend, 59491, 6, "extend")
+QDEF(MP_QSTR_find, 13312, 4, "find")
+QDEF(MP_QSTR_format, 13094, 6, "format")
+QDEF(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF(MP_QSTR_get, 15155, 3, "get")
+QDEF(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF(MP_QSTR_globals, 18845, 7, "globals")
+QDEF(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF(MP_QSTR_hash, 28855, 4, "hash")
+QDEF(MP_QSTR_id, 28456, 2, "id")
+QDEF(MP_QSTR_index, 10363, 5, "index")
+QDEF(MP_QSTR_insert, 21522, 6, "insert")
+QDEF(MP_QSTR_int, 21270, 3, "int")
+QDEF(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF(MP_QSTR_islower, 33020, 7, "islower")
+QDEF(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF(MP_QSTR_items, 21475, 5, "items")
+QDEF(MP_QSTR_iter, 8591, 4, "iter")
+QDEF(MP_QSTR_join, 23719, 4, "join")
+QDEF(MP_QSTR_key, 27954, 3, "key")
+QDEF(MP_QSTR_keys, 4865, 4, "keys")
+QDEF(MP_QSTR_len, 16482, 3, "len")
+QDEF(MP_QSTR_list, 7463, 4, "list")
+QDEF(MP_QSTR_little, 27273, 6, "little")
+QDEF(MP_QSTR_locals, 41275, 6, "locals")
+QDEF(MP_QSTR_lower, 52166, 5, "lower")
+QDEF(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF(MP_QSTR_main, 47054, 4, "main")
+QDEF(MP_QSTR_map, 17337, 3, "map")
+QDEF(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF(MP_QSTR_next, 34882, 4, "next")
+QDEF(MP_QSTR_object, 36240, 6, "object")
+QDEF(MP_QSTR_open, 15057, 4, "open")
+QDEF(MP_QSTR_ord, 24092, 3, "ord")
+QDEF(MP_QSTR_pop, 29482, 3, "pop")
+QDEF(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF(MP_QSTR_pow, 29485, 3, "pow")
+QDEF(MP_QSTR_print, 50772, 5, "print")
+QDEF(MP_QSTR_range, 24090, 5, "range")
+QDEF(MP_QSTR_read, 63927, 4, "read")
+QDEF(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF(MP_QSTR_readline, 6649, 8, "readline")
+QDEF(MP_QSTR_remove, 35427, 6, "remove")
+QDEF(MP_QSTR_replace, 9545, 7, "replace")
+QDEF(MP_QSTR_repr, 63440, 4, "repr")
+QDEF(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF(MP_QSTR_round, 9703, 5, "round")
+QDEF(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF(MP_QSTR_self, 30585, 4, "self")
+QDEF(MP_QSTR_send, 30393, 4, "send")
+QDEF(MP_QSTR_sep, 36643, 3, "sep")
+QDEF(MP_QSTR_set, 36647, 3, "set")
+QDEF(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF(MP_QSTR_sort, 40383, 4, "sort")
+QDEF(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF(MP_QSTR_split, 13239, 5, "split")
+QDEF(MP_QSTR_start, 61317, 5, "start")
+QDEF(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF(MP_QSTR_step, 13911, 4, "step")
+QDEF(MP_QSTR_stop, 13981, 4, "stop")
+QDEF(MP_QSTR_str, 36176, 3, "str")
+QDEF(MP_QSTR_strip, 7721, 5, "strip")
+QDEF(MP_QSTR_sum, 36142, 3, "sum")
+QDEF(MP_QSTR_super, 45764, 5, "super")
+QDEF(MP_QSTR_throw, 17587, 5, "throw")
+QDEF(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF(MP_QSTR_type, 32669, 4, "type")
+QDEF(MP_QSTR_update, 30388, 6, "update")
+QDEF(MP_QSTR_upper, 37927, 5, "upper")
+QDEF(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF(MP_QSTR_value, 13390, 5, "value")
+QDEF(MP_QSTR_values, 48765, 6, "values")
+QDEF(MP_QSTR_write, 43160, 5, "write")
+QDEF(MP_QSTR_zip, 44262, 3, "zip")
+QDEF(MP_QSTR___abs__, 54933, 7, "__abs__")
+QDEF(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF(MP_QSTR___and__, 56078, 7, "__and__")
+QDEF(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF(MP_QSTR___divmod__, 4472, 10, "__divmod__")
+QDEF(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF(MP_QSTR___floordiv__, 24390, 12, "__floordiv__")
+QDEF(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF(MP_QSTR___invert__, 30711, 10, "__invert__")
+QDEF(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF(MP_QSTR___lshift__, 34825, 10, "__lshift__")
+QDEF(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF(MP_QSTR___matmul__, 62281, 10, "__matmul__")
+QDEF(MP_QSTR___mod__, 14179, 7, "__mod__")
+QDEF(MP_QSTR___mul__, 16945, 7, "__mul__")
+QDEF(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF(MP_QSTR___neg__, 54633, 7, "__neg__")
+QDEF(MP_QSTR___or__, 47928, 6, "__or__")
+QDEF(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF(MP_QSTR___pos__, 61481, 7, "__pos__")
+QDEF(MP_QSTR___pow__, 45, 7, "__pow__")
+QDEF(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF(MP_QSTR___rshift__, 38999, 10, "__rshift__")
+QDEF(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF(MP_QSTR___truediv__, 61320, 11, "__truediv__")
+QDEF(MP_QSTR___xor__, 60448, 7, "__xor__")
+QDEF(MP_QSTR___version__, 38975, 11, "__version__")
+QDEF(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, 7795, 32, "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF(MP_QSTR_acos, 40987, 4, "acos")
+QDEF(MP_QSTR_acosh, 41747, 5, "acosh")
+QDEF(MP_QSTR_add, 12868, 3, "add")
+QDEF(MP_QSTR_asin, 58704, 4, "asin")
+QDEF(MP_QSTR_asinh, 36664, 5, "asinh")
+QDEF(MP_QSTR_atan, 48671, 4, "atan")
+QDEF(MP_QSTR_atan2, 33229, 5, "atan2")
+QDEF(MP_QSTR_atanh, 33175, 5, "atanh")
+QDEF(MP_QSTR_bin, 18656, 3, "bin")
+QDEF(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF(MP_QSTR_ceil, 45062, 4, "ceil")
+QDEF(MP_QSTR_choice, 13102, 6, "choice")
+QDEF(MP_QSTR_closure, 51828, 7, "closure")
+QDEF(MP_QSTR_cmath, 62646, 5, "cmath")
+QDEF(MP_QSTR_complex, 40389, 7, "complex")
+QDEF(MP_QSTR_copysign, 5171, 8, "copysign")
+QDEF(MP_QSTR_cos, 19578, 3, "cos")
+QDEF(MP_QSTR_cosh, 56274, 4, "cosh")
+QDEF(MP_QSTR_default, 32206, 7, "default")
+QDEF(MP_QSTR_degrees, 16642, 7, "degrees")
+QDEF(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF(MP_QSTR_difference, 9330, 10, "difference")
+QDEF(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF(MP_QSTR_discard, 28943, 7, "discard")
+QDEF(MP_QSTR_doc, 7981, 3, "doc")
+QDEF(MP_QSTR_e, 46528, 1, "e")
+QDEF(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF(MP_QSTR_erf, 9108, 3, "erf")
+QDEF(MP_QSTR_erfc, 38519, 4, "erfc")
+QDEF(MP_QSTR_errno, 4545, 5, "errno")
+QDEF(MP_QSTR_exp, 9416, 3, "exp")
+QDEF(MP_QSTR_expm1, 29300, 5, "expm1")
+QDEF(MP_QSTR_fabs, 4755, 4, "fabs")
+QDEF(MP_QSTR_factorial, 13004, 9, "factorial")
+QDEF(MP_QSTR_filter, 48677, 6, "filter")
+QDEF(MP_QSTR_float, 17461, 5, "float")
+QDEF(MP_QSTR_floor, 18045, 5, "floor")
+QDEF(MP_QSTR_fmod, 17637, 4, "fmod")
+QDEF(MP_QSTR_frexp, 38940, 5, "frexp")
+QDEF(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF(MP_QSTR_frozenset, 40173, 9, "frozenset")
+QDEF(MP_QSTR_function, 551, 8, "function")
+QDEF(MP_QSTR_gamma, 36866, 5, "gamma")
+QDEF(MP_QSTR_generator, 50070, 9, "generator")
+QDEF(MP_QSTR_getrandbits, 32102, 11, "getrandbits")
+QDEF(MP_QSTR_getter, 45712, 6, "getter")
+QDEF(MP_QSTR_heap_lock, 36013, 9, "heap_lock")
+QDEF(MP_QSTR_heap_unlock, 11606, 11, "heap_unlock")
+QDEF(MP_QSTR_hex, 20592, 3, "hex")
+QDEF(MP_QSTR_imag, 46919, 4, "imag")
+QDEF(MP_QSTR_input, 23155, 5, "input")
+QDEF(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF(MP_QSTR_isfinite, 43942, 8, "isfinite")
+QDEF(MP_QSTR_isinf, 4414, 5, "isinf")
+QDEF(MP_QSTR_isnan, 926, 5, "isnan")
+QDEF(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF(MP_QSTR_kbd_intr, 5110, 8, "kbd_intr")
+QDEF(MP_QSTR_ldexp, 28480, 5, "ldexp")
+QDEF(MP_QSTR_lgamma, 27854, 6, "lgamma")
+QDEF(MP_QSTR_log, 16161, 3, "log")
+QDEF(MP_QSTR_log10, 37184, 5, "log10")
+QDEF(MP_QSTR_log2, 9075, 4, "log2")
+QDEF(MP_QSTR_math, 47925, 4, "math")
+QDEF(MP_QSTR_max, 17329, 3, "max")
+QDEF(MP_QSTR_min, 17071, 3, "min")
+QDEF(MP_QSTR_modf, 49189, 4, "modf")
+QDEF(MP_QSTR_module, 39359, 6, "module")
+QDEF(MP_QSTR_oct, 23805, 3, "oct")
+QDEF(MP_QSTR_opt_level, 26503, 9, "opt_level")
+QDEF(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF(MP_QSTR_phase, 54634, 5, "phase")
+QDEF(MP_QSTR_pi, 28700, 2, "pi")
+QDEF(MP_QSTR_polar, 3077, 5, "polar")
+QDEF(MP_QSTR_property, 10690, 8, "property")
+QDEF(MP_QSTR_pystack_space_exhausted, 62209, 23, "pystack_space_exhausted")
+QDEF(MP_QSTR_pystack_use, 16894, 11, "pystack_use")
+QDEF(MP_QSTR_radians, 16263, 7, "radians")
+QDEF(MP_QSTR_randint, 56495, 7, "randint")
+QDEF(MP_QSTR_random, 11454, 6, "random")
+QDEF(MP_QSTR_randrange, 16035, 9, "randrange")
+QDEF(MP_QSTR_real, 63935, 4, "real")
+QDEF(MP_QSTR_rect, 63973, 4, "rect")
+QDEF(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF(MP_QSTR_seed, 30098, 4, "seed")
+QDEF(MP_QSTR_setter, 22788, 6, "setter")
+QDEF(MP_QSTR_sin, 37041, 3, "sin")
+QDEF(MP_QSTR_sinh, 42681, 4, "sinh")
+QDEF(MP_QSTR_slice, 62645, 5, "slice")
+QDEF(MP_QSTR_sqrt, 17441, 4, "sqrt")
+QDEF(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF(MP_QSTR_tan, 25086, 3, "tan")
+QDEF(MP_QSTR_tanh, 41430, 4, "tanh")
+QDEF(MP_QSTR_trunc, 39259, 5, "trunc")
+QDEF(MP_QSTR_uniform, 62721, 7, "uniform")
+QDEF(MP_QSTR_union, 31990, 5, "union")
+QDEF(MP_QSTR_get_keys, 59464, 8, "get_keys")
+QDEF(MP_QSTR_ion, 21485, 3, "ion")
+QDEF(MP_QSTR_keydown, 49664, 7, "keydown")
+QDEF(MP_QSTR_battery, 29096, 7, "battery")
+QDEF(MP_QSTR_battery_level, 23457, 13, "battery_level")
+QDEF(MP_QSTR_battery_ischarging, 20978, 18, "battery_ischarging")
+QDEF(MP_QSTR_set_brightness, 48785, 14, "set_brightness")
+QDEF(MP_QSTR_get_brightness, 65029, 14, "get_brightness")
+QDEF(MP_QSTR_KEY_LEFT, 27030, 8, "KEY_LEFT")
+QDEF(MP_QSTR_KEY_UP, 5032, 6, "KEY_UP")
+QDEF(MP_QSTR_KEY_DOWN, 50495, 8, "KEY_DOWN")
+QDEF(MP_QSTR_KEY_RIGHT, 47309, 9, "KEY_RIGHT")
+QDEF(MP_QSTR_KEY_OK, 4457, 6, "KEY_OK")
+QDEF(MP_QSTR_KEY_BACK, 58854, 8, "KEY_BACK")
+QDEF(MP_QSTR_KEY_HOME, 46178, 8, "KEY_HOME")
+QDEF(MP_QSTR_KEY_ONOFF, 31651, 9, "KEY_ONOFF")
+QDEF(MP_QSTR_KEY_SHIFT, 42733, 9, "KEY_SHIFT")
+QDEF(MP_QSTR_KEY_ALPHA, 43897, 9, "KEY_ALPHA")
+QDEF(MP_QSTR_KEY_XNT, 36719, 7, "KEY_XNT")
+QDEF(MP_QSTR_KEY_VAR, 38664, 7, "KEY_VAR")
+QDEF(MP_QSTR_KEY_TOOLBOX, 19040, 11, "KEY_TOOLBOX")
+QDEF(MP_QSTR_KEY_BACKSPACE, 23426, 13, "KEY_BACKSPACE")
+QDEF(MP_QSTR_KEY_EXP, 18400, 7, "KEY_EXP")
+QDEF(MP_QSTR_KEY_LN, 4431, 6, "KEY_LN")
+QDEF(MP_QSTR_KEY_LOG, 15177, 7, "KEY_LOG")
+QDEF(MP_QSTR_KEY_IMAGINARY, 17186, 13, "KEY_IMAGINARY")
+QDEF(MP_QSTR_KEY_COMMA, 26848, 9, "KEY_COMMA")
+QDEF(MP_QSTR_KEY_POWER, 35826, 9, "KEY_POWER")
+QDEF(MP_QSTR_KEY_SINE, 9980, 8, "KEY_SINE")
+QDEF(MP_QSTR_KEY_COSINE, 17488, 10, "KEY_COSINE")
+QDEF(MP_QSTR_KEY_TANGENT, 31022, 11, "KEY_TANGENT")
+QDEF(MP_QSTR_KEY_PI, 5332, 6, "KEY_PI")
+QDEF(MP_QSTR_KEY_SQRT, 1641, 8, "KEY_SQRT")
+QDEF(MP_QSTR_KEY_SQUARE, 52620, 10, "KEY_SQUARE")
+QDEF(MP_QSTR_KEY_SEVEN, 62118, 9, "KEY_SEVEN")
+QDEF(MP_QSTR_KEY_EIGHT, 47002, 9, "KEY_EIGHT")
+QDEF(MP_QSTR_KEY_NINE, 29377, 8, "KEY_NINE")
+QDEF(MP_QSTR_KEY_LEFTPARENTHESIS, 41614, 19, "KEY_LEFTPARENTHESIS")
+QDEF(MP_QSTR_KEY_RIGHTPARENTHESIS, 22901, 20, "KEY_RIGHTPARENTHESIS")
+QDEF(MP_QSTR_KEY_FOUR, 44195, 8, "KEY_FOUR")
+QDEF(MP_QSTR_KEY_FIVE, 38097, 8, "KEY_FIVE")
+QDEF(MP_QSTR_KEY_SIX, 45967, 7, "KEY_SIX")
+QDEF(MP_QSTR_KEY_MULTIPLICATION, 18191, 18, "KEY_MULTIPLICATION")
+QDEF(MP_QSTR_KEY_DIVISION, 19524, 12, "KEY_DIVISION")
+QDEF(MP_QSTR_KEY_ONE, 16041, 7, "KEY_ONE")
+QDEF(MP_QSTR_KEY_TWO, 40513, 7, "KEY_TWO")
+QDEF(MP_QSTR_KEY_THREE, 48067, 9, "KEY_THREE")
+QDEF(MP_QSTR_KEY_PLUS, 33655, 8, "KEY_PLUS")
+QDEF(MP_QSTR_KEY_MINUS, 39969, 9, "KEY_MINUS")
+QDEF(MP_QSTR_KEY_ZERO, 13775, 8, "KEY_ZERO")
+QDEF(MP_QSTR_KEY_DOT, 23378, 7, "KEY_DOT")
+QDEF(MP_QSTR_KEY_EE, 4525, 6, "KEY_EE")
+QDEF(MP_QSTR_KEY_ANS, 22065, 7, "KEY_ANS")
+QDEF(MP_QSTR_KEY_EXE, 18421, 7, "KEY_EXE")
+QDEF(MP_QSTR_kandinsky, 33347, 9, "kandinsky")
+QDEF(MP_QSTR_color, 1752, 5, "color")
+QDEF(MP_QSTR_draw_line, 34132, 9, "draw_line")
+QDEF(MP_QSTR_draw_string, 16815, 11, "draw_string")
+QDEF(MP_QSTR_draw_circle, 18792, 11, "draw_circle")
+QDEF(MP_QSTR_fill_rect, 60725, 9, "fill_rect")
+QDEF(MP_QSTR_fill_circle, 38887, 11, "fill_circle")
+QDEF(MP_QSTR_fill_polygon, 32249, 12, "fill_polygon")
+QDEF(MP_QSTR_get_pixel, 6052, 9, "get_pixel")
+QDEF(MP_QSTR_set_pixel, 55984, 9, "set_pixel")
+QDEF(MP_QSTR_large_font, 58452, 10, "large_font")
+QDEF(MP_QSTR_small_font, 34614, 10, "small_font")
+QDEF(MP_QSTR_wait_vblank, 47373, 11, "wait_vblank")
+QDEF(MP_QSTR_get_palette, 39217, 11, "get_palette")
+QDEF(MP_QSTR_PrimaryText, 44212, 11, "PrimaryText")
+QDEF(MP_QSTR_SecondaryText, 22594, 13, "SecondaryText")
+QDEF(MP_QSTR_AccentText, 55110, 10, "AccentText")
+QDEF(MP_QSTR_Toolbar, 18924, 7, "Toolbar")
+QDEF(MP_QSTR_HomeBackground, 26308, 14, "HomeBackground")
+QDEF(MP_QSTR_left, 19934, 4, "left")
+QDEF(MP_QSTR_up, 28576, 2, "up")
+QDEF(MP_QSTR_down, 1591, 4, "down")
+QDEF(MP_QSTR_right, 47845, 5, "right")
+QDEF(MP_QSTR_OK, 29537, 2, "OK")
+QDEF(MP_QSTR_back, 17646, 4, "back")
+QDEF(MP_QSTR_home, 13674, 4, "home")
+QDEF(MP_QSTR_onOff, 65387, 5, "onOff")
+QDEF(MP_QSTR_shift, 9605, 5, "shift")
+QDEF(MP_QSTR_alpha, 25681, 5, "alpha")
+QDEF(MP_QSTR_xnt, 37639, 3, "xnt")
+QDEF(MP_QSTR_var, 31456, 3, "var")
+QDEF(MP_QSTR_toolbox, 9864, 7, "toolbox")
+QDEF(MP_QSTR_backspace, 8042, 9, "backspace")
+QDEF(MP_QSTR_ln, 28295, 2, "ln")
+QDEF(MP_QSTR_imaginary, 32970, 9, "imaginary")
+QDEF(MP_QSTR_comma, 59848, 5, "comma")
+QDEF(MP_QSTR_power, 60890, 5, "power")
+QDEF(MP_QSTR_square, 26052, 6, "square")
+QDEF(MP_QSTR_7, 46482, 1, "7")
+QDEF(MP_QSTR_8, 46493, 1, "8")
+QDEF(MP_QSTR_9, 46492, 1, "9")
+QDEF(MP_QSTR__paren_open_, 46477, 1, "(")
+QDEF(MP_QSTR__paren_close_, 46476, 1, ")")
+QDEF(MP_QSTR_4, 46481, 1, "4")
+QDEF(MP_QSTR_5, 46480, 1, "5")
+QDEF(MP_QSTR_6, 46483, 1, "6")
+QDEF(MP_QSTR_1, 46484, 1, "1")
+QDEF(MP_QSTR_2, 46487, 1, "2")
+QDEF(MP_QSTR_3, 46486, 1, "3")
+QDEF(MP_QSTR__plus_, 46478, 1, "+")
+QDEF(MP_QSTR__hyphen_, 46472, 1, "-")
+QDEF(MP_QSTR_0, 46485, 1, "0")
+QDEF(MP_QSTR__dot_, 46475, 1, ".")
+QDEF(MP_QSTR_EE, 29093, 2, "EE")
+QDEF(MP_QSTR_Ans, 45881, 3, "Ans")
+QDEF(MP_QSTR_EXE, 43261, 3, "EXE")
+QDEF(MP_QSTR_arrow, 29372, 5, "arrow")
+QDEF(MP_QSTR_axis, 61446, 4, "axis")
+QDEF(MP_QSTR_bar, 18420, 3, "bar")
+QDEF(MP_QSTR_c, 46534, 1, "c")
+QDEF(MP_QSTR_grid, 48989, 4, "grid")
+QDEF(MP_QSTR_head_width, 8468, 10, "head_width")
+QDEF(MP_QSTR_hist, 20131, 4, "hist")
+QDEF(MP_QSTR_plot, 56930, 4, "plot")
+QDEF(MP_QSTR_matplotlib, 10013, 10, "matplotlib")
+QDEF(MP_QSTR_matplotlib_dot_pyplot, 43581, 17, "matplotlib.pyplot")
+QDEF(MP_QSTR_pyplot, 17195, 6, "pyplot")
+QDEF(MP_QSTR_scatter, 44739, 7, "scatter")
+QDEF(MP_QSTR_show, 43654, 4, "show")
+QDEF(MP_QSTR_text, 44952, 4, "text")
+QDEF(MP_QSTR_turtle, 21963, 6, "turtle")
+QDEF(MP_QSTR_forward, 16414, 7, "forward")
+QDEF(MP_QSTR_fd, 28231, 2, "fd")
+QDEF(MP_QSTR_backward, 3662, 8, "backward")
+QDEF(MP_QSTR_bk, 28364, 2, "bk")
+QDEF(MP_QSTR_rt, 28867, 2, "rt")
+QDEF(MP_QSTR_lt, 28317, 2, "lt")
+QDEF(MP_QSTR_goto, 52214, 4, "goto")
+QDEF(MP_QSTR_setpos, 27211, 6, "setpos")
+QDEF(MP_QSTR_setposition, 4414, 11, "setposition")
+QDEF(MP_QSTR_setheading, 40783, 10, "setheading")
+QDEF(MP_QSTR_seth, 29807, 4, "seth")
+QDEF(MP_QSTR_circle, 56759, 6, "circle")
+QDEF(MP_QSTR_speed, 3938, 5, "speed")
+QDEF(MP_QSTR_position, 1052, 8, "position")
+QDEF(MP_QSTR_pos, 29481, 3, "pos")
+QDEF(MP_QSTR_heading, 39213, 7, "heading")
+QDEF(MP_QSTR_pendown, 26956, 7, "pendown")
+QDEF(MP_QSTR_pd, 28689, 2, "pd")
+QDEF(MP_QSTR_penup, 3035, 5, "penup")
+QDEF(MP_QSTR_pu, 28672, 2, "pu")
+QDEF(MP_QSTR_pensize, 3163, 7, "pensize")
+QDEF(MP_QSTR_width, 29987, 5, "width")
+QDEF(MP_QSTR_isdown, 50637, 6, "isdown")
+QDEF(MP_QSTR_pencolor, 39235, 8, "pencolor")
+QDEF(MP_QSTR_reset, 62480, 5, "reset")
+QDEF(MP_QSTR_showturtle, 48584, 10, "showturtle")
+QDEF(MP_QSTR_st, 28898, 2, "st")
+QDEF(MP_QSTR_hideturtle, 27723, 10, "hideturtle")
+QDEF(MP_QSTR_ht, 28441, 2, "ht")
+QDEF(MP_QSTR_isvisible, 38705, 9, "isvisible")
+QDEF(MP_QSTR_colormode, 699, 9, "colormode")
+QDEF(MP_QSTR_localtime, 18045, 9, "localtime")
+QDEF(MP_QSTR_mktime, 11158, 6, "mktime")
+QDEF(MP_QSTR_time, 49648, 4, "time")
+QDEF(MP_QSTR_setlocaltime, 1951, 12, "setlocaltime")
+QDEF(MP_QSTR_setrtcmode, 33473, 10, "setrtcmode")
+QDEF(MP_QSTR_sleep, 10218, 5, "sleep")
+QDEF(MP_QSTR_rtcmode, 64291, 7, "rtcmode")
+QDEF(MP_QSTR_monotonic, 56857, 9, "monotonic")
+QDEF(MP_QSTR_file, 13507, 4, "file")
+QDEF(MP_QSTR_closed, 19959, 6, "closed")
+QDEF(MP_QSTR_flush, 49505, 5, "flush")
+QDEF(MP_QSTR_isatty, 20679, 6, "isatty")
+QDEF(MP_QSTR_readable, 37213, 8, "readable")
+QDEF(MP_QSTR_readlines, 22890, 9, "readlines")
+QDEF(MP_QSTR_seekable, 28215, 8, "seekable")
+QDEF(MP_QSTR_tell, 45332, 4, "tell")
+QDEF(MP_QSTR_writable, 55031, 8, "writable")
+QDEF(MP_QSTR_writelines, 17253, 10, "writelines")
+QDEF(MP_QSTR_fileno, 30338, 6, "fileno")
+QDEF(MP_QSTR_seek, 30109, 4, "seek")
+QDEF(MP_QSTR_truncate, 28235, 8, "truncate")
+QDEF(MP_QSTR_name, 30114, 4, "name")
+QDEF(MP_QSTR_mode, 49190, 4, "mode")
+QDEF(MP_QSTR_SEEK_SET, 40576, 8, "SEEK_SET")
+QDEF(MP_QSTR_SEEK_CUR, 23686, 8, "SEEK_CUR")
+QDEF(MP_QSTR_SEEK_END, 25581, 8, "SEEK_END")
+QDEF(MP_QSTR_os, 28537, 2, "os")
+QDEF(MP_QSTR_uname, 40119, 5, "uname")
+QDEF(MP_QSTR_getlogin, 28400, 8, "getlogin")
+QDEF(MP_QSTR_sysname, 13979, 7, "sysname")
+QDEF(MP_QSTR_nodename, 43874, 8, "nodename")
+QDEF(MP_QSTR_release, 36844, 7, "release")
+QDEF(MP_QSTR_version, 54207, 7, "version")
+QDEF(MP_QSTR_machine, 43872, 7, "machine")
+QDEF(MP_QSTR_username, 38963, 8, "username")
+QDEF(MP_QSTR_rename, 6197, 6, "rename")
+QDEF(MP_QSTR_listdir, 58264, 7, "listdir")
+QDEF(MP_QSTR_reduced, 61217, 7, "reduced")
+QDEF(MP_QSTR_qr, 28710, 2, "qr")
+QDEF(MP_QSTR_flat, 17018, 4, "flat")
+QDEF(MP_QSTR_flatiter, 65008, 8, "flatiter")
+QDEF(MP_QSTR_threshold, 12274, 9, "threshold")
+QDEF(MP_QSTR_edgeitems, 54208, 9, "edgeitems")
+QDEF(MP_QSTR_inplace, 62457, 7, "inplace")
+QDEF(MP_QSTR_dtype, 24921, 5, "dtype")
+QDEF(MP_QSTR_order, 24939, 5, "order")
+QDEF(MP_QSTR_C, 46566, 1, "C")
+QDEF(MP_QSTR_shape, 18122, 5, "shape")
+QDEF(MP_QSTR_strides, 40139, 7, "strides")
+QDEF(MP_QSTR_itemsize, 30581, 8, "itemsize")
+QDEF(MP_QSTR_size, 42272, 4, "size")
+QDEF(MP_QSTR_T, 46577, 1, "T")
+QDEF(MP_QSTR_x, 46557, 1, "x")
+QDEF(MP_QSTR_dx, 28057, 2, "dx")
+QDEF(MP_QSTR_fft, 13969, 3, "fft")
+QDEF(MP_QSTR_ifft, 54776, 4, "ifft")
+QDEF(MP_QSTR_a, 46532, 1, "a")
+QDEF(MP_QSTR_v, 46547, 1, "v")
+QDEF(MP_QSTR_linalg, 36676, 6, "linalg")
+QDEF(MP_QSTR_cholesky, 1161, 8, "cholesky")
+QDEF(MP_QSTR_det, 7792, 3, "det")
+QDEF(MP_QSTR_eig, 8878, 3, "eig")
+QDEF(MP_QSTR_inv, 21268, 3, "inv")
+QDEF(MP_QSTR_norm, 19995, 4, "norm")
+QDEF(MP_QSTR_n, 46539, 1, "n")
+QDEF(MP_QSTR_ddof, 59372, 4, "ddof")
+QDEF(MP_QSTR_numpy, 65146, 5, "numpy")
+QDEF(MP_QSTR_ndarray, 51830, 7, "ndarray")
+QDEF(MP_QSTR_array, 29308, 5, "array")
+QDEF(MP_QSTR_frombuffer, 39315, 10, "frombuffer")
+QDEF(MP_QSTR_inf, 21252, 3, "inf")
+QDEF(MP_QSTR_nan, 22756, 3, "nan")
+QDEF(MP_QSTR_uint8, 64123, 5, "uint8")
+QDEF(MP_QSTR_int8, 46574, 4, "int8")
+QDEF(MP_QSTR_uint16, 18564, 6, "uint16")
+QDEF(MP_QSTR_int16, 29425, 5, "int16")
+QDEF(MP_QSTR_set_printoptions, 50393, 16, "set_printoptions")
+QDEF(MP_QSTR_get_printoptions, 14413, 16, "get_printoptions")
+QDEF(MP_QSTR_ndinfo, 45217, 6, "ndinfo")
+QDEF(MP_QSTR_arange, 63099, 6, "arange")
+QDEF(MP_QSTR_compress, 31395, 8, "compress")
+QDEF(MP_QSTR_concatenate, 40458, 11, "concatenate")
+QDEF(MP_QSTR_delete, 59292, 6, "delete")
+QDEF(MP_QSTR_diag, 64622, 4, "diag")
+QDEF(MP_QSTR_empty, 57264, 5, "empty")
+QDEF(MP_QSTR_eye, 9404, 3, "eye")
+QDEF(MP_QSTR_interp, 63729, 6, "interp")
+QDEF(MP_QSTR_trapz, 17800, 5, "trapz")
+QDEF(MP_QSTR_full, 26838, 4, "full")
+QDEF(MP_QSTR_linspace, 22890, 8, "linspace")
+QDEF(MP_QSTR_logspace, 35205, 8, "logspace")
+QDEF(MP_QSTR_ones, 52178, 4, "ones")
+QDEF(MP_QSTR_zeros, 39572, 5, "zeros")
+QDEF(MP_QSTR_clip, 54483, 4, "clip")
+QDEF(MP_QSTR_equal, 41097, 5, "equal")
+QDEF(MP_QSTR_not_equal, 43875, 9, "not_equal")
+QDEF(MP_QSTR_maximum, 27501, 7, "maximum")
+QDEF(MP_QSTR_minimum, 23411, 7, "minimum")
+QDEF(MP_QSTR_where, 62728, 5, "where")
+QDEF(MP_QSTR_convolve, 52545, 8, "convolve")
+QDEF(MP_QSTR_argmax, 59813, 6, "argmax")
+QDEF(MP_QSTR_argmin, 59579, 6, "argmin")
+QDEF(MP_QSTR_argsort, 15659, 7, "argsort")
+QDEF(MP_QSTR_cross, 61819, 5, "cross")
+QDEF(MP_QSTR_diff, 64712, 4, "diff")
+QDEF(MP_QSTR_dot, 7994, 3, "dot")
+QDEF(MP_QSTR_decimals, 34333, 8, "decimals")
+QDEF(MP_QSTR_otypes, 48609, 6, "otypes")
+QDEF(MP_QSTR_solve_triangular, 42004, 16, "solve_triangular")
+QDEF(MP_QSTR_cho_solve, 3901, 9, "cho_solve")
+QDEF(MP_QSTR_trace, 17316, 5, "trace")
+QDEF(MP_QSTR_flip, 16758, 4, "flip")
+QDEF(MP_QSTR_mean, 51650, 4, "mean")
+QDEF(MP_QSTR_median, 38159, 6, "median")
+QDEF(MP_QSTR_roll, 600, 4, "roll")
+QDEF(MP_QSTR_std, 36166, 3, "std")
+QDEF(MP_QSTR_polyfit, 62516, 7, "polyfit")
+QDEF(MP_QSTR_polyval, 14644, 7, "polyval")
+QDEF(MP_QSTR_arctan2, 32028, 7, "arctan2")
+QDEF(MP_QSTR_around, 58630, 6, "around")
+QDEF(MP_QSTR_vectorize, 36074, 9, "vectorize")
+QDEF(MP_QSTR_xtol, 56170, 4, "xtol")
+QDEF(MP_QSTR_maxiter, 20283, 7, "maxiter")
+QDEF(MP_QSTR_xatol, 25099, 5, "xatol")
+QDEF(MP_QSTR_fatol, 53397, 5, "fatol")
+QDEF(MP_QSTR_tol, 25394, 3, "tol")
+QDEF(MP_QSTR_rtol, 45728, 4, "rtol")
+QDEF(MP_QSTR_scipy, 28917, 5, "scipy")
+QDEF(MP_QSTR_optimize, 44508, 8, "optimize")
+QDEF(MP_QSTR_signal, 443, 6, "signal")
+QDEF(MP_QSTR_bisect, 31375, 6, "bisect")
+QDEF(MP_QSTR_special, 14404, 7, "special")
+QDEF(MP_QSTR_fmin, 17705, 4, "fmin")
+QDEF(MP_QSTR_newton, 33612, 6, "newton")
+QDEF(MP_QSTR_sos, 36970, 3, "sos")
+QDEF(MP_QSTR_zi, 29142, 2, "zi")
+QDEF(MP_QSTR_spectrogram, 23600, 11, "spectrogram")
+QDEF(MP_QSTR_sosfilt, 45245, 7, "sosfilt")
+QDEF(MP_QSTR_gammaln, 38272, 7, "gammaln")
+QDEF(MP_QSTR_reshape, 58749, 7, "reshape")
+QDEF(MP_QSTR_transpose, 59894, 9, "transpose")
+QDEF(MP_QSTR_byteswap, 8410, 8, "byteswap")
+QDEF(MP_QSTR_flatten, 18725, 7, "flatten")
+QDEF(MP_QSTR_k, 46542, 1, "k")
+QDEF(MP_QSTR_tobytes, 12199, 7, "tobytes")
+QDEF(MP_QSTR_tolist, 28028, 6, "tolist")
+QDEF(MP_QSTR_M, 46568, 1, "M")
+QDEF(MP_QSTR_ulab, 21151, 4, "ulab")
+QDEF(MP_QSTR_num, 23411, 3, "num")
+QDEF(MP_QSTR_endpoint, 20230, 8, "endpoint")
+QDEF(MP_QSTR_utils, 40402, 5, "utils")
+QDEF(MP_QSTR_retstep, 43828, 7, "retstep")
+QDEF(MP_QSTR_base, 18160, 4, "base")
+QDEF(MP_QSTR_offset, 15432, 6, "offset")
+QDEF(MP_QSTR_out, 24363, 3, "out")
+QDEF(MP_QSTR_from_int16_buffer, 6567, 17, "from_int16_buffer")
+QDEF(MP_QSTR_from_uint16_buffer, 51410, 18, "from_uint16_buffer")
+QDEF(MP_QSTR_from_int32_buffer, 39201, 17, "from_int32_buffer")
+QDEF(MP_QSTR_from_uint32_buffer, 2644, 18, "from_uint32_buffer")
+QDEF(MP_QSTR_sys, 36540, 3, "sys")
+QDEF(MP_QSTR_info, 46059, 4, "info")
+QDEF(MP_QSTR_implementation, 11543, 14, "implementation")
+QDEF(MP_QSTR_byteorder, 39265, 9, "byteorder")
+QDEF(MP_QSTR_exit, 48773, 4, "exit")
+QDEF(MP_QSTR_modules, 53740, 7, "modules")
+QDEF(MP_QSTR_print_exception, 8732, 15, "print_exception")
+QDEF(MP_QSTR_version_info, 2670, 12, "version_info")
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "exam_icon.h"
+
+// Compressed 162 pixels into 159 bytes (49.07% compression ratio)/
+const uint8_t compressedPixelData[159] = {0x0026, 0x0019, 0x007d, 0x0002, 0x0000, 0x00ed, 0x003a, 0x0085, 0x001b, 0x00ae, 0x001d, 0x00df, 0x003d, 0x00df, 0x003b, 0x00b6, 0x005a, 0x008d, 0x0019, 0x007d, 0x0002, 0x0000, 0x0094, 0x0085, 0x00db, 0x009d, 0x00bc, 0x00ce, 0x009e, 0x00ef, 0x009e, 0x00f7, 0x0002, 0x0000, 0x0064, 0x00fd, 0x00d6, 0x00fb, 0x00a5, 0x0039, 0x0085, 0x0020, 0x0000, 0x008e, 0x009a, 0x0095, 0x007c, 0x00be, 0x005d, 0x00e7, 0x009e, 0x00f7, 0x0002, 0x0000, 0x006f, 0x007e, 0x00ef, 0x009c, 0x00c6, 0x00ba, 0x009d, 0x0024, 0x0000, 0x000f, 0x0020, 0x009a, 0x0095, 0x0022, 0x0000, 0x004f, 0x005d, 0x00e7, 0x009c, 0x00c6, 0x006c, 0x0000, 0x000b, 0x00f1, 0x0004, 0x005c, 0x00be, 0x009e, 0x00f7, 0x00dd, 0x00d6, 0x0019, 0x007d, 0x00fd, 0x00d6, 0x00db, 0x009d, 0x005a, 0x008d, 0x003b, 0x00b6, 0x001d, 0x00df, 0x001d, 0x00b4, 0x0000, 0x0044, 0x00ba, 0x009d, 0x00fd, 0x00d6, 0x008e, 0x0000, 0x0082, 0x003d, 0x00df, 0x009e, 0x00f7, 0x003b, 0x00ae, 0x0019, 0x007d, 0x003c, 0x0000, 0x0011, 0x00db, 0x007e, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0010, 0x0000, 0x0004, 0x0024, 0x0000, 0x0000, 0x0010, 0x0000, 0x0026, 0x007a, 0x008d, 0x0018, 0x0000, 0x0006, 0x006c, 0x0000, 0x002e, 0x00db, 0x009d, 0x0000, 0x0001, 0x0006, 0x0028, 0x0000, 0x0007, 0x0020, 0x0000, 0x0050, 0x007d, 0x0019, 0x007d, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(18, 9, compressedPixelData, 159);
+
+const Image * ImageStore::ExamIcon = &image;
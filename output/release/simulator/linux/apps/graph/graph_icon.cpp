@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "graph_icon.h"
+
+// Compressed 3080 pixels into 395 bytes (6.41% compression ratio)/
+const uint8_t compressedPixelData[395] = {0x0013, 0x00ff, 0x0001, 0x0000, 0x008f, 0x00df, 0x00ff, 0x007d, 0x00ef, 0x005d, 0x00ef, 0x003c, 0x00e7, 0x0002, 0x0000, 0x003d, 0x006a, 0x005d, 0x00ef, 0x007d, 0x00ef, 0x00df, 0x00ff, 0x0001, 0x0000, 0x00af, 0x007d, 0x00ef, 0x003c, 0x00e7, 0x007d, 0x00ef, 0x007d, 0x00ef, 0x009e, 0x00f7, 0x0002, 0x0000, 0x003d, 0x0022, 0x007d, 0x00ef, 0x005c, 0x0000, 0x0006, 0x006c, 0x0000, 0x003f, 0x005d, 0x00ef, 0x005d, 0x0068, 0x0000, 0x0040, 0x0008, 0x0002, 0x0000, 0x0000, 0x0062, 0x0000, 0x0004, 0x00d8, 0x0000, 0x000f, 0x006c, 0x0000, 0x004d, 0x0002, 0x0070, 0x0000, 0x0020, 0x007d, 0x00ef, 0x00b0, 0x0001, 0x004f, 0x003c, 0x00e7, 0x009e, 0x00f7, 0x0002, 0x0000, 0x0051, 0x004f, 0x003c, 0x00e7, 0x00df, 0x00ff, 0x00ae, 0x0001, 0x0043, 0x000f, 0x00c2, 0x0001, 0x0005, 0x001f, 0x005d, 0x006e, 0x0000, 0x0058, 0x002f, 0x005d, 0x00ef, 0x0048, 0x0001, 0x0055, 0x0002, 0x004c, 0x0001, 0x000f, 0x006e, 0x0000, 0x00ff, 0x00ff, 0x0029, 0x004f, 0x008e, 0x0073, 0x008e, 0x0073, 0x006e, 0x0000, 0x0057, 0x004f, 0x0049, 0x004a, 0x0049, 0x004a, 0x006e, 0x0000, 0x00ff, 0x00cc, 0x00ff, 0x0001, 0x005d, 0x00e7, 0x00dc, 0x00ce, 0x005c, 0x00be, 0x00db, 0x00a5, 0x009a, 0x0095, 0x007a, 0x0095, 0x005a, 0x008d, 0x003a, 0x0085, 0x006e, 0x0000, 0x0045, 0x008a, 0x001d, 0x00df, 0x005b, 0x00b6, 0x007a, 0x008d, 0x0019, 0x007d, 0x0002, 0x0000, 0x000f, 0x006e, 0x0000, 0x0041, 0x004c, 0x00bc, 0x00ce, 0x009a, 0x0095, 0x0068, 0x0000, 0x000f, 0x006e, 0x0000, 0x0043, 0x001e, 0x00dc, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0044, 0x004e, 0x007e, 0x00ef, 0x00fb, 0x00a5, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0043, 0x003d, 0x00fd, 0x00d6, 0x005a, 0x00a8, 0x0001, 0x000f, 0x006e, 0x0000, 0x0045, 0x006f, 0x00bc, 0x00ce, 0x0039, 0x0085, 0x0019, 0x007d, 0x006e, 0x0000, 0x0053, 0x002e, 0x009c, 0x00c6, 0x006a, 0x0000, 0x000f, 0x006e, 0x0000, 0x0045, 0x004f, 0x00bc, 0x00ce, 0x0019, 0x007d, 0x006e, 0x0000, 0x0055, 0x004f, 0x00fd, 0x00d6, 0x0039, 0x0085, 0x006e, 0x0000, 0x0055, 0x002e, 0x005d, 0x00e7, 0x001c, 0x0002, 0x000f, 0x006e, 0x0000, 0x0047, 0x004f, 0x00db, 0x009d, 0x0019, 0x007d, 0x006e, 0x0000, 0x0055, 0x000e, 0x001e, 0x0002, 0x000f, 0x006e, 0x0000, 0x0047, 0x004f, 0x007e, 0x00ef, 0x005a, 0x0085, 0x006e, 0x0000, 0x0057, 0x004f, 0x003b, 0x00b6, 0x0019, 0x007d, 0x006e, 0x0000, 0x0055, 0x004f, 0x005d, 0x00e7, 0x003a, 0x0085, 0x006e, 0x0000, 0x0057, 0x001e, 0x005b, 0x00da, 0x0000, 0x000f, 0x006e, 0x0000, 0x0048, 0x002f, 0x005a, 0x008d, 0x006e, 0x0000, 0x0057, 0x001e, 0x00dc, 0x0040, 0x0004, 0x000f, 0x006e, 0x0000, 0x0048, 0x002f, 0x00fb, 0x00a5, 0x006e, 0x0000, 0x0059, 0x002f, 0x003a, 0x0085, 0x006e, 0x0000, 0x0059, 0x002f, 0x0019, 0x007d, 0x006e, 0x0000, 0x00ff, 0x0036, 0x000f, 0x0002, 0x0000, 0x002d, 0x002f, 0x008e, 0x0073, 0x00e4, 0x000c, 0x0017, 0x000f, 0x006e, 0x0000, 0x0059, 0x000f, 0x0078, 0x000f, 0x00ff, 0x00ff, 0x0001, 0x000f, 0x007a, 0x0012, 0x0057, 0x0002, 0x00c8, 0x0013, 0x000f, 0x0056, 0x0013, 0x0059, 0x000f, 0x0032, 0x0014, 0x005b, 0x000f, 0x000e, 0x0015, 0x005b, 0x000f, 0x00ea, 0x0015, 0x005d, 0x0006, 0x00c6, 0x0016, 0x000f, 0x00b0, 0x0001, 0x0045, 0x000a, 0x00c6, 0x0016, 0x000f, 0x00a2, 0x0017, 0x0052, 0x0050, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 
+};
+
+constexpr Image image = Image(55, 56, compressedPixelData, 395);
+
+const Image * ImageStore::GraphIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_binomial_icon.h"
+
+// Compressed 665 pixels into 87 bytes (6.54% compression ratio)/
+const uint8_t compressedPixelData[87] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x000d, 0x002f, 0x0019, 0x007d, 0x0024, 0x0000, 0x000f, 0x000f, 0x0042, 0x0000, 0x000f, 0x0004, 0x0004, 0x0000, 0x000f, 0x0046, 0x0000, 0x0069, 0x002e, 0x0019, 0x007d, 0x0004, 0x0000, 0x000f, 0x0046, 0x0000, 0x00a7, 0x000e, 0x0042, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x0097, 0x000e, 0x0042, 0x0000, 0x000e, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x00dd, 0x002f, 0x0019, 0x007d, 0x0004, 0x0000, 0x0017, 0x000f, 0x0046, 0x0000, 0x008f, 0x002f, 0x0019, 0x007d, 0x0004, 0x0000, 0x001f, 0x000f, 0x0042, 0x0000, 0x002f, 0x000a, 0x004a, 0x0000, 0x002f, 0x0019, 0x007d, 0x0004, 0x0000, 0x002a, 0x0050, 0x00e7, 0x0019, 0x007d, 0x001c, 0x00e7, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 87);
+
+const Image * ImageStore::FocusedBinomialIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_calcul2_icon.h"
+
+// Compressed 897 pixels into 324 bytes (18.06% compression ratio)/
+const uint8_t compressedPixelData[324] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x00a9, 0x00af, 0x007b, 0x00c6, 0x007a, 0x0095, 0x0039, 0x0085, 0x007a, 0x0095, 0x007b, 0x00c6, 0x004c, 0x0000, 0x0031, 0x0041, 0x0019, 0x0085, 0x0019, 0x007d, 0x0002, 0x0000, 0x001f, 0x0085, 0x0050, 0x0000, 0x002d, 0x0064, 0x00fb, 0x00de, 0x005a, 0x008d, 0x0019, 0x007d, 0x0002, 0x0000, 0x004f, 0x0039, 0x0085, 0x00fb, 0x00de, 0x004e, 0x0000, 0x0029, 0x0048, 0x001a, 0x00ae, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x001a, 0x00ae, 0x009a, 0x0000, 0x0029, 0x002a, 0x003a, 0x0085, 0x004e, 0x0000, 0x001f, 0x003a, 0x009e, 0x0000, 0x0028, 0x004c, 0x005b, 0x00c6, 0x0019, 0x007d, 0x0002, 0x0000, 0x000f, 0x003c, 0x0001, 0x0027, 0x003b, 0x00ba, 0x009d, 0x0039, 0x009c, 0x0000, 0x004f, 0x0039, 0x0085, 0x00ba, 0x00a5, 0x00e8, 0x0000, 0x0025, 0x004a, 0x0039, 0x0085, 0x00ba, 0x009d, 0x004e, 0x0000, 0x0000, 0x0060, 0x0000, 0x001f, 0x00fc, 0x00ec, 0x0000, 0x0022, 0x004e, 0x009b, 0x00ce, 0x005a, 0x008d, 0x0086, 0x0001, 0x004f, 0x005a, 0x008d, 0x009b, 0x00ce, 0x00d0, 0x0001, 0x0023, 0x002e, 0x00da, 0x00a5, 0x004e, 0x0000, 0x002f, 0x00da, 0x00a5, 0x00d8, 0x0001, 0x0023, 0x0000, 0x00fe, 0x0002, 0x000e, 0x004e, 0x0000, 0x004f, 0x005b, 0x00c6, 0x007a, 0x0095, 0x004c, 0x0000, 0x001f, 0x0020, 0x00bb, 0x00ce, 0x00ac, 0x0002, 0x000e, 0x004e, 0x0000, 0x0000, 0x004e, 0x0001, 0x002f, 0x00bb, 0x00ce, 0x00d0, 0x0001, 0x001f, 0x002f, 0x00fa, 0x00ad, 0x00be, 0x0002, 0x0003, 0x004f, 0x00fa, 0x00ad, 0x00ba, 0x009d, 0x006a, 0x0002, 0x001c, 0x0021, 0x00be, 0x005a, 0x00a8, 0x0002, 0x000e, 0x004e, 0x0000, 0x0002, 0x00ec, 0x0001, 0x002f, 0x005b, 0x00c6, 0x00ce, 0x0001, 0x0018, 0x0023, 0x00c6, 0x0039, 0x00e2, 0x0003, 0x000e, 0x005a, 0x0003, 0x0002, 0x000a, 0x0004, 0x004f, 0x0039, 0x0085, 0x009b, 0x00ce, 0x0098, 0x0000, 0x0015, 0x0004, 0x004c, 0x0000, 0x000f, 0x00a8, 0x0003, 0x0007, 0x0000, 0x0050, 0x0000, 0x002f, 0x005b, 0x00be, 0x007c, 0x0001, 0x000e, 0x0038, 0x00d6, 0x00ba, 0x009d, 0x0052, 0x0002, 0x000e, 0x00f6, 0x0003, 0x0006, 0x00c0, 0x0000, 0x006f, 0x005a, 0x008d, 0x00ba, 0x009d, 0x00bb, 0x00d6, 0x0046, 0x0000, 0x0001, 0x00ef, 0x00fc, 0x00de, 0x00bb, 0x00d6, 0x003b, 0x00be, 0x009a, 0x009d, 0x0039, 0x0085, 0x00fa, 0x00ad, 0x00fb, 0x00de, 0x0044, 0x0004, 0x0013, 0x00ca, 0x00fb, 0x00de, 0x00fa, 0x00ad, 0x0039, 0x0085, 0x009a, 0x009d, 0x003b, 0x00be, 0x00bb, 0x00d6, 0x0020, 0x0003, 0x00af, 0x001a, 0x00b6, 0x005a, 0x008d, 0x00ba, 0x00a5, 0x005b, 0x00be, 0x00fb, 0x00de, 0x0092, 0x0004, 0x001b, 0x00af, 0x00fb, 0x00de, 0x005b, 0x00be, 0x00ba, 0x00a5, 0x005a, 0x008d, 0x001a, 0x00b6, 0x0040, 0x0006, 0x008a, 0x0050, 0x00e7, 0x001c, 0x00e7, 0x001c, 0x00e7, 
+};
+
+constexpr Image image = Image(39, 23, compressedPixelData, 324);
+
+const Image * ImageStore::FocusedCalcul2Icon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_chi_squared_icon.h"
+
+// Compressed 665 pixels into 169 bytes (12.71% compression ratio)/
+const uint8_t compressedPixelData[169] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x00ff, 0x00dc, 0x00cf, 0x009b, 0x00ce, 0x00ba, 0x009d, 0x003a, 0x0085, 0x0039, 0x0085, 0x00ba, 0x009d, 0x009b, 0x00ce, 0x0044, 0x0000, 0x0025, 0x0046, 0x003b, 0x00b6, 0x0019, 0x007d, 0x0002, 0x0000, 0x001f, 0x009a, 0x004a, 0x0000, 0x0022, 0x004c, 0x007b, 0x00c6, 0x0019, 0x007d, 0x0002, 0x0000, 0x004f, 0x00da, 0x00a5, 0x00db, 0x00d6, 0x0044, 0x0000, 0x0019, 0x006e, 0x00fb, 0x00de, 0x005a, 0x008d, 0x0019, 0x007d, 0x0002, 0x0000, 0x006f, 0x0039, 0x0085, 0x003b, 0x00b6, 0x00fb, 0x00de, 0x00ce, 0x0000, 0x0023, 0x000a, 0x0002, 0x0000, 0x004f, 0x007a, 0x008d, 0x007b, 0x00c6, 0x0046, 0x0000, 0x0013, 0x001e, 0x007a, 0x008a, 0x0000, 0x000f, 0x00dc, 0x0000, 0x0020, 0x000e, 0x0044, 0x0000, 0x000d, 0x0002, 0x0000, 0x001e, 0x0085, 0x004a, 0x0000, 0x000f, 0x0046, 0x0000, 0x0020, 0x0001, 0x0026, 0x0001, 0x004f, 0x00fa, 0x00ad, 0x00db, 0x00d6, 0x0046, 0x0000, 0x002d, 0x0004, 0x0004, 0x0002, 0x004f, 0x005b, 0x00be, 0x00fc, 0x00de, 0x0046, 0x0000, 0x002d, 0x0000, 0x0002, 0x0000, 0x008f, 0x005a, 0x008d, 0x00fa, 0x00ad, 0x009b, 0x00c6, 0x00fc, 0x00de, 0x0046, 0x0000, 0x002b, 0x0004, 0x00e2, 0x0000, 0x00ef, 0x009a, 0x0095, 0x00fa, 0x00ad, 0x005b, 0x00be, 0x009b, 0x00ce, 0x00db, 0x00d6, 0x00fb, 0x00de, 0x00fc, 0x00de, 0x0046, 0x0000, 0x0023, 0x0007, 0x0002, 0x0000, 0x0050, 0x007d, 0x0019, 0x007d, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 169);
+
+const Image * ImageStore::FocusedChiSquaredIcon = &image;
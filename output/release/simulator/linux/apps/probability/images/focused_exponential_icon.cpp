@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_exponential_icon.h"
+
+// Compressed 665 pixels into 200 bytes (15.04% compression ratio)/
+const uint8_t compressedPixelData[200] = {0x006f, 0x0019, 0x007d, 0x00fb, 0x00de, 0x001c, 0x00e7, 0x0002, 0x0000, 0x002d, 0x004f, 0x0019, 0x007d, 0x00bb, 0x00d6, 0x0046, 0x0000, 0x0031, 0x002f, 0x003b, 0x00be, 0x0046, 0x0000, 0x0031, 0x002f, 0x009a, 0x0095, 0x0046, 0x0000, 0x0031, 0x004f, 0x0019, 0x007d, 0x00bb, 0x00ce, 0x0046, 0x0000, 0x0030, 0x0000, 0x008e, 0x0000, 0x001f, 0x00df, 0x0046, 0x0000, 0x002f, 0x004f, 0x0019, 0x007d, 0x005b, 0x00be, 0x0046, 0x0000, 0x0031, 0x004f, 0x0039, 0x0085, 0x009b, 0x00ce, 0x0046, 0x0000, 0x002f, 0x0000, 0x0048, 0x0000, 0x002f, 0x00bb, 0x00ce, 0x0046, 0x0000, 0x002f, 0x0001, 0x0090, 0x0000, 0x001f, 0x00c6, 0x0046, 0x0000, 0x002e, 0x0000, 0x0002, 0x0000, 0x005f, 0x0085, 0x00fa, 0x00ad, 0x00fc, 0x00de, 0x0046, 0x0000, 0x002d, 0x0000, 0x0002, 0x0000, 0x004f, 0x007a, 0x0095, 0x009b, 0x00ce, 0x0046, 0x0000, 0x002f, 0x0000, 0x0002, 0x0000, 0x004f, 0x00ba, 0x009d, 0x009b, 0x00ce, 0x0046, 0x0000, 0x002f, 0x0001, 0x0094, 0x0000, 0x005f, 0x008d, 0x001a, 0x00b6, 0x00db, 0x00de, 0x0046, 0x0000, 0x002d, 0x0002, 0x0028, 0x0001, 0x006f, 0x00ba, 0x009d, 0x007b, 0x00c6, 0x00fb, 0x00de, 0x0046, 0x0000, 0x002c, 0x0003, 0x00bc, 0x0001, 0x006f, 0x009a, 0x009d, 0x003b, 0x00b6, 0x00bb, 0x00d6, 0x0046, 0x0000, 0x002b, 0x0006, 0x004e, 0x0000, 0x008f, 0x00ba, 0x009d, 0x001b, 0x00b6, 0x009b, 0x00ce, 0x00db, 0x00de, 0x0046, 0x0000, 0x0029, 0x0006, 0x0002, 0x0000, 0x00ff, 0x0005, 0x005a, 0x008d, 0x009a, 0x009d, 0x00da, 0x00a5, 0x001a, 0x00b6, 0x005b, 0x00be, 0x007b, 0x00c6, 0x00bb, 0x00d6, 0x00db, 0x00de, 0x00fc, 0x00de, 0x0019, 0x007d, 0x0002, 0x0000, 0x002c, 0x0050, 0x007d, 0x0019, 0x007d, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 200);
+
+const Image * ImageStore::FocusedExponentialIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_normal_icon.h"
+
+// Compressed 665 pixels into 235 bytes (17.67% compression ratio)/
+const uint8_t compressedPixelData[235] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x0009, 0x00cf, 0x003b, 0x00be, 0x005a, 0x008d, 0x0039, 0x0085, 0x005a, 0x008d, 0x003b, 0x00be, 0x001c, 0x00e7, 0x0002, 0x0000, 0x0025, 0x0044, 0x001a, 0x00ae, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x001a, 0x00b6, 0x0044, 0x0000, 0x0023, 0x0048, 0x007b, 0x00c6, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x007b, 0x00c6, 0x0044, 0x0000, 0x001f, 0x004a, 0x00fc, 0x00de, 0x005a, 0x008d, 0x0046, 0x0000, 0x004f, 0x005a, 0x008d, 0x00fc, 0x00de, 0x0046, 0x0000, 0x001d, 0x004c, 0x003b, 0x00b6, 0x0019, 0x007d, 0x0002, 0x0000, 0x000f, 0x001e, 0x0001, 0x001d, 0x001d, 0x00fb, 0x008a, 0x0000, 0x0002, 0x008e, 0x0000, 0x001f, 0x00fb, 0x008e, 0x0000, 0x001a, 0x002e, 0x005b, 0x00be, 0x0044, 0x0000, 0x0000, 0x0002, 0x0000, 0x001f, 0x005b, 0x008e, 0x0000, 0x001a, 0x002f, 0x009a, 0x009d, 0x0046, 0x0000, 0x0003, 0x002f, 0x009a, 0x009d, 0x0044, 0x0000, 0x0017, 0x002e, 0x00db, 0x00d6, 0x0044, 0x0000, 0x0004, 0x0002, 0x0000, 0x002f, 0x00db, 0x00d6, 0x0028, 0x0002, 0x0021, 0x000c, 0x0002, 0x0000, 0x002f, 0x001a, 0x00ae, 0x005a, 0x0001, 0x0029, 0x000e, 0x0062, 0x0001, 0x000f, 0x005a, 0x0001, 0x0023, 0x000f, 0x0062, 0x0001, 0x0019, 0x001e, 0x00db, 0x008a, 0x0000, 0x000f, 0x008e, 0x0000, 0x001f, 0x002e, 0x00df, 0x00ba, 0x009e, 0x0001, 0x000d, 0x0002, 0x0000, 0x004f, 0x00ba, 0x009d, 0x001c, 0x00df, 0x0058, 0x0001, 0x0025, 0x000f, 0x0064, 0x0001, 0x0013, 0x006f, 0x00fb, 0x00de, 0x00fa, 0x00a5, 0x0019, 0x007d, 0x0002, 0x0000, 0x0015, 0x002f, 0x00da, 0x00a5, 0x00d8, 0x0000, 0x0001, 0x006f, 0x009b, 0x00ce, 0x007a, 0x0095, 0x0019, 0x007d, 0x0002, 0x0000, 0x0019, 0x0046, 0x007a, 0x0095, 0x009b, 0x00ce, 0x0082, 0x0000, 0x004f, 0x00bb, 0x00ce, 0x003b, 0x00b6, 0x0042, 0x0000, 0x001d, 0x0006, 0x004a, 0x0000, 0x008f, 0x003b, 0x00b6, 0x00bb, 0x00ce, 0x00fb, 0x00de, 0x0019, 0x007d, 0x0002, 0x0000, 0x002c, 0x0050, 0x007d, 0x0019, 0x007d, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 235);
+
+const Image * ImageStore::FocusedNormalIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_uniform_icon.h"
+
+// Compressed 665 pixels into 39 bytes (2.93% compression ratio)/
+const uint8_t compressedPixelData[39] = {0x002f, 0x001c, 0x00e7, 0x0002, 0x0000, 0x00ff, 0x00e4, 0x002f, 0x0019, 0x007d, 0x0002, 0x0000, 0x0017, 0x000f, 0x0046, 0x0000, 0x001f, 0x000e, 0x002a, 0x0000, 0x000f, 0x0046, 0x0000, 0x00ff, 0x00ff, 0x0073, 0x000f, 0x00ee, 0x0002, 0x0025, 0x0005, 0x001c, 0x0000, 0x0050, 0x007d, 0x0019, 0x007d, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 39);
+
+const Image * ImageStore::FocusedUniformIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "normal_icon.h"
+
+// Compressed 665 pixels into 235 bytes (17.67% compression ratio)/
+const uint8_t compressedPixelData[235] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x000a, 0x00bf, 0x00dd, 0x00ce, 0x007a, 0x0095, 0x003a, 0x0085, 0x007a, 0x0095, 0x00dd, 0x00ce, 0x00ff, 0x0001, 0x0000, 0x0026, 0x0044, 0x009c, 0x00be, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x009c, 0x00c6, 0x0044, 0x0000, 0x0023, 0x0048, 0x003e, 0x00df, 0x0019, 0x007d, 0x0002, 0x0000, 0x002f, 0x003e, 0x00df, 0x0046, 0x0000, 0x0021, 0x002a, 0x009a, 0x0095, 0x0046, 0x0000, 0x002f, 0x007a, 0x0095, 0x0044, 0x0000, 0x001f, 0x004c, 0x00dd, 0x00ce, 0x0019, 0x007d, 0x0002, 0x0000, 0x000f, 0x001e, 0x0001, 0x001f, 0x002e, 0x007a, 0x008d, 0x0046, 0x0000, 0x002f, 0x007a, 0x008d, 0x0044, 0x0000, 0x001b, 0x002e, 0x00fd, 0x00d6, 0x0044, 0x0000, 0x0000, 0x0002, 0x0000, 0x002f, 0x001d, 0x00d7, 0x0046, 0x0000, 0x0019, 0x002f, 0x00db, 0x00a5, 0x0046, 0x0000, 0x0003, 0x002f, 0x00fb, 0x00a5, 0x0044, 0x0000, 0x0017, 0x002e, 0x00bf, 0x00ef, 0x0044, 0x0000, 0x0004, 0x0002, 0x0000, 0x002f, 0x00bf, 0x00ef, 0x0028, 0x0002, 0x0021, 0x000c, 0x0002, 0x0000, 0x002f, 0x009c, 0x00be, 0x005a, 0x0001, 0x0029, 0x000e, 0x0062, 0x0001, 0x000f, 0x00e4, 0x0001, 0x001f, 0x0008, 0x0002, 0x0000, 0x001f, 0x00fd, 0x00f0, 0x0001, 0x0010, 0x002e, 0x00df, 0x00f7, 0x008a, 0x0000, 0x000c, 0x008e, 0x0000, 0x002f, 0x00df, 0x00f7, 0x0046, 0x0000, 0x000d, 0x001e, 0x00fb, 0x009e, 0x0001, 0x000f, 0x00aa, 0x0001, 0x001e, 0x000e, 0x0058, 0x0001, 0x000f, 0x0064, 0x0001, 0x001f, 0x004f, 0x005c, 0x00b6, 0x0019, 0x007d, 0x0002, 0x0000, 0x0015, 0x002f, 0x003c, 0x00b6, 0x0042, 0x0000, 0x0001, 0x002c, 0x005e, 0x00e7, 0x007e, 0x0003, 0x000f, 0x0002, 0x0000, 0x000d, 0x0045, 0x00ba, 0x0095, 0x005e, 0x00e7, 0x004e, 0x0001, 0x009f, 0x00ff, 0x007e, 0x00e7, 0x00bd, 0x00c6, 0x00bb, 0x009d, 0x0019, 0x007d, 0x0002, 0x0000, 0x0021, 0x00af, 0x00bb, 0x009d, 0x00bd, 0x00ce, 0x007e, 0x00e7, 0x00df, 0x00ff, 0x0019, 0x007d, 0x0002, 0x0000, 0x002c, 0x0050, 0x007d, 0x0019, 0x007d, 0x0019, 0x007d, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 235);
+
+const Image * ImageStore::NormalIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "student_icon.h"
+
+// Compressed 665 pixels into 249 bytes (18.72% compression ratio)/
+const uint8_t compressedPixelData[249] = {0x001f, 0x00ff, 0x0001, 0x0000, 0x000c, 0x007f, 0x00fd, 0x00d6, 0x005a, 0x0085, 0x00fd, 0x00ce, 0x00ff, 0x0001, 0x0000, 0x002a, 0x00af, 0x00df, 0x00ff, 0x005a, 0x008d, 0x0019, 0x007d, 0x003a, 0x0085, 0x00df, 0x00f7, 0x0046, 0x0000, 0x0029, 0x0040, 0x00dd, 0x00ce, 0x0019, 0x007d, 0x0002, 0x0000, 0x001f, 0x00dd, 0x008e, 0x0000, 0x002a, 0x0022, 0x00fb, 0x00a5, 0x0046, 0x0000, 0x002f, 0x00fb, 0x00a5, 0x00d0, 0x0000, 0x0029, 0x0022, 0x003a, 0x0085, 0x0046, 0x0000, 0x003f, 0x0039, 0x0085, 0x00df, 0x0046, 0x0000, 0x0026, 0x0044, 0x001e, 0x00df, 0x0019, 0x007d, 0x0002, 0x0000, 0x001f, 0x001e, 0x0047, 0x0000, 0x0026, 0x0026, 0x005c, 0x00b6, 0x0046, 0x0000, 0x002f, 0x007c, 0x00be, 0x0046, 0x0000, 0x0025, 0x0026, 0x00bb, 0x009d, 0x0046, 0x0000, 0x002f, 0x00bb, 0x009d, 0x0016, 0x0001, 0x0025, 0x0026, 0x0039, 0x0085, 0x0046, 0x0000, 0x001f, 0x0019, 0x001a, 0x0001, 0x0024, 0x0017, 0x003e, 0x0016, 0x0001, 0x0000, 0x0002, 0x0000, 0x001f, 0x003e, 0x0047, 0x0000, 0x0022, 0x002a, 0x009c, 0x00be, 0x0046, 0x0000, 0x001f, 0x009c, 0x001a, 0x0001, 0x0022, 0x002a, 0x009a, 0x0095, 0x0046, 0x0000, 0x002f, 0x009a, 0x0095, 0x00d0, 0x0000, 0x002f, 0x000f, 0x00d4, 0x0000, 0x0021, 0x004e, 0x00df, 0x00f7, 0x007a, 0x0095, 0x0046, 0x0000, 0x003f, 0x007a, 0x0095, 0x00df, 0x009e, 0x0001, 0x001a, 0x0017, 0x00db, 0x00e4, 0x0001, 0x0008, 0x0002, 0x0000, 0x002f, 0x00db, 0x00a5, 0x0048, 0x0000, 0x0015, 0x002c, 0x007e, 0x00ef, 0x0012, 0x0001, 0x000a, 0x001e, 0x0001, 0x002f, 0x007e, 0x00ef, 0x00ca, 0x0000, 0x000f, 0x0029, 0x009c, 0x00be, 0x0026, 0x0002, 0x000d, 0x0002, 0x0000, 0x0000, 0x0054, 0x0003, 0x002f, 0x009c, 0x00be, 0x002a, 0x0004, 0x0007, 0x0044, 0x007e, 0x00e7, 0x005c, 0x00b6, 0x007e, 0x0003, 0x000f, 0x0002, 0x0000, 0x000d, 0x0068, 0x003a, 0x0085, 0x005c, 0x00b6, 0x007e, 0x00e7, 0x007e, 0x0000, 0x008f, 0x007e, 0x00e7, 0x00dd, 0x00ce, 0x003c, 0x00b6, 0x007a, 0x008d, 0x0040, 0x0000, 0x0013, 0x0009, 0x006e, 0x0001, 0x0090, 0x008d, 0x003c, 0x00b6, 0x00dd, 0x00ce, 0x007e, 0x00e7, 0x00df, 0x00f7, 
+};
+
+constexpr Image image = Image(35, 19, compressedPixelData, 249);
+
+const Image * ImageStore::StudentIcon = &image;